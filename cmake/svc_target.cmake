@@ -17,6 +17,16 @@ function(svc_target exe_target)
     # INIT_LOCAL_VARS      -- initialize local variables at declaration with zero
     # INIT_RESET_LOCAL_VARS-- initialize CTHREAD reset section local variables 
     #                         at declaration with zero
+    # SV_FUNC_GENERATE     -- generate pure C++ functions as SystemVerilog 
+    #                         functions instead of inlining them
+    # CPP_MODEL_GENERATE   -- generate cycle-based C++ model of the design
+    # CPP_MODEL_SC_MODULE  -- generate C++ model with SystemC module which 
+    #                         runs CTHREADs as SC_METHODs
+    # MODEL_TEST -- generate C++ model and build target sources with the model
+    #               header included as SCT_MODEL_HEADER, run it in _MODEL test
+    # BATCH      -- build synthesis target as shared library which is run by
+    #               sctool_batch driver, enabled for all targets if SVC_BATCH
+    #               variable is set, see svc_batch_test()
     # WILL_FAIL  -- test will fail on non-synthesizable code
     set(boolOptions REPLACE_CONST_VALUE 
                     NO_SVA_GENERATE
@@ -25,6 +35,11 @@ function(svc_target exe_target)
                     NO_REMOVE_EXTRA_CODE
                     INIT_LOCAL_VARS
                     INIT_RESET_LOCAL_VARS
+                    SV_FUNC_GENERATE
+                    CPP_MODEL_GENERATE
+                    CPP_MODEL_SC_MODULE
+                    MODEL_TEST
+                    BATCH
                     WILL_FAIL)
 
     # Arguments with one value
@@ -36,7 +51,15 @@ function(svc_target exe_target)
                      MODULE_PREFIX)
 
     # Multiple value arguments
-    set(multiValueArgs "")
+    # SWEEP_TOPS    -- Hierarchical names of several design tops, for example
+    #                  configurations with different parameters, each top is
+    #                  generated into <exe_target>_<top name>.sv in one run,
+    #                  not used with ELAB_TOP, GOLDEN for each top is 
+    #                  <GOLDEN name>_<top name>.sv
+    # SWEEP_GOLDENS -- Golden Verilog output for each of SWEEP_TOPS in the same
+    #                  order, used instead of GOLDEN to compare with goldens 
+    #                  of separate runs for these tops
+    set(multiValueArgs SWEEP_TOPS SWEEP_GOLDENS)
 
     # Generate variable-value pairs: PARAM_ELAB_ONLY, PARAM_CONST_PROP, ...
     cmake_parse_arguments(PARAM "${boolOptions}" "${oneValueArgs}" 
@@ -66,6 +89,19 @@ function(svc_target exe_target)
         set(INIT_RESET_LOCAL_VARS -init_reset_local_vars)
     endif()
 
+    if (${PARAM_SV_FUNC_GENERATE})
+        set(SV_FUNC_GENERATE -sv_func_generate)
+    endif()
+
+    if (${PARAM_CPP_MODEL_GENERATE} OR 
+        (${PARAM_MODEL_TEST} AND NOT ${PARAM_CPP_MODEL_SC_MODULE}))
+        set(CPP_MODEL_GENERATE -cpp_model_generate)
+    endif()
+
+    if (${PARAM_CPP_MODEL_SC_MODULE})
+        set(CPP_MODEL_SC_MODULE -cpp_model_sc_module)
+    endif()
+
     if (${PARAM_REPLACE_CONST_VALUE})
         set(REPLACE_CONST_VALUE -replace_const_value)
     endif()
@@ -77,6 +113,24 @@ function(svc_target exe_target)
     if (PARAM_MODULE_PREFIX)
         set(MODULE_PREFIX -module_prefix ${PARAM_MODULE_PREFIX})
     endif()
+
+    if (PARAM_SWEEP_TOPS)
+        if (PARAM_ELAB_TOP)
+            message(FATAL_ERROR 
+                    "svc_target ${exe_target}: ELAB_TOP cannot be used with SWEEP_TOPS")
+        endif()
+        string (REPLACE ";" "," SWEEP_TOPS_STR "${PARAM_SWEEP_TOPS}")
+        set(SWEEP_TOPS -sweep_top ${SWEEP_TOPS_STR})
+    endif()
+
+    if (PARAM_SWEEP_GOLDENS)
+        list(LENGTH PARAM_SWEEP_TOPS sweepTopNum)
+        list(LENGTH PARAM_SWEEP_GOLDENS sweepGoldenNum)
+        if (NOT sweepTopNum EQUAL sweepGoldenNum OR PARAM_GOLDEN)
+            message(FATAL_ERROR 
+                    "svc_target ${exe_target}: SWEEP_GOLDENS should have one golden for each of SWEEP_TOPS and cannot be used with GOLDEN")
+        endif()
+    endif()
     
 
     # Include directories and options for SC are described in SVCTargets.cmake
@@ -158,6 +212,7 @@ function(svc_target exe_target)
             ${SCTOOL_INPUT_CPP}
             -sv_out ${VERILOG_OUT}
             ${ELAB_TOP}
+            ${SWEEP_TOPS}
             ${MODULE_PREFIX}
             ${REPLACE_CONST_VALUE}
             ${NO_SVA_GENERATE}
@@ -166,6 +221,9 @@ function(svc_target exe_target)
             ${NO_REMOVE_EXTRA_CODE}
             ${INIT_LOCAL_VARS}
             ${INIT_RESET_LOCAL_VARS}
+            ${SV_FUNC_GENERATE}
+            ${CPP_MODEL_GENERATE}
+            ${CPP_MODEL_SC_MODULE}
             --
             -D__SC_TOOL__ -D__SC_TOOL_ANALYZE__ -DNDEBUG
             -Wno-logical-op-parentheses
@@ -193,7 +251,12 @@ function(svc_target exe_target)
 
     # Synthesis target
     set(exe_target_sctool ${exe_target}_sctool )
-    add_executable(${exe_target_sctool} ${SCTOOL_INPUT_CPP})
+    if (PARAM_BATCH OR SVC_BATCH)
+        # Design library loaded by sctool_batch
+        add_library(${exe_target_sctool} MODULE ${SCTOOL_INPUT_CPP})
+    else()
+        add_executable(${exe_target_sctool} ${SCTOOL_INPUT_CPP})
+    endif()
 
     # targetLibraries optional testbench libraries given in target CMakeList.txt
     # and SystemC added above
@@ -225,17 +288,95 @@ function(svc_target exe_target)
              --target ${exe_target_sctool})
 
     # Create _SYN target for ctest, runs elaboration and synthesis
-    add_test(NAME ${exe_target}_SYN COMMAND ${exe_target_sctool})
+    if (PARAM_BATCH OR SVC_BATCH)
+        add_test(NAME ${exe_target}_SYN 
+                 COMMAND $<TARGET_FILE:SVC::sctool_batch> 
+                         $<TARGET_FILE:${exe_target_sctool}>)
+        # SV is written by _SYN and svc_batch_test() as well
+        set_tests_properties(${exe_target}_SYN PROPERTIES 
+                             RESOURCE_LOCK ${exe_target_sctool})
+        # Register design for svc_batch_test(), failing designs are not run 
+        if (NOT PARAM_WILL_FAIL)
+            set_property(GLOBAL APPEND PROPERTY SVC_BATCH_LIBS 
+                         $<TARGET_FILE:${exe_target_sctool}>)
+            set_property(GLOBAL APPEND PROPERTY SVC_BATCH_BUILDS 
+                         ${exe_target}_BUILD)
+            set_property(GLOBAL APPEND PROPERTY SVC_BATCH_LOCKS 
+                         ${exe_target_sctool})
+        endif()
+    else()
+        add_test(NAME ${exe_target}_SYN COMMAND ${exe_target_sctool})
+    endif()
     # WILL_FAIL -- support tests which contains non-synthesizable code, parameter in svc_target
     # DEPENDS   -- waiting for BUILD is done
     set_tests_properties(${exe_target}_SYN PROPERTIES WILL_FAIL ${PARAM_WILL_FAIL} 
                          DEPENDS ${exe_target}_BUILD)
 
-    if (PARAM_GOLDEN)
-        add_test(NAME ${exe_target}_DIFF COMMAND bash -c 
-                 "diff -U 3 -dHrN <(sed '/The code is generated by Intel Compiler for SystemC/d;' ${CMAKE_CURRENT_SOURCE_DIR}/${PARAM_GOLDEN}) <(sed '/The code is generated by Intel Compiler for SystemC/d;' ${VERILOG_OUT}) > ${exe_target}.diff"
-                )
-        set_tests_properties(${exe_target}_DIFF PROPERTIES DEPENDS ${exe_target}_SYN)
+    # Golden file for each generated SV, for parameter sweep each top output
+    # compared with its own golden, dots in top name replaced as in the tool
+    set(DIFF_TARGETS "")
+    if (PARAM_SWEEP_GOLDENS)
+        math(EXPR lastIndex "${sweepTopNum} - 1")
+        foreach(i RANGE ${lastIndex})
+            list(GET PARAM_SWEEP_TOPS ${i} sweepTop)
+            list(GET PARAM_SWEEP_GOLDENS ${i} sweepGolden)
+            string(REPLACE "." "_" topSuffix ${sweepTop})
+            list(APPEND DIFF_TARGETS ${exe_target}_${topSuffix})
+            set(GOLDEN_${exe_target}_${topSuffix} ${sweepGolden})
+        endforeach()
+    elseif (PARAM_GOLDEN AND PARAM_SWEEP_TOPS)
+        string(REGEX REPLACE "\\.sv$" "" GOLDEN_BASE ${PARAM_GOLDEN})
+        foreach(sweepTop ${PARAM_SWEEP_TOPS})
+            string(REPLACE "." "_" topSuffix ${sweepTop})
+            list(APPEND DIFF_TARGETS ${exe_target}_${topSuffix})
+            set(GOLDEN_${exe_target}_${topSuffix} ${GOLDEN_BASE}_${topSuffix}.sv)
+        endforeach()
+    elseif (PARAM_GOLDEN)
+        list(APPEND DIFF_TARGETS ${exe_target})
+        set(GOLDEN_${exe_target} ${PARAM_GOLDEN})
+    endif()
+
+    foreach(diffTarget ${DIFF_TARGETS})
+        set(DIFF_CMD "diff -U 3 -dHrN <(sed '/The code is generated by Intel Compiler for SystemC/d' ${CMAKE_CURRENT_SOURCE_DIR}/${GOLDEN_${diffTarget}}) <(sed '/The code is generated by Intel Compiler for SystemC/d' ${VERILOG_DIR}/${diffTarget}.sv) > ${CMAKE_CURRENT_BINARY_DIR}/${diffTarget}.diff")
+        add_test(NAME ${diffTarget}_DIFF COMMAND bash -c "${DIFF_CMD}")
+        set_tests_properties(${diffTarget}_DIFF PROPERTIES DEPENDS ${exe_target}_SYN)
+
+        if (PARAM_BATCH OR SVC_BATCH)
+            # SV is written by _SYN and svc_batch_test() as well
+            set_tests_properties(${diffTarget}_DIFF PROPERTIES 
+                                 RESOURCE_LOCK ${exe_target_sctool})
+            # Batch run output is checked with the same golden
+            if (NOT PARAM_WILL_FAIL)
+                set_property(GLOBAL APPEND PROPERTY SVC_BATCH_DIFFS "${DIFF_CMD}")
+            endif()
+        endif()
+    endforeach()
+
+    # Target sources run with generated C++ model, the model header is 
+    # generated into sv_out folder by _SYN test, so the target is built in test
+    if (PARAM_MODEL_TEST)
+        set(exe_target_model ${exe_target}_model)
+        add_executable(${exe_target_model} EXCLUDE_FROM_ALL 
+                       ${targetSourcesListAbs}
+                       $ENV{ICSC_HOME}/include/sctcommon/sct_property.cpp)
+        target_link_libraries(${exe_target_model} PRIVATE ${targetLibraries})
+        target_include_directories(${exe_target_model} PRIVATE 
+                                   ${VERILOG_DIR} ${targetIncludeDir})
+        target_compile_definitions(${exe_target_model} PRIVATE 
+                                   SCT_MODEL_HEADER="${exe_target}_model.h")
+        if(targetDefinitions)
+            target_compile_definitions(${exe_target_model} PRIVATE 
+                                       ${targetDefinitions})
+        endif()
+
+        add_test(NAME ${exe_target}_MODEL_BUILD
+                 COMMAND "${CMAKE_COMMAND}" --build ${CMAKE_BINARY_DIR} 
+                 --target ${exe_target_model})
+        set_tests_properties(${exe_target}_MODEL_BUILD PROPERTIES 
+                             DEPENDS ${exe_target}_SYN)
+        add_test(NAME ${exe_target}_MODEL COMMAND ${exe_target_model})
+        set_tests_properties(${exe_target}_MODEL PROPERTIES 
+                             DEPENDS ${exe_target}_MODEL_BUILD)
     endif()
 
     # Add SCT_PROPERTY file 
@@ -243,3 +384,29 @@ function(svc_target exe_target)
                    $ENV{ICSC_HOME}/include/sctcommon/sct_property.cpp)
 
 endfunction()
+
+#! svc_batch_test : register test which runs all svc_target designs built with 
+#  BATCH option in one sctool_batch process, generated SV is compared with 
+#  golden files of the designs
+function(svc_batch_test test_name)
+
+    get_property(batchLibs GLOBAL PROPERTY SVC_BATCH_LIBS)
+    get_property(batchBuilds GLOBAL PROPERTY SVC_BATCH_BUILDS)
+    get_property(batchLocks GLOBAL PROPERTY SVC_BATCH_LOCKS)
+    get_property(batchDiffs GLOBAL PROPERTY SVC_BATCH_DIFFS)
+
+    if (batchLibs)
+        list(JOIN batchLibs " " BATCH_LIBS_STR)
+        set(BATCH_CMD "$<TARGET_FILE:SVC::sctool_batch> ${BATCH_LIBS_STR}")
+        foreach(diffCmd ${batchDiffs})
+            string(APPEND BATCH_CMD " && ${diffCmd}")
+        endforeach()
+
+        add_test(NAME ${test_name} COMMAND bash -c "${BATCH_CMD}")
+        # DEPENDS       -- waiting for all design libraries are built
+        # RESOURCE_LOCK -- not run together with design _SYN and _DIFF tests
+        set_tests_properties(${test_name} PROPERTIES DEPENDS "${batchBuilds}"
+                             RESOURCE_LOCK "${batchLocks}")
+    endif()
+
+endfunction()
@@ -210,13 +210,15 @@ void sct_assert_in_proc_func(bool lhs, bool rhs,\
 
 #else
 
+/// Property handle is cached in call site static variable
 #define SCT_ASSERT4_TH(LE, TIMES, RE, EVENT) {\
-                sct_property_storage::getProperty(\
+                static sct_property_cache sctPropCache;\
+                sct_property_storage::getPropertyCached(sctPropCache,\
                     [&]()->bool{return ( LE );},\
                     [&]()->bool{return ( RE );},\
                     &EVENT,\
                     [&]()->sct_time{return (sct_time(SCT_ARGS(TIMES)));},\
-                    std::string(__FILE__)+":"+std::to_string(__LINE__)\
+                    __FILE__, __LINE__\
                 );}
 
 /// Provide comma separated iteration variables to capture them by value
@@ -229,12 +231,13 @@ void sct_assert_in_proc_func(bool lhs, bool rhs,\
 
 /// Take variables by value, required for loop counter variable
 #define SCT_ASSERT_LOOPN(LE, TIMES, RE, EVENT, ...) {\
-                sct_property_storage::getProperty(\
+                static sct_property_cache sctPropCache;\
+                sct_property_storage::getPropertyCached(sctPropCache,\
                     [&, SCT_ITER_STR(__VA_ARGS__)]()->bool{return ( LE );},\
                     [&, SCT_ITER_STR(__VA_ARGS__)]()->bool{return ( RE );},\
                     &EVENT,\
                     [&]()->sct_time{return (sct_time(SCT_ARGS(TIMES)));},\
-                    std::string(__FILE__)+":"+std::to_string(__LINE__),\
+                    __FILE__, __LINE__,\
                     __VA_ARGS__\
                 );}
 #endif
@@ -10,6 +10,8 @@
  * 
  * Clock events can be disabled and enable by function call or by clock gate 
  * signals/ports bound. 
+ * Cycle accurate clock can be automatically stopped when all channels bound 
+ * to it are idle and resumed at new activity in any of the channels.
  * Approximate time implementation provides notification aligned with other 
  * channels events that allows to mix approximate time and cycle accurate modules.
  *    
@@ -28,7 +30,8 @@ namespace sct {
 /// Cycle accurate implementation
 template<>   
 class sct_clock<0> : 
-    public sc_clock
+    public sc_clock,
+    public sct_idle_clock_if
 {
   public:
     class sct_posedge_callback {
@@ -58,6 +61,14 @@ class sct_clock<0> :
         inline void operator () () {m_clock->control_action();}
     };
 
+    class sct_wakeup_callback {
+      protected:
+        sct_clock* m_clock;
+
+      public:
+        inline sct_wakeup_callback(sct_clock* m_clock_) : m_clock(m_clock_) {}
+        inline void operator () () {m_clock->wakeup_action();}
+    };
     
     inline sct_clock() : sc_clock() 
     {}
@@ -132,6 +143,23 @@ class sct_clock<0> :
         cg_enables.push_back(&enable);        
     }
     
+    /// Enable automatic idle suppression, should be called at elaboration 
+    /// phase. Posedge is skipped if all channels bound to the clock have been 
+    /// idle for @idle_cycles clock cycles, that stops the clock until any 
+    /// of the channels gets new activity. Clock is resumed at the next edge 
+    /// of the original period grid, so time of each edge is kept.
+    /// Processes sensitive to the clock should do nothing if there is
+    /// no activity in the channels, i.e. have no own counters or timeouts
+    void set_auto_idle(unsigned idle_cycles = 1) {
+        assert(idle_cycles > 0 && "At least one idle cycle required");
+        m_idle_cycles = idle_cycles;
+    }
+    
+    /// Used by channels bound to the clock
+    void register_idle(sct_idle_if* chan) override {
+        idle_chans.push_back(chan);
+    }
+    
   protected:    
     /// Clock is currently enabled 
     bool m_clock_enable = 1;
@@ -140,8 +168,35 @@ class sct_clock<0> :
     /// Clock gate signals/ports
     std::vector<sc_signal_inout_if<bool>*>  cg_enables;
     
+    /// Number of idle cycles to stop clock, 0 if idle suppression is off 
+    unsigned m_idle_cycles = 0;
+    /// Number of posedges with all channels idle 
+    unsigned m_idle_cntr = 0;
+    /// Clock is stopped by idle suppression
+    bool m_idle_stopped = 0;
+    /// Time of the first skipped posedge
+    sc_time m_idle_time;
+    /// Channels bound to the clock
+    std::vector<sct_idle_if*>  idle_chans;
+    
+    bool all_idle() const {
+        for (auto* chan : idle_chans) {
+            if (!chan->is_idle()) return false;
+        }
+        return true;
+    }
+    
     void posedge_action() {
         if (m_clock_enable) {
+            if (m_idle_cycles && !idle_chans.empty()) {
+                m_idle_cntr = all_idle() ? m_idle_cntr+1 : 0;
+                if (m_idle_cntr > m_idle_cycles) {
+                    //std::cout << sc_time_stamp() << " idle" << std::endl;
+                    m_idle_stopped = 1;
+                    m_idle_time = sc_time_stamp();
+                    return;
+                }
+            }
             //std::cout << sc_time_stamp() << " +" << std::endl;
             sc_clock::posedge_action();
         } else {
@@ -149,6 +204,20 @@ class sct_clock<0> :
         }
     }
     
+    /// Any activity in the channels resumes stopped clock at next posedge 
+    /// aligned to the clock period. Activity at a posedge time is caused by 
+    /// processes run after the timed delta cycle where the posedge would be, 
+    /// so this posedge is missed and the clock resumes one period later
+    void wakeup_action() {
+        m_idle_cntr = 0;
+        if (m_idle_stopped) {
+            m_idle_stopped = 0;
+            sc_time offset = (sc_time_stamp() - m_idle_time) % period();
+            //std::cout << sc_time_stamp() << " wakeup" << std::endl;
+            m_next_posedge_event.notify(period() - offset);
+        }
+    }
+    
     void negedge_action() {
         //std::cout << sc_time_stamp() << " -" << std::endl;
         sc_clock::negedge_action();
@@ -205,6 +274,23 @@ class sct_clock<0> :
                      sc_gen_unique_name(name_str.c_str()), &enable_options);
         }        
     }
+    
+    /// Channels register in the clock at end of elaboration, 
+    /// so wakeup process is created here
+    void start_of_simulation() override {
+        if (m_idle_cycles && !idle_chans.empty()) {
+            sc_spawn_options w_options; 
+            w_options.spawn_method();
+            w_options.dont_initialize();
+            for (auto* chan : idle_chans) {
+                chan->addToWakeup(w_options);
+            }
+
+            std::string name_str = basename() + std::string("_wakeup_action");
+            sc_spawn(sct_wakeup_callback(this),
+                     sc_gen_unique_name(name_str.c_str()), &w_options);
+        }
+    }
 };
 
 //==============================================================================
@@ -285,6 +371,10 @@ class sct_clock<1> :
         cg_enables.push_back(&enable);
     }
     
+    /// Idle suppression is not used in approximate time mode, 
+    /// the channels notify processes with their own events
+    void set_auto_idle(unsigned idle_cycles = 1) {}
+    
     const sc_time& period() const override {
         return m_period;
     }
@@ -33,7 +33,8 @@ template <
 >
 class sct_fifo<T, LENGTH, TRAITS, 0> : 
     public sc_module,
-    public sct_fifo_if<T>
+    public sct_fifo_if<T>,
+    public sct_idle_if
 {
    public:
     /// Assert @out_valid combinationally if false
@@ -74,6 +75,7 @@ class sct_fifo<T, LENGTH, TRAITS, 0> :
         sensitive << data_in << put_req << put_req_d << get_req << get_req_d 
                   << pop_indx << element_num_d;
         for (auto& i : buffer) sensitive << i;
+        race_free();
 
         SCT_CTHREAD(syncProc, clk, TRAITS::CLOCK);
         async_reset_signal_is(nrst, TRAITS::RESET);
@@ -381,6 +383,25 @@ public:
         PEEK.fifo = nullptr;
     }
     
+    void end_of_elaboration() override {
+        sct_register_idle(clk, this);
+    }
+    
+  public:
+    /// FIFO is empty, no push and no pop stored in the registers
+    bool is_idle() const override {
+        const bool push = cthread_put ? put_req != put_req_d : put_req;
+        return (!push && element_num_d.read() == 0 && 
+                element_num.read() == 0 && 
+                (!cthread_get || get_req == get_req_d));
+    }
+    
+    void addToWakeup(sc_spawn_options& opts) override {
+        opts.set_sensitivity(&put_req.value_changed_event());
+        opts.set_sensitivity(&get_req.value_changed_event());
+        opts.set_sensitivity(&nrst.value_changed_event());
+    }
+    
   public:
       
     template <typename RSTN_t>
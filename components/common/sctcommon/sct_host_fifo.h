@@ -0,0 +1,394 @@
+/******************************************************************************
+ * Copyright (c) 2023, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/*
+ * Single Source library. Host thread to SystemC FIFO channel.
+ *
+ * The channel is used to pass requests from host (non-SystemC) threads,
+ * like network model or ISS, to SystemC processes. Host threads put requests
+ * into bounded lock-free ring with host_put(), that is safe to be called from
+ * multiple threads. SystemC side drains the ring in update phase and provides
+ * requests through get interface same as sct_fifo. Put interface could be
+ * used by SystemC processes as well.
+ *
+ * The channel is not intended for synthesis, include it explicitly.
+ *
+ * Author: Mikhail Moiseev
+ */
+
+#ifndef SCT_HOST_FIFO_H
+#define SCT_HOST_FIFO_H
+
+#include "sct_static_log.h"
+#include "sct_ipc_if.h"
+#include <systemc.h>
+#include <atomic>
+#include <array>
+
+namespace sct {
+
+/// Host thread to SystemC FIFO, the same for cycle accurate and approximate
+/// time modes, except get process notification
+template <
+    typename T,             /// Data type
+    unsigned LENGTH,        /// Size (maximal number of elements)
+    class TRAITS = SCT_CMN_TRAITS, /// Clock edge and reset level traits
+    bool TLM_MODE = SCT_CMN_TLM_MODE
+>
+class sct_host_fifo :
+    public sc_prim_channel,
+    public sct_fifo_if<T>
+{
+  public:
+    static_assert (LENGTH > 0);
+    /// Ring size, power of two not less than @LENGTH
+    static const unsigned RING_SIZE = 1U << sct_addrbits1<LENGTH>;
+
+    explicit sct_host_fifo(const char* name) :
+        sc_prim_channel(name),
+        buffer(LENGTH, T{}),
+        put_event(std::string(std::string(name)+"_put_event").c_str()),
+        get_event(std::string(std::string(name)+"_get_event").c_str())
+    {
+        for (size_t i = 0; i != RING_SIZE; ++i) {
+            ring[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    sct_host_fifo(const sct_host_fifo&) = delete;
+    sct_host_fifo& operator = (const sct_host_fifo&) = delete;
+
+  protected:
+    /// Ring slot, @seq equal to put position means the slot is free,
+    /// equal to put position plus one means the slot is filled
+    struct Slot {
+        std::atomic<size_t> seq;
+        T                   data;
+    };
+
+    std::array<Slot, RING_SIZE> ring;
+    /// Next put position, shared between host threads
+    alignas(64) std::atomic<size_t> putPos{0};
+    /// Update request is pending, avoids request per element
+    alignas(64) std::atomic<bool> pending{false};
+    /// Next get position, accessed from SystemC side only
+    alignas(64) size_t getPos = 0;
+
+    /// SystemC side buffer filled from the ring in update phase
+    std::vector<T>  buffer;
+    unsigned        getIndx = 0;        // Index of element that will be get
+    unsigned        putIndx = 0;        // Index where element will be put
+    unsigned        elemNum = 0;        // Number of elements in buffer
+    T               lastData = T{};     // Last data returned by get
+
+    bool cthread_put = false;
+    bool cthread_get = false;
+
+    sc_in_clk*  clk_in = nullptr;
+    sc_time     clk_period = SC_ZERO_TIME;
+    sc_time     GET_TIME = SC_ZERO_TIME;
+
+    sc_event    put_event;
+    sc_event    get_event;
+
+    /// Put element into the ring, called from any thread
+    /// \return false if the ring is full
+    bool push(const T& data) {
+        size_t pos = putPos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &ring[pos & (RING_SIZE-1)];
+            size_t seq = slot->seq.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = (std::ptrdiff_t)seq - (std::ptrdiff_t)pos;
+            if (diff == 0) {
+                if (putPos.compare_exchange_weak(pos, pos+1,
+                                                 std::memory_order_relaxed)) {
+                    break;
+                }
+            } else
+            if (diff < 0) {
+                return false;
+            } else {
+                pos = putPos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->data = data;
+        slot->seq.store(pos+1, std::memory_order_release);
+        return true;
+    }
+
+    /// Ring has element filled at get position, SystemC side only
+    bool ringReady() const {
+        const Slot& slot = ring[getPos & (RING_SIZE-1)];
+        return (slot.seq.load(std::memory_order_acquire) == getPos+1);
+    }
+
+    /// Move all filled elements from the ring to the buffer while it has space
+    /// \return number of moved elements
+    unsigned drain() {
+        unsigned num = 0;
+        while (elemNum != LENGTH && ringReady()) {
+            Slot& slot = ring[getPos & (RING_SIZE-1)];
+            buffer[putIndx] = slot.data;
+            putIndx = (putIndx == LENGTH-1) ? 0 : putIndx+1;
+            elemNum++;
+            slot.seq.store(getPos + RING_SIZE, std::memory_order_release);
+            getPos++; num++;
+        }
+        return num;
+    }
+
+    void update() override {
+        // Clear the flag before draining, so host put after that requests
+        // next update
+        pending.exchange(false);
+        unsigned num = drain();
+
+        // Notify get process at empty to non-empty transition only
+        if (num != 0 && elemNum == num) get_event.notify(SC_ZERO_TIME);
+        // Notify put process in SystemC as ring slots are released
+        if (num != 0) put_event.notify(SC_ZERO_TIME);
+    }
+
+    void end_of_elaboration() override {
+        if (clk_in) {
+            clk_period = get_clk_period(clk_in);
+        }
+        // In cycle accurate mode get process takes next element next clock
+        // edge, in approximate time mode that is done for thread only
+        GET_TIME = (!TLM_MODE || cthread_get) ? clk_period : SC_ZERO_TIME;
+    }
+
+  public:
+    /// Put request from host thread, lock-free, could be called concurrently
+    /// from multiple threads
+    /// \return false if the ring is full, the request is not put
+    bool host_put(const T& data) {
+        if (!push(data)) return false;
+
+        // Only one update request is done for elements put before the update
+        if (!pending.exchange(true)) {
+            this->async_request_update();
+        }
+        return true;
+    }
+
+    /// Keep simulation suspended instead of finished while there is no events,
+    /// should be called before host threads start to put requests
+    bool host_attach() {
+        return this->async_attach_suspending();
+    }
+
+    /// Allow simulation to finish, should be called after last host put
+    bool host_detach() {
+        return this->async_detach_suspending();
+    }
+
+    bool ready() const override {
+        size_t pos = putPos.load(std::memory_order_relaxed);
+        const Slot& slot = ring[pos & (RING_SIZE-1)];
+        return (slot.seq.load(std::memory_order_acquire) == pos);
+    }
+
+    void reset_put() override {}
+
+    void clear_put() override {}
+
+    /// Put request from SystemC process
+    bool put(const T& data) override {
+        return put(data, 1);
+    }
+
+    bool put(const T& data, sc_uint<1> mask) override {
+        if (!mask) return ready();
+
+        if (!push(data)) return false;
+        this->request_update();
+        return true;
+    }
+
+    void b_put(const T& data) override {
+        while (!put(data)) wait();
+    }
+
+    bool request() const override {
+        return (elemNum != 0);
+    }
+
+    void reset_get() override {}
+
+    void clear_get() override {}
+
+    T peek() const override {
+        return (elemNum != 0 ? buffer[getIndx] : lastData);
+    }
+
+    T get() override {
+        if (elemNum == 0) return lastData;
+
+        lastData = buffer[getIndx];
+        getIndx = (getIndx == LENGTH-1) ? 0 : getIndx+1;
+        elemNum--;
+
+        // Notify itself to get next element
+        if (elemNum != 0) get_event.notify(GET_TIME);
+        // Take elements remaining in the ring as buffer slot is released
+        if (ringReady()) this->request_update();
+
+        return lastData;
+    }
+
+    bool get(T& data, bool enable = true) override {
+        data = peek();
+        if (elemNum == 0) return false;
+
+        if (enable) get();
+        return true;
+    }
+
+    T b_get() override {
+        while (!request()) wait();
+        return get();
+    }
+
+    unsigned size() const override {
+        return LENGTH;
+    }
+
+    unsigned elem_num() const override {
+        return elemNum;
+    }
+
+    bool almost_full(const unsigned& N = 0) const override {
+        assert (N <= LENGTH &&
+                "almost_full() parameter cannot be great than FIFO size");
+        return (elemNum >= LENGTH-N);
+    }
+
+    bool almost_empty(const unsigned& N = 0) const override {
+        assert (N <= LENGTH &&
+                "almost_empty() parameter cannot be great than FIFO size");
+        return (elemNum <= N);
+    }
+
+  public:
+    template <typename RSTN_t>
+    void clk_nrst(sc_in_clk& clk_in_, RSTN_t& nrst_in) {
+        clk_in = &clk_in_;
+    }
+
+    void clk_nrst(sc_in_clk& clk_in_, sc_in<bool>& nrst_in) override {
+        clk_in = &clk_in_;
+    }
+
+    /// Process kind is sensitive to channel events: METHOD in both modes,
+    /// THREAD in approximate time mode only, otherwise clock is used
+    static bool isEventSensitive(sc_curr_proc_kind procKind) {
+        return (procKind == SC_METHOD_PROC_ ||
+                (TLM_MODE && procKind == SC_THREAD_PROC_));
+    }
+
+    void addTo(sc_sensitive& s) override {
+        auto procKind = sc_get_current_process_handle().proc_kind();
+        cthread_put = procKind != SC_METHOD_PROC_;
+        cthread_get = cthread_put;
+
+        if (isEventSensitive(procKind)) {
+            s << put_event << get_event;
+        }
+    }
+
+    void addTo(sc_sensitive* s, sc_process_handle* p) override {
+        assert (false);
+    }
+
+    void addToPut(sc_sensitive& s) override {
+        auto procKind = sc_get_current_process_handle().proc_kind();
+        cthread_put = procKind != SC_METHOD_PROC_;
+
+        if (isEventSensitive(procKind)) {
+            s << put_event;
+        }
+    }
+
+    void addToPut(sc_sensitive* s, sc_process_handle* p) override {
+        auto procKind = p->proc_kind();
+        cthread_put = procKind != SC_METHOD_PROC_;
+
+        if (isEventSensitive(procKind)) {
+            *s << *p << put_event;
+        }
+    }
+
+    void addToGet(sc_sensitive& s) override {
+        auto procKind = sc_get_current_process_handle().proc_kind();
+        cthread_get = procKind != SC_METHOD_PROC_;
+
+        if (isEventSensitive(procKind)) {
+            s << get_event;
+        }
+    }
+
+    void addToGet(sc_sensitive* s, sc_process_handle* p) override {
+        auto procKind = p->proc_kind();
+        cthread_get = procKind != SC_METHOD_PROC_;
+
+        if (isEventSensitive(procKind)) {
+            *s << *p << get_event;
+        }
+    }
+
+    void addPeekTo(sc_sensitive& s) override {
+        auto procKind = sc_get_current_process_handle().proc_kind();
+
+        if (isEventSensitive(procKind)) {
+            s << get_event;
+        }
+    }
+
+    const sc_event& default_event() const override {
+        return get_event;
+    }
+
+    inline void print(::std::ostream& os) const override
+    {
+        os << "sct_host_fifo " << name();
+        if (elemNum != 0) {
+            os << " (";
+            for (unsigned i = 0; i != elemNum; ++i) {
+                os << buffer[(getIndx + i) % LENGTH] << " ";
+            }
+            os << ")";
+        } else {
+            os << " is empty";
+        }
+        os << ::std::endl;
+    }
+
+    const char* kind() const override {
+        return "sct_host_fifo";
+    }
+};
+
+} // namespace sct
+
+//==============================================================================
+
+namespace sc_core {
+
+template<class T, unsigned LENGTH, class TRAITS, bool TLM_MODE>
+sc_sensitive&
+operator << ( sc_sensitive& s,
+              sct::sct_host_fifo<T, LENGTH, TRAITS, TLM_MODE>& fifo )
+{
+    fifo.addTo(s);
+    return s;
+}
+
+} // namespace sc_core
+
+#endif /* SCT_HOST_FIFO_H */
@@ -30,7 +30,8 @@ namespace sct {
 template<class T, class TRAITS>
 class sct_initiator<T, TRAITS, 0> : 
     public sc_module,
-    public sct_put_if<T>
+    public sct_put_if<T>,
+    public sct_idle_if
 {
     friend class sct_target<T, TRAITS, 0>;
     
@@ -276,6 +277,27 @@ class sct_initiator<T, TRAITS, 0> :
             assert (false);
         }
     }
+    
+    void end_of_elaboration() override {
+        sct_register_idle(clk, this);
+    }
+    
+  public:
+    /// No request to target and no put request stored in the registers
+    bool is_idle() const override {
+        if (core_req || put_req != put_req_d || sync_req != sync_req_d) {
+            return false;
+        }
+        return (always_ready || (core_req_d == core_req && 
+                                 core_ready_d == core_ready));
+    }
+    
+    void addToWakeup(sc_spawn_options& opts) override {
+        opts.set_sensitivity(&put_req.value_changed_event());
+        opts.set_sensitivity(&sync_req.value_changed_event());
+        opts.set_sensitivity(&core_ready.value_changed_event());
+        opts.set_sensitivity(&nrst.value_changed_event());
+    }
 
   public:
     /// Get initiator instance, used for sc_port of initiator
@@ -448,9 +470,8 @@ class sct_initiator<T, TRAITS, 1> :
     
     /// May-block put, call in THREAD only
     void b_put(const T& data) override {
-        // Do not use fifo @b_put() as it is not provided
-        while (!put_port->ready()) wait();
-        put_port->put(data);
+        // Target FIFO considers batched mode
+        put_port->b_put(data);
     }
 
   public:
@@ -14,6 +14,7 @@
 #ifndef SCT_IPC_IF_H
 #define SCT_IPC_IF_H
 
+#include "sysc/kernel/sc_spawn.h"
 #include <systemc.h>
 
 namespace sct {
@@ -176,6 +177,32 @@ struct sct_clock_if : virtual public sc_interface
     virtual const sc_time& period() const = 0;
 };
 
+/// Cycle accurate channel which reports pending work to its clock,
+/// used for idle clock suppression
+struct sct_idle_if
+{
+    /// No request or data stored in the channel and its registers are stable,
+    /// so clock edges can be skipped without changing the channel state
+    virtual bool is_idle() const = 0;
+    /// Add events of new activity in the channel, used to resume clock
+    virtual void addToWakeup(sc_spawn_options& opts) = 0;
+};
+
+/// Clock with idle suppression, channels bound to the clock register in it
+struct sct_idle_clock_if
+{
+    virtual void register_idle(sct_idle_if* chan) = 0;
+};
+
+/// Register channel in clock bound to @clk_in if that supports idle
+/// suppression, should be called at end of elaboration
+inline void sct_register_idle(sc_in_clk& clk_in, sct_idle_if* chan)
+{
+    if (auto* clk = dynamic_cast<sct_idle_clock_if*>(clk_in.get_interface())) {
+        clk->register_idle(chan);
+    }
+}
+
 //==============================================================================
 
 /// Clock input which current process is sensitive to, set by @SCT_THREAD macro
@@ -10,6 +10,12 @@
  * 
  * Used as base channel in approximate time mode for Target, Initiator and FIFO.
  * 
+ * In batched mode (loosely timed) put and get operate on the buffer directly, 
+ * so multiple elements could be put/get in one process activation. Put/get 
+ * processes are notified at buffer empty/full transitions only, blocking put
+ * process synchronizes when buffer is full or its local time offset exceeds 
+ * the quantum.
+ * 
  * Author: Mikhail Moiseev
  */
 
@@ -110,6 +116,59 @@ class sct_prim_fifo :
     sc_event        put_event;
     sc_event        get_event;
     sc_event        update_event;
+    
+    bool            batch = false;      // Batched mode
+    sc_time         quantum = SC_ZERO_TIME; // Put process local time quantum 
+    sc_time         put_offset = SC_ZERO_TIME; // Put process local time offset
+    
+    /// Previous buffer index, used to get last data in batched mode 
+    inline unsigned prevIndx(unsigned indx) const {
+        return (indx == 0 ? fifoSize-1 : indx-1);
+    }
+    
+    /// Put element into buffer in batched mode
+    bool putBatch(const T& data) {
+        if (elemNum == fifoSize) return false;
+        
+        buffer[putIndx] = data;
+        putIndx = putIndx == fifoSize-1 ? 0 : putIndx+1;
+        elemNum++;
+        
+        // Notify get process at empty to non-empty transition only, 
+        // repeated notification in the same activation is ignored
+        if (elemNum == 1) get_event.notify(put_offset + GET_TIME);
+        // Notify put process itself to allow next put
+        if (elemNum != fifoSize) put_event.notify(PUT_TIME);
+        return true;
+    }
+    
+    /// Get element from buffer in batched mode
+    bool getBatch(T& data, bool enable) {
+        data = buffer[elemNum ? getIndx : prevIndx(getIndx)];
+        if (!enable || elemNum == 0) return false;
+        
+        getIndx = getIndx == fifoSize-1 ? 0 : getIndx+1;
+        elemNum--;
+        
+        // Notify put process at full to non-full transition only
+        if (elemNum == fifoSize-1) put_event.notify(PUT_TIME);
+        // Notify get process itself to allow next get
+        if (elemNum != 0) get_event.notify(GET_TIME);
+        return true;
+    }
+    
+    /// Synchronize put process with its local time offset
+    void syncPut() {
+        if (put_offset == SC_ZERO_TIME) return;
+        
+        if (sc_get_current_process_handle().proc_kind() == SC_CTHREAD_PROC_) {
+            int n = int(put_offset / clk_period);
+            wait(n > 0 ? n : 1);
+        } else {
+            wait(put_offset);
+        }
+        put_offset = SC_ZERO_TIME;
+    }
 
     /// Channel update, run at DC 0 
     void updateProc()
@@ -209,6 +268,18 @@ class sct_prim_fifo :
         //cout << sc_time_stamp() << " " << sc_delta_count() << " reset_core " << name()
         //     << " reset " << reset << " cthread " << cthread_put << cthread_get 
         //     << " sync " << sync_valid << sync_ready << endl;
+        if (batch) {
+            if (reset) {
+                getIndx = 0;
+                putIndx = 0;
+                elemNum = 0;
+                put_offset = SC_ZERO_TIME;
+                buffer[prevIndx(0)] = T{};
+            } else {
+                put_event.notify(PUT_TIME);
+                get_event.notify(GET_TIME);
+            }
+        } else 
         if (reset) {
             // Reset is active (reset entry), clear FIFO
             has_reset = !has_reset;
@@ -221,6 +292,8 @@ class sct_prim_fifo :
     }
     
     void reset_put() override {
+        // No put request signals in batched mode
+        if (batch) return;
         // Can be called in method process or in reset section of thread process
         // In method process that does initialization of @put_req/@put_data
         if (!cthread_put) {
@@ -237,6 +310,7 @@ class sct_prim_fifo :
     }
     
     void clear_put() override {
+        if (batch) return;
         put_req  = cthread_put ? put_req : put_req_d;
         put_data = T{};
 
@@ -250,6 +324,8 @@ class sct_prim_fifo :
     }
 
     void reset_get() override {
+        // No get request signals in batched mode
+        if (batch) return;
         // Can be called in method process or in reset section of thread process
         // In method process that does initialization of @get_req
         if (!cthread_get) get_req = get_req_d;
@@ -263,6 +339,7 @@ class sct_prim_fifo :
     }
     
     void clear_get() override {
+        if (batch) return;
         get_req = cthread_get ? get_req : get_req_d;
         
         // Clear get notifies put process if both are methods
@@ -275,7 +352,7 @@ class sct_prim_fifo :
     }
 
     bool ready() const override {
-        return putReady();
+        return (batch ? elemNum != fifoSize : putReady());
     }
     
     bool request() const override {
@@ -284,11 +361,13 @@ class sct_prim_fifo :
 //        cout << sc_time_stamp() << " " << sc_delta_count() << " request " << name()  
 //             << " " << outValid() << " element_num " << element_num
 //             << " put_req " << (put_req != put_req_d) << endl;
-        return outValid();
+        return (batch ? elemNum != 0 : outValid());
     }
     
     bool put(const T& data) override 
     {
+        if (batch) return putBatch(data);
+        
         if (putReady()) {
             put_req = cthread_put ? !put_req : !put_req_d;
             put_data = data;
@@ -315,6 +394,8 @@ class sct_prim_fifo :
 
     bool put(const T& data, sc_uint<1> mask) override 
     {
+        if (batch) return (mask && putBatch(data));
+        
         if (mask && putReady()) {
             put_req = cthread_put ? !put_req : !put_req_d;
             put_data = data;
@@ -337,11 +418,18 @@ class sct_prim_fifo :
     }
     
     T peek() const override {
+        if (batch) return buffer[elemNum ? getIndx : prevIndx(getIndx)];
         return getData();
     }
     
     T get() override 
     {
+        if (batch) {
+            T data; 
+            getBatch(data, true);
+            return data;
+        }
+        
         if (outValid()) {
             get_req = cthread_get ? !get_req : !get_req_d;
             update_event.notify(clk_period);
@@ -368,6 +456,8 @@ class sct_prim_fifo :
       
     bool get(T& data, bool enable = true) override 
     {
+        if (batch) return getBatch(data, enable);
+        
         data = getData();
         
         if (enable && outValid()) {
@@ -391,8 +481,22 @@ class sct_prim_fifo :
         return false;
     }
     
+    /// May-block put, call in THREAD only
     void b_put(const T& data) override {
-        assert (false);
+        if (batch) {
+            // Synchronize at buffer full to let get process run
+            if (elemNum == fifoSize) syncPut();
+            while (elemNum == fifoSize) wait();
+            putBatch(data);
+            
+            // Element put takes one clock period of local time
+            put_offset += clk_period;
+            if (quantum != SC_ZERO_TIME && put_offset >= quantum) syncPut();
+            
+        } else {
+            while (!putReady()) wait();
+            put(data);
+        }
     }
     
     T b_get() override {
@@ -407,6 +511,9 @@ class sct_prim_fifo :
             assert (false);
         }
         
+        if (batch) {
+            return elemNum;
+        } else 
         if (sct_is_method_proc()) {
             return element_num.read();
         } else {
@@ -455,6 +562,18 @@ class sct_prim_fifo :
         sync_ready = syncReady;
     }
     
+    /// Enable batched mode, should be called before simulation start
+    /// \param quantum_ -- put process local time quantum, if zero put process
+    ///                    synchronizes at buffer full only
+    void setBatch(const sc_time& quantum_) {
+        batch = true;
+        quantum = quantum_;
+    }
+    
+    bool isBatch() const {
+        return batch;
+    }
+    
   public:
     template <typename RSTN_t>
     void clk_nrst(sc_in_clk& clk_in_, RSTN_t& nrst_in)  {
@@ -541,9 +660,10 @@ class sct_prim_fifo :
     inline void print(::std::ostream& os) const override
     {
         os << "sct_prim_fifo " << name();
-        if (element_num.read() != 0) {
+        unsigned num = batch ? elemNum : element_num.read();
+        if (num != 0) {
             os << " (";
-            for (unsigned i = 0; i != element_num.read(); ++i) {
+            for (unsigned i = 0; i != num; ++i) {
                 os << buffer[i] << " ";
             }
             os << ")";
@@ -19,6 +19,7 @@
 #include "systemc.h"
 #include <unordered_map>
 #include <string>
+#include <array>
 
 namespace sct_property_utils {
 
@@ -83,8 +84,12 @@ private:
     size_t timeInt = 0;
     /// Antecedent (left) expression past values plus current value
     std::vector<bool> leftPast;
-    /// Consequent (right) expression past values plus current value
+    /// Consequent (right) expression past values plus current value, 
+    /// used for stable/rose/fell
     std::vector<RT> rightPast;
+    /// Number of cycles since consequent expression was true last time, 
+    /// used for time interval instead of storing past values
+    size_t rightTrueDist = 0;
     /// The oldest element indices, will be replaced at this cycle
     size_t lindx = 0;
     size_t rindx = 0;
@@ -114,6 +119,8 @@ protected:
         if (pastSize) {
             leftPast.resize(pastSize, 0);
         }
+        // No true consequent initially
+        rightTrueDist = 1;
         initalized = true;
     }
     
@@ -136,8 +143,9 @@ protected:
         } else 
         if (pastSize) {
             leftPast.resize(pastSize, 0);
-            if (timeInt) rightPast.resize(timeInt, 0);
         }
+        // No true consequent in the interval initially
+        rightTrueDist = timeInt+1;
         initalized = true;
     }
     
@@ -160,13 +168,9 @@ public:
         bool lcond = pastSize ? leftPast[lindx] : lexpr;
 
         if (lcond) {
-            // Get current right expression for single time
-            bool rcond = rexpr;
-
-            // Join all stored right expressions for time interval
-            for (size_t i = 0; i < timeInt; i++) {
-                rcond = rcond || rightPast[i];
-            }
+            // Current right expression or any of stored right expressions
+            // for time interval
+            bool rcond = rexpr || rightTrueDist <= timeInt;
 
             if (!rcond) {
                 std::cout << std::endl << sc_time_stamp() 
@@ -182,8 +186,12 @@ public:
             lindx = (lindx+1) % pastSize;
         }
         if (timeInt) {
-            rightPast[rindx] = rexpr;
-            rindx = (rindx+1) % timeInt;
+            if (rexpr) {
+                rightTrueDist = 1;
+            } else 
+            if (rightTrueDist <= timeInt) {
+                rightTrueDist++;
+            }
         }
     }    
     
@@ -280,6 +288,63 @@ struct function_traits<ReturnType(ClassType::*)() const>
 
 //=============================================================================
 
+/**
+ * Property handle cache for one call site in process body, avoids process 
+ * name and hash calculation at every call
+ */
+class sct_property_cache {
+public:
+    /// Maximal number of loop iteration variables
+    static const unsigned ITER_NUM = 4;
+    
+    /// Current process and loop iteration variable values
+    struct Key {
+        sc_process_b* proc;
+        std::array<uint64_t, ITER_NUM> iters;
+        
+        bool operator == (const Key& other) const {
+            return (proc == other.proc && iters == other.iters);
+        }
+    };
+    
+    struct KeyHash {
+        std::size_t operator () (const Key& key) const {
+            std::size_t hash = std::hash<sc_process_b*>()(key.proc);
+            for (uint64_t i : key.iters) {
+                hash ^= std::hash<uint64_t>()(i) + 0x9e3779b9 + 
+                        (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+    
+private:
+    /// Last used key and its property, most calls hit that
+    Key lastKey{nullptr, {}};
+    sct_property_base* lastProp = nullptr;
+    /// All properties created at the call site
+    std::unordered_map<Key, sct_property_base*, KeyHash> props;
+    
+public:
+    /// \return property for the key or nullptr
+    sct_property_base* find(const Key& key) {
+        if (lastProp && key == lastKey) return lastProp;
+        
+        auto i = props.find(key);
+        if (i == props.end()) return nullptr;
+        
+        lastKey = key; lastProp = i->second;
+        return lastProp;
+    }
+    
+    void add(const Key& key, sct_property_base* prop) {
+        props.emplace(key, prop);
+        lastKey = key; lastProp = prop;
+    }
+};
+
+//=============================================================================
+
 /**
  * Assertion property class storage
  */
@@ -335,6 +400,33 @@ public:
         return getProperty(lexpr, rexpr, event, times, propstr, stable);
     }
 
+    /// Get property from call site cache or create it, used in process scope
+    /// \param file, line -- call site, property string created at cache miss
+    template <class LEXPR, class REXPR, class EVENT, class TIMES, class... IterTypes>
+    static sct_property_base* getPropertyCached(sct_property_cache& cache,
+                                     LEXPR lexpr, REXPR rexpr, EVENT* event, 
+                                     TIMES times,
+                                     const char* file, int line,
+                                     IterTypes... iters
+                                     ) {
+        static_assert (sizeof...(IterTypes) <= sct_property_cache::ITER_NUM,
+                       "Too many iteration variables");
+        
+        sct_property_cache::Key key{sc_get_current_process_b(), 
+                                    {static_cast<uint64_t>(iters)...}};
+        if (auto prop = cache.find(key)) return prop;
+        
+        std::string propstr = std::string(file)+":"+std::to_string(line);
+        sct_property_base* prop;
+        if constexpr (sizeof...(IterTypes) == 0) {
+            prop = getProperty(lexpr, rexpr, event, times, propstr);
+        } else {
+            prop = getProperty(lexpr, rexpr, event, times, propstr, iters...);
+        }
+        cache.add(key, prop);
+        return prop;
+    }
+    
     template <class LEXPR, class REXPR, class EVENT, class TIMES>
     static sct_property_base* getProperty(LEXPR lexpr, REXPR rexpr, EVENT* event, 
                                      TIMES times, const std::string& propstr,
@@ -70,6 +70,7 @@ class sct_signal<T, 0> : public sc_signal<T>
 template <class T>
 class sct_signal<T, 1> : 
     public sc_prim_channel,
+    public sc_trace_source,
     public sct_inout_if<T>
 {
   public:
@@ -110,6 +111,8 @@ class sct_signal<T, 1> :
             // Notify thread and method processes
             if (methEvent) meth_event.notify(SC_ZERO_TIME);
             if (thrdEvent) thrd_event.notify(clk_period);
+            // Trace files check the value after it is changed only
+            if (m_trace_subscribers) notify_trace_subscribers();
         }
     }
     
@@ -203,6 +206,12 @@ class sct_signal<T, 1> :
         return meth_event; 
     }
     
+    /// Trace current value, it is checked by trace file after update only
+    void add_trace(sc_trace_file* tf, const std::string& name) const {
+        sc_trace_subscription subscription(tf, this);
+        sc_trace(tf, curr_val, name);
+    }
+
     inline void print(::std::ostream& os) const override {
         os << "sct_signal " << name() << " = " << curr_val << ::std::endl;
     }
@@ -225,6 +234,14 @@ namespace sc_core {
         signal.addTo(s);
         return s;
     }
+
+    template<class T>
+    inline void 
+    sc_trace( sc_trace_file* tf, const sct::sct_signal<T, 1>& signal, 
+              const std::string& name )
+    {
+        signal.add_trace(tf, name);
+    }
 } // namespace sc_core
 
 
@@ -30,7 +30,8 @@ namespace sct {
 template<class T, class TRAITS>
 class sct_target<T, TRAITS, 0> : 
     public sc_module, 
-    public sct_get_if<T>
+    public sct_get_if<T>,
+    public sct_idle_if
 {
     friend class sct_initiator<T, TRAITS, 0>;
     
@@ -322,6 +323,30 @@ class sct_target<T, TRAITS, 0> :
         PEEK.target = nullptr;
     }
     
+    void end_of_elaboration() override {
+        sct_register_idle(clk, this);
+    }
+    
+  public:
+    /// No request from initiator and no request stored in the registers,
+    /// FIFO bound registers itself in the clock
+    bool is_idle() const override {
+        if (core_req || get_req != get_req_d) return false;
+        if (always_ready) {
+            return (!sync || (core_req_d == core_req && 
+                              core_data_d.read() == core_data.read()));
+        } else {
+            return (!reg_full && reg_full_d == reg_full && 
+                    core_req_d == core_req);
+        }
+    }
+    
+    void addToWakeup(sc_spawn_options& opts) override {
+        opts.set_sensitivity(&core_req.value_changed_event());
+        opts.set_sensitivity(&get_req.value_changed_event());
+        opts.set_sensitivity(&nrst.value_changed_event());
+    }
+    
   public:
     template<unsigned LENGTH>
     void add_fifo(bool sync_valid = 0, bool sync_ready = 0,
@@ -507,6 +532,10 @@ class sct_target<T, TRAITS, 0> :
         }
     }
     
+    /// Batched mode is used in approximate time mode only
+    void set_batch(unsigned size, const sc_time& quantum = SC_ZERO_TIME) 
+    {}
+    
     sct_target_peek<T, TRAITS, false> PEEK{this};
 };
 
@@ -557,6 +586,8 @@ class sct_target<T, TRAITS, 1> :
       
     /// Attached FIFO length
     unsigned att_fifo_length = 0;
+    /// Buffer size in batched mode
+    unsigned batch_size = 0;
     
     /// Clear FIFO buffer
     void resetProc() {
@@ -577,6 +608,9 @@ class sct_target<T, TRAITS, 1> :
         
         // Consider attached FIFO length
         A += att_fifo_length;
+        
+        // Buffer for burst of requests 
+        if (batch_size > A) A = batch_size;
 
         // Minimum 2 slots required to have put&get at the same DC
         assert (A > 1 && "Primitive FIFO size should be at least 2");
@@ -642,6 +676,14 @@ class sct_target<T, TRAITS, 1> :
                   bool init_buffer = 0) {
         att_fifo_length = LENGTH;
     }
+    
+    /// Enable batched (loosely timed) mode, the bound initiator puts up to 
+    /// @size requests in one process activation, blocking put synchronizes 
+    /// when buffer is full or local time offset exceeds @quantum
+    void set_batch(unsigned size, const sc_time& quantum = SC_ZERO_TIME) {
+        batch_size = size;
+        fifo.setBatch(quantum);
+    }
 
     /// Get target instance, used for sc_port of target
     sct_target<T, TRAITS, 1>& get_instance() {
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright (c) 2023, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+#include "sct_assert.h"
+#include "systemc.h"
+
+// Assertion violation test, built with NDEBUG to continue simulation after
+// violation and check it is reported, one violated assertion per variant
+class A : public sc_module
+{
+public:
+
+    sc_in<bool>         clk{"clk"};
+    sc_in<bool>         rstn{"rstn"};
+
+    sc_signal<bool>     s{"s"};
+    sc_signal<bool>     s_d{"s_d"};
+    sc_signal<unsigned> cntr{"cntr"};
+
+    SC_HAS_PROCESS(A);
+
+    explicit A(const sc_module_name& name) : sc_module(name)
+    {
+        SC_CTHREAD(test_thread, clk.pos());
+        async_reset_signal_is(rstn, false);
+
+        SC_CTHREAD(assert_thread, clk.pos());
+        async_reset_signal_is(rstn, false);
+    }
+
+    // @s and @s_d differ at @cntr 5 and 6 only
+#ifdef ZERO_TIME
+    SCT_ASSERT(cntr.read() == 5, SCT_TIME(0), s.read() == s_d.read(), clk.pos());
+#endif
+#ifdef ONE_TIME
+    SCT_ASSERT(cntr.read() == 4, SCT_TIME(1), s.read() == s_d.read(), clk.pos());
+#endif
+#ifdef TIME_INTERVAL
+    SCT_ASSERT(cntr.read() == 2, SCT_TIME(1,2), s.read() == !s_d.read(), clk.pos());
+#endif
+
+    void test_thread()
+    {
+        s = 0; s_d = 0; cntr = 0;
+        wait();
+
+        while (true) {
+            s = cntr.read() == 4;
+            s_d = s;
+            cntr = cntr.read() + 1;
+            wait();
+        }
+    }
+
+    void assert_thread()
+    {
+#ifdef THREAD_ZERO_TIME
+        SCT_ASSERT_THREAD(cntr.read() == 5, SCT_TIME(0),
+                          s.read() == s_d.read(), clk.pos());
+#endif
+        wait();
+
+        while (true) {
+            wait();
+        }
+    }
+};
+
+class Test_top : public sc_module
+{
+public:
+    sc_signal<bool>        rstn{"rstn"};
+    sc_clock clk{"clock", 10, SC_NS};
+
+    A a_mod{"a_mod"};
+
+    SC_CTOR(Test_top) {
+        a_mod.clk(clk);
+        a_mod.rstn(rstn);
+        SC_CTHREAD(resetProc, clk);
+    }
+
+    void resetProc() {
+        rstn = 0;
+        wait(2);
+        rstn = 1;
+        wait(20);
+        sc_stop();
+    }
+};
+
+int sc_main(int argc, char* argv[])
+{
+    Test_top test_top{"test_top"};
+    sc_start();
+    return 0;
+}
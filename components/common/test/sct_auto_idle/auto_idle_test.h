@@ -0,0 +1,111 @@
+/******************************************************************************
+ * Copyright (c) 2023, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/* 
+ * Automatic idle suppression test. FIFO clocked by clock with idle 
+ * suppression and same FIFO clocked by normal clock are filled by producer 
+ * clocked by third clock with the same period, requests are taken at the same 
+ * time in both FIFOs.
+ */
+
+#ifndef AUTO_IDLE_TEST_H
+#define AUTO_IDLE_TEST_H
+
+#include "sct_common.h"
+#include <systemc.h>
+
+class auto_idle_test : public sc_module 
+{
+public:
+    static const unsigned N = 20;
+
+    sc_in<bool>         clk_idle{"clk_idle"};
+    sc_in<bool>         clk_base{"clk_base"};
+    sc_in<bool>         clk_prod{"clk_prod"};
+    sc_in<bool>         nrst{"nrst"};
+
+    sct_fifo<unsigned, 2> fifo_idle{"fifo_idle"};
+    sct_fifo<unsigned, 2> fifo_base{"fifo_base"};
+    
+    std::vector<std::pair<sc_time, unsigned>> gets_idle;
+    std::vector<std::pair<sc_time, unsigned>> gets_base;
+
+    SC_HAS_PROCESS(auto_idle_test);
+    
+    explicit auto_idle_test(const sc_module_name& name) : sc_module(name) 
+    {
+        fifo_idle.clk_nrst(clk_idle, nrst);
+        fifo_base.clk_nrst(clk_base, nrst);
+        
+        SCT_THREAD(putProc, clk_prod, nrst);
+        sensitive << fifo_idle.PUT << fifo_base.PUT;
+        async_reset_signal_is(nrst, SCT_CMN_TRAITS::RESET);
+
+        SCT_THREAD(getIdleProc, clk_idle, nrst);
+        sensitive << fifo_idle.GET;
+        async_reset_signal_is(nrst, SCT_CMN_TRAITS::RESET);
+
+        SCT_THREAD(getBaseProc, clk_base, nrst);
+        sensitive << fifo_base.GET;
+        async_reset_signal_is(nrst, SCT_CMN_TRAITS::RESET);
+    }
+    
+    // Put requests with pauses long enough to stop the idle clock, 
+    // both FIFOs are put at the same time 
+    void putProc() {
+        fifo_idle.reset_put();
+        fifo_base.reset_put();
+        wait();
+        
+        for (unsigned i = 0; i != N; ++i) {
+            for (unsigned k = 0; k != 3 + i % 4; ++k) wait();
+            fifo_idle.put(i);
+            fifo_base.put(i);
+            wait();
+        }
+        wait(10);
+        check();
+    }
+
+    void getIdleProc() {
+        fifo_idle.reset_get();
+        wait();
+        
+        while (true) {
+            unsigned data = fifo_idle.b_get();
+            gets_idle.emplace_back(sc_time_stamp(), data);
+            wait();
+        }
+    }
+    
+    void getBaseProc() {
+        fifo_base.reset_get();
+        wait();
+        
+        while (true) {
+            unsigned data = fifo_base.b_get();
+            gets_base.emplace_back(sc_time_stamp(), data);
+            wait();
+        }
+    }
+
+    // Requests taken at the same time with and without idle suppression 
+    void check() {
+        sc_assert (gets_base.size() == N);
+        sc_assert (gets_idle.size() == N);
+        for (unsigned i = 0; i != N; ++i) {
+            if (gets_idle[i] != gets_base[i]) {
+                cout << "Request " << i << " taken at " << gets_idle[i].first
+                     << " instead of " << gets_base[i].first << endl;
+            }
+            sc_assert (gets_idle[i] == gets_base[i]);
+        }
+        sc_stop();
+    }
+};
+
+#endif /* AUTO_IDLE_TEST_H */
@@ -0,0 +1,55 @@
+/******************************************************************************
+ * Copyright (c) 2023, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+#include "auto_idle_test.h"
+#include <systemc.h>
+
+class Test_top : public sc_module
+{
+public:
+    sc_in_clk           clk_idle{"clk_idle"};
+    sc_in_clk           clk_base{"clk_base"};
+    sc_in_clk           clk_prod{"clk_prod"};
+    sc_signal<bool>     nrst{"nrst"};
+
+    auto_idle_test dut{"dut"};
+
+    SC_CTOR(Test_top) {
+        dut.clk_idle(clk_idle);
+        dut.clk_base(clk_base);
+        dut.clk_prod(clk_prod);
+        dut.nrst(nrst);
+
+        SC_THREAD(resetProc);
+    }
+
+    void resetProc() {
+        nrst = SCT_CMN_TRAITS::RESET;
+        wait(25, SC_NS);
+        nrst = !SCT_CMN_TRAITS::RESET;
+    }
+};
+
+int sc_main(int argc, char* argv[])
+{
+    sct_clock<> clk_idle{"clk_idle", 10, SC_NS};
+    sct_clock<> clk_base{"clk_base", 10, SC_NS};
+    sct_clock<> clk_prod{"clk_prod", 10, SC_NS};
+    clk_idle.set_auto_idle(1);
+    
+    Test_top test_top{"test_top"};
+    test_top.clk_idle(clk_idle);
+    test_top.clk_base(clk_base);
+    test_top.clk_prod(clk_prod);
+    sc_start();
+    
+    cout << endl;
+    cout << "--------------------------------" << endl;
+    cout << "|       Test passed OK         |" << endl;
+    cout << "--------------------------------" << endl;
+    return 0;
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Copyright (c) 2023, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/*
+ * Blocking put/get through initiator/target in approximate time mode,
+ * with @BATCH target buffer works in batched (loosely timed) mode.
+ * Number of delta cycles and simulation time per request reported.
+ */
+
+#ifndef BATCH_TEST_H
+#define BATCH_TEST_H
+
+#include "sct_common.h"
+#include <systemc.h>
+#include <chrono>
+
+class batch_test : public sc_module 
+{
+public:
+    using T = sc_uint<32>;
+
+    sc_in<bool>         clk{"clk"};
+    sc_in<bool>         nrst{"nrst"};
+
+    sct_initiator<T>    init{"init"};
+    sct_target<T>       targ{"targ"};
+    
+    /// Number of requests and burst size in batched mode
+    static const unsigned N = 100000;
+    static const unsigned BURST = 32;
+
+    SC_HAS_PROCESS(batch_test);
+
+    explicit batch_test(const sc_module_name& name) : sc_module(name)
+    {
+        init.clk_nrst(clk, nrst);
+        targ.clk_nrst(clk, nrst);
+        targ.bind(init);
+    #ifdef BATCH
+        targ.set_batch(BURST, BURST * sc_time(1, SC_NS));
+    #endif
+        
+        SC_THREAD(putProc);
+        sensitive << init;
+        async_reset_signal_is(nrst, 0);
+
+        SC_THREAD(getProc);
+        sensitive << targ;
+        async_reset_signal_is(nrst, 0);
+    }
+    
+    void putProc() {
+        init.reset_put();
+        wait();
+        
+        for (unsigned i = 0; i != N; ++i) {
+            init.b_put(i);
+        #ifndef BATCH
+            wait();
+        #endif
+        }
+        
+        while (true) wait();
+    }
+    
+    void getProc() {
+        targ.reset_get();
+        wait();
+        
+        auto start = std::chrono::steady_clock::now();
+        sc_dt::uint64 startDelta = sc_delta_count();
+        sc_time startTime = sc_time_stamp();
+        
+        for (unsigned i = 0; i != N; ++i) {
+            T data = targ.b_get();
+            if (data != i) {
+                cout << "Incorrect data " << data << " expected " << i << endl;
+                assert (false);
+            }
+        #ifndef BATCH
+            wait();
+        #endif
+        }
+        
+        auto finish = std::chrono::steady_clock::now();
+        double deltas = double(sc_delta_count() - startDelta);
+        cout << (targ.request() ? "Extra request in target" : "") << endl;
+        cout << "Requests             : " << N << endl;
+        cout << "Delta cycles/request : " << deltas/N << endl;
+        cout << "Sim time/request     : " << (sc_time_stamp()-startTime)/N << endl;
+        cout << "Wall time            : " << std::chrono::duration<double, 
+                std::milli>(finish-start).count() << " ms" << endl;
+        
+        sc_stop();
+    }
+};
+
+#endif /* BATCH_TEST_H */
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright (c) 2023, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/* 
+ * Host thread to SystemC FIFO test. Multiple host threads put requests,
+ * they are taken in METHOD or THREAD process.
+ */
+
+#ifndef HOST_FIFO_TEST_H
+#define HOST_FIFO_TEST_H
+
+#include "sct_common.h"
+#include "sct_host_fifo.h"
+#include <systemc.h>
+#include <thread>
+
+class host_fifo_test : public sc_module 
+{
+public:
+    static const unsigned N = 10000;       // Requests per host thread
+    static const unsigned THREAD_NUM = 2;
+
+    sc_in<bool>         clk{"clk"};
+    sc_in<bool>         nrst{"nrst"};
+
+    // Host thread index in high bits, request number in low bits
+    sct_host_fifo<sc_uint<32>, 4> fifo{"fifo"};
+    
+    std::vector<std::thread> hosts;
+    unsigned counts[THREAD_NUM] = {};
+    unsigned total = 0;
+
+    SC_HAS_PROCESS(host_fifo_test);
+    
+    explicit host_fifo_test(const sc_module_name& name) : sc_module(name) 
+    {
+        fifo.clk_nrst(clk, nrst);
+        
+    #ifdef METHOD
+        SC_METHOD(getMethProc);
+        sensitive << fifo;
+    #else
+        SCT_THREAD(getThreadProc, clk, nrst);
+        sensitive << fifo;
+        async_reset_signal_is(nrst, SCT_CMN_TRAITS::RESET);
+    #endif
+    }
+    
+    void start_of_simulation() override {
+        fifo.host_attach();
+        for (unsigned t = 0; t != THREAD_NUM; ++t) {
+            hosts.emplace_back([this, t]() {
+                for (unsigned i = 0; i != N; ++i) {
+                    while (!fifo.host_put((t << 16) | i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+    
+    void end_of_simulation() override {
+        for (auto& h : hosts) h.join();
+    }
+    
+    // Check request order for each host thread
+    void check(const sc_uint<32>& data) {
+        unsigned t = data >> 16;
+        unsigned i = data & 0xFFFF;
+        sc_assert (t < THREAD_NUM && i == counts[t]);
+        counts[t]++;
+        
+        if (++total == N * THREAD_NUM) {
+            cout << sc_time_stamp() << " all " << total << " requests taken" << endl;
+            fifo.host_detach();
+            sc_stop();
+        }
+    }
+    
+    void getMethProc() {
+        fifo.reset_get();
+        sc_uint<32> data;
+        if (fifo.get(data)) {
+            check(data);
+        }
+    }
+    
+    void getThreadProc() {
+        fifo.reset_get();
+        wait();
+        
+        while (true) {
+            check(fifo.b_get());
+            wait();
+        }
+    }
+};
+
+#endif /* HOST_FIFO_TEST_H */
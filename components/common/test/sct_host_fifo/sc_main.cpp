@@ -0,0 +1,45 @@
+/******************************************************************************
+ * Copyright (c) 2023, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+#include "host_fifo_test.h"
+#include <systemc.h>
+
+class Test_top : public sc_module
+{
+public:
+    sc_in_clk           clk{"clk"};
+    sc_signal<bool>     nrst{"nrst"};
+
+    host_fifo_test dut{"dut"};
+
+    SC_CTOR(Test_top) {
+        dut.clk(clk);
+        dut.nrst(nrst);
+
+        SC_THREAD(resetProc);
+    }
+
+    void resetProc() {
+        nrst = SCT_CMN_TRAITS::RESET;
+        wait(1, SC_NS);
+        nrst = !SCT_CMN_TRAITS::RESET;
+    }
+};
+
+int sc_main(int argc, char* argv[])
+{
+    sct_clock<> clk{"clk", 1, SC_NS};
+    Test_top test_top{"test_top"};
+    test_top.clk(clk);
+    sc_start();
+    
+    cout << endl;
+    cout << "--------------------------------" << endl;
+    cout << "|       Test passed OK         |" << endl;
+    cout << "--------------------------------" << endl;
+    return 0;
+}
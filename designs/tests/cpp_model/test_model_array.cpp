@@ -0,0 +1,136 @@
+/******************************************************************************
+* Copyright (c) 2020, Intel Corporation. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+*
+*****************************************************************************/
+
+#include <systemc.h>
+
+// Cycle-based C++ model compared with SystemC simulation of the same design,
+// register array, wide variables and synchronous reset
+
+SC_MODULE(Dut) {
+    static const unsigned N = 4;
+
+    sc_in_clk               clk{"clk"};
+    sc_in<bool>             rst{"rst"};
+    sc_in<bool>             we{"we"};
+    sc_in<sc_uint<2>>       waddr{"waddr"};
+    sc_in<sc_uint<2>>       raddr{"raddr"};
+    sc_in<sc_biguint<80>>   wdata{"wdata"};
+    sc_out<sc_biguint<80>>  rdata{"rdata"};
+    sc_out<sc_uint<16>>     total{"total"};
+
+    sc_signal<sc_biguint<80>> mem[N];
+
+    SC_CTOR(Dut) {
+        SC_METHOD(readProc);
+        sensitive << raddr;
+        for (unsigned i = 0; i < N; ++i) sensitive << mem[i];
+
+        SC_CTHREAD(writeProc, clk.pos());
+        reset_signal_is(rst, 1);
+    }
+
+    void readProc() {
+        rdata = mem[raddr.read()].read();
+    }
+
+    void writeProc() {
+        for (unsigned i = 0; i < N; ++i) {
+            mem[i] = 0;
+        }
+        total = 0;
+        wait();
+
+        while (true) {
+            if (we.read()) {
+                sc_biguint<80> d = wdata.read();
+                mem[waddr.read()] = d;
+                total = total.read() + (sc_uint<16>)d.range(79, 64);
+            }
+            wait();
+        }
+    }
+};
+
+SC_MODULE(tb) {
+    Dut dut{"dut"};
+
+    sc_signal<bool>             clk{"clk"};
+    sc_signal<bool>             rst{"rst"};
+    sc_signal<bool>             we{"we"};
+    sc_signal<sc_uint<2>>       waddr{"waddr"};
+    sc_signal<sc_uint<2>>       raddr{"raddr"};
+    sc_signal<sc_biguint<80>>   wdata{"wdata"};
+    sc_signal<sc_biguint<80>>   rdata{"rdata"};
+    sc_signal<sc_uint<16>>      total{"total"};
+
+    SC_CTOR(tb) {
+        dut.clk(clk);
+        dut.rst(rst);
+        dut.we(we);
+        dut.waddr(waddr);
+        dut.raddr(raddr);
+        dut.wdata(wdata);
+        dut.rdata(rdata);
+        dut.total(total);
+    }
+};
+
+#ifdef SCT_MODEL_HEADER
+#include SCT_MODEL_HEADER
+
+// Compare model outputs with the design outputs
+bool check(tb& t, const Dut_model& m, unsigned cycle)
+{
+    if (t.rdata.read() != m.rdata || t.total.read() != m.total) {
+        cout << "Cycle " << cycle << " design " << t.rdata.read() << " "
+             << t.total.read() << ", model " << m.rdata << " "
+             << unsigned(m.total) << endl;
+        return false;
+    }
+    return true;
+}
+#endif
+
+int sc_main(int argc, char **argv) {
+
+    tb tb_inst{"tb_inst"};
+
+#ifdef SCT_MODEL_HEADER
+    Dut_model m;
+    unsigned errors = 0;
+
+    for (unsigned i = 0; i < 200; ++i) {
+        bool rst = i < 2 || i == 120;
+        bool we = (i % 3) != 0;
+        unsigned waddr = (i * 7) % 4;
+        unsigned raddr = (i * 5 + 1) % 4;
+        sc_biguint<80> wdata = i * 12345 + 7;
+        wdata = (wdata << 61) + i;
+
+        tb_inst.rst = rst; m.rst = rst;
+        tb_inst.we = we; m.we = we;
+        tb_inst.waddr = waddr; m.waddr = waddr;
+        tb_inst.raddr = raddr; m.raddr = raddr;
+        tb_inst.wdata = wdata; m.wdata = wdata;
+        tb_inst.clk = 0;
+        sc_start(5, SC_NS);
+        m.eval();
+        errors += !check(tb_inst, m, i);
+
+        tb_inst.clk = 1;
+        sc_start(5, SC_NS);
+        m.clock();
+        errors += !check(tb_inst, m, i);
+    }
+
+    cout << "Model errors " << errors << endl;
+    return errors != 0;
+#else
+    sc_start();
+    return 0;
+#endif
+}
@@ -0,0 +1,188 @@
+/******************************************************************************
+* Copyright (c) 2020, Intel Corporation. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+*
+*****************************************************************************/
+
+#include <systemc.h>
+
+// SystemC module generated with C++ model, which runs CTHREADs as SC_METHODs,
+// compared with SystemC simulation of the same design, three CTHREADs with
+// asynchronous reset asserted between clock edges
+
+SC_MODULE(Dut) {
+    sc_in_clk               clk{"clk"};
+    sc_in<bool>             nrst{"nrst"};
+    sc_in<sc_uint<8>>       a{"a"};
+    sc_in<sc_uint<8>>       b{"b"};
+    sc_out<sc_uint<9>>      sum{"sum"};
+    sc_out<sc_uint<16>>     cnt{"cnt"};
+    sc_out<sc_uint<16>>     dly{"dly"};
+    sc_out<sc_uint<16>>     acc{"acc"};
+
+    sc_signal<sc_uint<9>>   s{"s"};
+    sc_signal<sc_uint<16>>  c{"c"};
+
+    SC_CTOR(Dut) {
+        SC_METHOD(sumProc);
+        sensitive << a << b;
+
+        SC_CTHREAD(cntProc, clk.pos());
+        async_reset_signal_is(nrst, 0);
+
+        SC_CTHREAD(dlyProc, clk.pos());
+        async_reset_signal_is(nrst, 0);
+
+        SC_CTHREAD(accProc, clk.pos());
+        async_reset_signal_is(nrst, 0);
+    }
+
+    void sumProc() {
+        sc_uint<9> res = a.read() + b.read();
+        s = res;
+        sum = res;
+    }
+
+    // Counter with several states
+    void cntProc() {
+        c = 0;
+        cnt = 0;
+        wait();
+
+        while (true) {
+            c = c.read() + s.read();
+            cnt = c.read();
+            wait();
+
+            if (a.read() > b.read()) {
+                c = c.read() - b.read();
+            }
+            wait();
+        }
+    }
+
+    // Counter register of another thread read
+    void dlyProc() {
+        dly = 0;
+        wait();
+
+        while (true) {
+            dly = c.read() + 1;
+            wait();
+        }
+    }
+
+    // Accumulator with thread-local register and multi-cycle wait
+    void accProc() {
+        sc_uint<16> v = 0;
+        acc = 0;
+        wait();
+
+        while (true) {
+            v = v + a.read();
+            acc = v;
+            wait(2);
+        }
+    }
+};
+
+#ifdef SCT_MODEL_HEADER
+#include SCT_MODEL_HEADER
+#endif
+
+SC_MODULE(tb) {
+    sc_clock                clk{"clk", 10, SC_NS};
+    Dut dut{"dut"};
+
+    sc_signal<bool>         nrst{"nrst"};
+    sc_signal<sc_uint<8>>   a{"a"};
+    sc_signal<sc_uint<8>>   b{"b"};
+    sc_signal<sc_uint<9>>   sum{"sum"};
+    sc_signal<sc_uint<16>>  cnt{"cnt"};
+    sc_signal<sc_uint<16>>  dly{"dly"};
+    sc_signal<sc_uint<16>>  acc{"acc"};
+
+#ifdef SCT_MODEL_HEADER
+    Dut_sc dut_sc{"dut_sc"};
+
+    sc_signal<sc_uint<9>>   sc_sum{"sc_sum"};
+    sc_signal<sc_uint<16>>  sc_cnt{"sc_cnt"};
+    sc_signal<sc_uint<16>>  sc_dly{"sc_dly"};
+    sc_signal<sc_uint<16>>  sc_acc{"sc_acc"};
+#endif
+
+    unsigned errors = 0;
+
+    SC_CTOR(tb) {
+        dut.clk(clk);
+        dut.nrst(nrst);
+        dut.a(a);
+        dut.b(b);
+        dut.sum(sum);
+        dut.cnt(cnt);
+        dut.dly(dly);
+        dut.acc(acc);
+
+#ifdef SCT_MODEL_HEADER
+        dut_sc.clk(clk);
+        dut_sc.nrst(nrst);
+        dut_sc.a(a);
+        dut_sc.b(b);
+        dut_sc.sum(sc_sum);
+        dut_sc.cnt(sc_cnt);
+        dut_sc.dly(sc_dly);
+        dut_sc.acc(sc_acc);
+#endif
+        SC_THREAD(driveProc);
+    }
+
+    // Compare SystemC module with the model outputs with the design outputs
+    void check(unsigned cycle) {
+#ifdef SCT_MODEL_HEADER
+        if (sum.read() != sc_sum.read() || cnt.read() != sc_cnt.read() ||
+            dly.read() != sc_dly.read() || acc.read() != sc_acc.read()) {
+            cout << "Cycle " << cycle << " design " << sum.read() << " "
+                 << cnt.read() << " " << dly.read() << " " << acc.read()
+                 << ", model " << sc_sum.read() << " " << sc_cnt.read() << " "
+                 << sc_dly.read() << " " << sc_acc.read() << endl;
+            errors++;
+        }
+#endif
+    }
+
+    // Inputs changed after clock posedge, reset changed separately from
+    // other inputs, outputs checked before and after the next posedge
+    void driveProc() {
+        wait(2, SC_NS);
+        for (unsigned i = 0; i < 200; ++i) {
+            a = (i * 37 + 11) % 256;
+            b = (i * 91 + 5) % 256;
+            wait(2, SC_NS);
+            check(i);
+
+            // Reset in first cycles and in the middle between clock edges
+            nrst = !(i < 2 || i == 100);
+            wait(2, SC_NS);
+            check(i);
+
+            wait(5, SC_NS);
+            check(i);
+            wait(1, SC_NS);
+        }
+        sc_stop();
+    }
+};
+
+int sc_main(int argc, char **argv) {
+
+    tb tb_inst{"tb_inst"};
+    sc_start();
+
+#ifdef SCT_MODEL_HEADER
+    cout << "Model errors " << tb_inst.errors << endl;
+    return tb_inst.errors != 0;
+#else
+    return 0;
+#endif
+}
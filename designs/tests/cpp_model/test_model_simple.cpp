@@ -0,0 +1,132 @@
+/******************************************************************************
+* Copyright (c) 2020, Intel Corporation. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+*
+*****************************************************************************/
+
+#include <systemc.h>
+
+// Cycle-based C++ model compared with SystemC simulation of the same design,
+// method process and multi-state CTHREAD with asynchronous reset
+
+SC_MODULE(Dut) {
+    sc_in_clk               clk{"clk"};
+    sc_in<bool>             nrst{"nrst"};
+    sc_in<sc_uint<8>>       a{"a"};
+    sc_in<sc_uint<8>>       b{"b"};
+    sc_out<sc_uint<9>>      sum{"sum"};
+    sc_out<sc_uint<16>>     acc{"acc"};
+    sc_out<bool>            odd{"odd"};
+
+    sc_signal<sc_uint<9>>   s{"s"};
+
+    SC_CTOR(Dut) {
+        SC_METHOD(sumProc);
+        sensitive << a << b;
+
+        SC_CTHREAD(accProc, clk.pos());
+        async_reset_signal_is(nrst, 0);
+    }
+
+    void sumProc() {
+        sc_uint<9> res = a.read() + b.read();
+        s = res;
+        sum = res;
+    }
+
+    void accProc() {
+        sc_uint<16> v = 0;
+        acc = 0;
+        odd = 0;
+        wait();
+
+        while (true) {
+            v += s.read();
+            acc = v;
+            wait();
+
+            if (a.read() > b.read()) {
+                v = v - b.read();
+            }
+            odd = v.bit(0);
+            wait();
+        }
+    }
+};
+
+SC_MODULE(tb) {
+    Dut dut{"dut"};
+
+    sc_signal<bool>         clk{"clk"};
+    sc_signal<bool>         nrst{"nrst"};
+    sc_signal<sc_uint<8>>   a{"a"};
+    sc_signal<sc_uint<8>>   b{"b"};
+    sc_signal<sc_uint<9>>   sum{"sum"};
+    sc_signal<sc_uint<16>>  acc{"acc"};
+    sc_signal<bool>         odd{"odd"};
+
+    SC_CTOR(tb) {
+        dut.clk(clk);
+        dut.nrst(nrst);
+        dut.a(a);
+        dut.b(b);
+        dut.sum(sum);
+        dut.acc(acc);
+        dut.odd(odd);
+    }
+};
+
+#ifdef SCT_MODEL_HEADER
+#include SCT_MODEL_HEADER
+
+// Compare model outputs with the design outputs
+bool check(tb& t, const Dut_model& m, unsigned cycle)
+{
+    if (t.sum.read() != m.sum || t.acc.read() != m.acc ||
+        t.odd.read() != bool(m.odd)) {
+        cout << "Cycle " << cycle << " design " << t.sum.read() << " "
+             << t.acc.read() << " " << t.odd.read() << ", model "
+             << unsigned(m.sum) << " " << unsigned(m.acc) << " "
+             << unsigned(m.odd) << endl;
+        return false;
+    }
+    return true;
+}
+#endif
+
+int sc_main(int argc, char **argv) {
+
+    tb tb_inst{"tb_inst"};
+
+#ifdef SCT_MODEL_HEADER
+    Dut_model m;
+    unsigned errors = 0;
+
+    for (unsigned i = 0; i < 200; ++i) {
+        // Reset in first cycles and in the middle
+        bool nrst = !(i < 2 || i == 100);
+        unsigned a = (i * 37 + 11) % 256;
+        unsigned b = (i * 91 + 5) % 256;
+
+        tb_inst.nrst = nrst; m.nrst = nrst;
+        tb_inst.a = a; m.a = a;
+        tb_inst.b = b; m.b = b;
+        tb_inst.clk = 0;
+        sc_start(5, SC_NS);
+        m.eval();
+        errors += !check(tb_inst, m, i);
+
+        tb_inst.clk = 1;
+        sc_start(5, SC_NS);
+        m.clock();
+        errors += !check(tb_inst, m, i);
+    }
+
+    cout << "Model errors " << errors << endl;
+    return errors != 0;
+#else
+    sc_start();
+    return 0;
+#endif
+}
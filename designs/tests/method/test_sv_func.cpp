@@ -0,0 +1,77 @@
+/******************************************************************************
+* Copyright (c) 2020, Intel Corporation. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+*
+*****************************************************************************/
+
+#include "systemc.h"
+
+using namespace sc_core;
+
+// Pure functions generated as SV functions with -sv_func_generate,
+// impure functions are inlined
+class A : public sc_module {
+public:
+    sc_in_clk clk;
+
+    sc_signal<sc_uint<4>>   a;
+    sc_signal<sc_uint<4>>   b;
+    sc_signal<sc_uint<8>>   r1;
+    sc_signal<sc_uint<8>>   r2;
+    sc_signal<sc_uint<8>>   r3;
+
+    SC_CTOR(A) {
+        SC_METHOD(pureProc); sensitive << a << b;
+        SC_METHOD(nestedProc); sensitive << a << b;
+        SC_METHOD(impureProc); sensitive << a << b;
+    }
+
+    // Pure functions
+    sc_uint<8> sumPure(sc_uint<4> x, sc_uint<4> y) {
+        return x + y;
+    }
+
+    sc_uint<8> muxPure(bool sel, sc_uint<8> u, sc_uint<8> v) {
+        return sel ? u : v;
+    }
+
+    // Impure functions: local variable and member channel access
+    sc_uint<8> incrImpure(sc_uint<4> val) {
+        sc_uint<8> l = val;
+        l++;
+        return l;
+    }
+
+    sc_uint<8> addImpure(sc_uint<4> par) {
+        return par + b.read();
+    }
+
+    // Pure function with parameters, called twice
+    void pureProc() {
+        sc_uint<8> t = sumPure(a.read(), b.read());
+        r1 = sumPure(t.range(3,0), a.read());
+    }
+
+    // Nested pure function calls
+    void nestedProc() {
+        r2 = muxPure(a.read() > b.read(), sumPure(a.read(), 1),
+                     sumPure(b.read(), 2));
+    }
+
+    // Impure function calls are inlined
+    void impureProc() {
+        sc_uint<8> t = incrImpure(a.read());
+        r3 = t + addImpure(a.read());
+    }
+};
+
+int sc_main(int argc, char *argv[])
+{
+    sc_clock clk{"clk", 1, SC_NS};
+    A a_mod{"a_mod"};
+    a_mod.clk(clk);
+
+    sc_start();
+    return 0;
+}
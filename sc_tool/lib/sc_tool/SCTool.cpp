@@ -18,6 +18,10 @@
 #include <sc_elab.pb.h>
 #include <sc_tool/ScCommandLine.h>
 #include <sc_tool/utils/DebugOptions.h>
+#include <sc_tool/utils/CfgFabric.h>
+#include <sc_tool/utils/ScTypeTraits.h>
+#include <sc_tool/cfg/ScTraverseCommon.h>
+#include <clang/Basic/FileManager.h>
 #include <clang/Frontend/FrontendActions.h>
 #include <clang/Tooling/CommonOptionsParser.h>
 #include <clang/Tooling/Tooling.h>
@@ -27,6 +31,7 @@
 #include <sc_elab/sc_tool_opts.h>
 #include <fstream>
 #include <stdio.h>
+#include <dlfcn.h>
 
 using namespace llvm;
 using namespace clang;
@@ -38,6 +43,18 @@ llvm::cl::OptionCategory ScToolCategory("sc_tool options");
 
 namespace sc {
 
+/// Batch mode, runScElab() returns to runScBatch() with ScElabDone exception
+static bool batchMode = false;
+/// File manager and PCH container operations shared between designs 
+/// in batch mode, that keeps file system cache of SystemC headers and PCH
+static IntrusiveRefCntPtr<FileManager> batchFiles;
+static std::shared_ptr<PCHContainerOperations> batchPCHOps;
+
+/// Thrown in batch mode to return from design sc_main to runScBatch()
+struct ScElabDone {
+    int exitCode;
+};
+
 [[ noreturn ]] void runScElab(const char *commandLine)
 {
     DEBUG_WITH_TYPE(DebugOptions::doElab,
@@ -102,9 +119,20 @@ namespace sc {
         auto error = op.takeError();
         outs() << "Errors happen during parsing parameters\n";
         exitCode = 100;
+        
+        // No compilation database to run SVC, next design is processed
+        // in batch mode
+        if (batchMode) {
+            llvm::consumeError(std::move(error));
+            outs().flush();
+            throw ScElabDone{exitCode};
+        }
     }
     
-    ClangTool Tool(op.get().getCompilations(), op.get().getSourcePathList());
+    ClangTool Tool(op.get().getCompilations(), op.get().getSourcePathList(),
+                   batchMode ? batchPCHOps : 
+                               std::make_shared<PCHContainerOperations>(),
+                   llvm::vfs::getRealFileSystem(), batchFiles);
 
     // Run SVC
     auto factory = getNewSCElabActionFactory();
@@ -116,11 +144,101 @@ namespace sc {
         exitCode = getDiagnosticStatus();
     }
     
+    // In batch mode go back to runScBatch() skipping rest of sc_main
+    if (batchMode) {
+        outs().flush();
+        throw ScElabDone{exitCode};
+    }
+    
     // We exit here, instead of returning to sc_main
     //outs() << "\nexitCode " << exitCode << "\n";
     exit(exitCode);
 }
 
+/// Clear elaboration and analysis state of processed design, AST of 
+/// the design is already destroyed
+static void resetScElab()
+{
+    sc_elab::reset_elaboration();
+    CfgFabric::reset();
+    resetTypeTraits();
+    resetPureFuncs();
+    resetDiagnosticStatus();
+}
+
+int runScBatch(const std::vector<std::string>& designLibs)
+{
+    batchMode = true;
+    batchFiles = new FileManager(FileSystemOptions());
+    batchPCHOps = std::make_shared<PCHContainerOperations>();
+    
+    // Exit code of first failed design
+    int exitCode = 0;
+    // Design library and its exit code
+    std::vector<std::pair<std::string, int>> results;
+    
+    for (const std::string& libName : designLibs) {
+        outs() << "Design library: " << libName << "\n";
+        outs().flush();
+        
+        int designCode = 0;
+        // Library is not unloaded, as design objects allocated with new 
+        // in sc_main are not destroyed
+        void* handle = dlopen(libName.c_str(), RTLD_NOW | RTLD_LOCAL);
+        using ScMainFunc = int (*)(int, char*[]);
+        ScMainFunc scMain = handle ? 
+                reinterpret_cast<ScMainFunc>(dlsym(handle, "sc_main")) : nullptr;
+        
+        if (!scMain) {
+            const char* err = dlerror();
+            outs() << "Cannot load design library " << libName << " : " 
+                   << (err ? err : "no sc_main found") << "\n";
+            designCode = 104;
+            
+        } else {
+            std::string arg0(libName);
+            char* argv[] = {&arg0[0], nullptr};
+            
+            try {
+                scMain(1, argv);
+                outs() << "No sc_start() called in sc_main\n";
+                designCode = 104;
+                
+            } catch (ScElabDone& done) {
+                designCode = done.exitCode;
+                
+            } catch (std::exception& e) {
+                outs() << "Exception in sc_main : " << e.what() << "\n";
+                designCode = 104;
+                
+            } catch (...) {
+                outs() << "Unknown exception in sc_main\n";
+                designCode = 104;
+            }
+        }
+        
+        resetScElab();
+        
+        results.emplace_back(libName, designCode);
+        if (exitCode == 0) exitCode = designCode;
+    }
+    
+    outs() << "--------------------------------------------------------------\n";
+    for (const auto& res : results) {
+        outs() << (res.second == 0 ? " OK    " : " ERROR ") << res.first;
+        if (res.second != 0) outs() << " (exit code " << res.second << ")";
+        outs() << "\n";
+    }
+    outs() << "--------------------------------------------------------------\n";
+    outs().flush();
+    
+    batchMode = false;
+    batchFiles = nullptr;
+    batchPCHOps = nullptr;
+    
+    return exitCode;
+}
+
 
 } // namespace sc_elab
 
@@ -13,6 +13,7 @@
 #define SCTOOL_SCTOOL_H
 
 #include <string>
+#include <vector>
 #include <iostream>
 
 /*
@@ -29,6 +30,14 @@ namespace sc {
 /// Entry point to SVC tool
 [[ noreturn ]] void runScElab(const char * commandLine);
 
+/// Entry point to SVC tool in batch mode, used by sctool_batch driver.
+/// Each design shared library built by svc_target with BATCH option is 
+/// loaded and its sc_main is called, runScElab() returns back here instead 
+/// of exit. Designs are processed one by one in the same process 
+/// \return zero if all designs are translated, otherwise exit code of 
+///         the first failed design
+int runScBatch(const std::vector<std::string>& designLibs);
+
 /// This function should replace regular sc_start, to run code generation instead
 /// of simulation
 template <class ...Ts>
@@ -20,6 +20,7 @@
 #include <sc_tool/utils/DebugOptions.h>
 #include <sc_tool/utils/StringFormat.h>
 #include <sc_tool/ScCommandLine.h>
+#include <sc_tool/cpp_model/ScCppModelWriter.h>
 #include <rtti_sysc/SystemCRTTI.h>
 #include <llvm/Support/CommandLine.h>
 
@@ -27,8 +28,10 @@
 #include <sc_tool/utils/DebugOptions.h>
 #include <clang/ASTMatchers/ASTMatchFinder.h>
 
+#include <algorithm>
 #include <exception>
 #include <fstream>
+#include <sstream>
 
 using namespace llvm;
 using namespace clang;
@@ -41,6 +44,14 @@ static cl::opt<std::string> topModuleName(
     cl::value_desc("top-level module"),
     cl::cat(ScToolCategory));
 
+static cl::list<std::string> sweepTops(
+    "sweep_top",
+    cl::desc("Specify top-level module hierarchical names for parameter "
+             "sweep, one SystemVerilog file generated for each of them"),
+    cl::value_desc("top-level module"),
+    cl::CommaSeparated,
+    cl::cat(ScToolCategory));
+
 namespace sc
 {
 
@@ -151,8 +162,25 @@ void SCElabASTConsumer::HandleTranslationUnit(clang::ASTContext &astCtx)
     
     //keepConstVariables = true;
  
-    // Find pointer to top-level module by SystemC name
-    void *topPtr = getTopModulePtr(topModuleName);
+    // Output file name
+    std::string svFile("out.sv");
+    if (!verilogFileName.empty()) {
+        svFile = verilogFileName;
+    }
+
+    // Find pointer to top-level module by SystemC name, for parameter sweep 
+    // all tops are found before analysis to report missed name early
+    if (!sweepTops.empty() && !topModuleName.empty()) {
+        ScDiag::reportErrAndDie("Option -top cannot be used with -sweep_top");
+    }
+    std::vector<void*> topPtrs;
+    if (sweepTops.empty()) {
+        topPtrs.push_back(getTopModulePtr(topModuleName));
+    } else {
+        for (const std::string& topName : sweepTops) {
+            topPtrs.push_back(getTopModulePtr(topName));
+        }
+    }
 
     // Generate a map from mangled type name to clang::QualType
     MangledTypeDB typeDB(astCtx);
@@ -164,6 +192,33 @@ void SCElabASTConsumer::HandleTranslationUnit(clang::ASTContext &astCtx)
     // Generates global database of known QualTypes (SystemC built-in types)
     initTypeTraits(astCtx);
 
+    if (sweepTops.empty()) {
+        runElaboration(astCtx, typeDB, topPtrs.front(), svFile);
+        
+    } else {
+        // Parameter sweep, each top is elaborated separately and generated 
+        // into its own file, AST, type DB, CFGs and type traits are shared
+        for (size_t i = 0; i != topPtrs.size(); ++i) {
+            std::string topSuffix = sweepTops[i];
+            std::replace(topSuffix.begin(), topSuffix.end(), '.', '_');
+            std::string topSvFile = removeFileExt(svFile) + "_" + 
+                                    topSuffix + ".sv";
+            
+            cout << "Parameter sweep top " << sweepTops[i] << ", output " 
+                 << topSvFile << endl;
+            // Issues in shared code are reported for each top again
+            resetDiagnosticIssues();
+            runElaboration(astCtx, typeDB, topPtrs[i], topSvFile);
+        }
+    }
+}
+
+// Elaborate design with given top module and generate SV into @svFile
+void SCElabASTConsumer::runElaboration(clang::ASTContext &astCtx,
+                                       sc_elab::MangledTypeDB& typeDB,
+                                       void* topPtr, 
+                                       const std::string& svFile)
+{
     // SCDesign is a Protobuf Database (Protobuf Message) that will store
     // elaborated design
     SCDesign designDB;
@@ -196,7 +251,7 @@ void SCElabASTConsumer::HandleTranslationUnit(clang::ASTContext &astCtx)
             // clang::FieldDecl f = ObjectView->getFieldDecl()
         
             // Do all the analysis and generate Verilog modules
-            runVerilogGeneration(elabDB, movedObjs);
+            runVerilogGeneration(elabDB, movedObjs, svFile);
 
             std::cout << "----------------------------------------------------------------" << std::endl;
             std::cout << " SystemC-to-Verilog translation, OK " << std::endl;
@@ -318,7 +373,8 @@ SCElabASTConsumer::moveDynamicObjects(SCDesign& designDB)
 // Create *.sv output file, generate all Verilog modules and intrinsics
 void SCElabASTConsumer::runVerilogGeneration(
                             sc_elab::ElabDatabase& elabDB,
-                            const std::unordered_map<size_t, size_t>& movedObjs) 
+                            const std::unordered_map<size_t, size_t>& movedObjs,
+                            std::string svFile) 
 {
     using namespace sc_elab;
     using std::cout; using std::endl;
@@ -337,11 +393,6 @@ void SCElabASTConsumer::runVerilogGeneration(
     // output file stream
     std::ofstream ofs;
 
-    std::string svFile("out.sv");
-    if (!verilogFileName.empty()) {
-        svFile = verilogFileName;
-    }
-
     ofs.open(svFile);
     if (!ofs.is_open()) {
         ScDiag::reportErrAndDie("Can't open " + svFile);
@@ -358,6 +409,8 @@ void SCElabASTConsumer::runVerilogGeneration(
     // Set of Verilog intrinsic modules that are already generated
     // to avoid duplication
     std::unordered_set<std::string> generatedIntrinsics;
+    // All modules code used to generate C++ model
+    std::string modelText;
     
     // Serialize all generated modules
     bool topModule = true;
@@ -382,6 +435,7 @@ void SCElabASTConsumer::runVerilogGeneration(
                         << " (" << modLoc << ")\n";
                     ofs << "//";
                     ofs << verCode << "\n";
+                    modelText += verCode + "\n";
                 }
                 generatedIntrinsics.insert(verMod.getName());
             }
@@ -390,6 +444,7 @@ void SCElabASTConsumer::runVerilogGeneration(
             llvm::raw_string_ostream ostr(modStr);
             verMod.serializeToStream(ostr);
             ofs << ostr.str();
+            modelText += ostr.str();
             
             // Generate top module wrapper file
             if (portMapGenerate) {
@@ -417,6 +472,27 @@ void SCElabASTConsumer::runVerilogGeneration(
 
     ofs.close();
     
+    // Generate cycle-based C++ model, first module is top
+    if ((cppModelGenerate || cppModelScModule) && 
+        !elabDB.getVerilogModules().empty()) {
+        std::string modelFile = removeFileExt(svFile) + "_model.h";
+        std::string topName = elabDB.getVerilogModules().begin()->getName();
+        
+        std::ostringstream mstr;
+        std::string err;
+        if (!generateCppModel(modelText, topName, cppModelScModule, mstr,
+                              err)) {
+            ScDiag::reportErrAndDie("C++ model is not generated: " + err);
+        }
+        
+        ofs.open(modelFile);
+        if (!ofs.is_open()) {
+            ScDiag::reportErrAndDie("Can't open " + modelFile);
+        }
+        ofs << tstr.str() << "\n" << mstr.str();
+        ofs.close();
+    }
+    
     // Generate port map file for vendor simulation tool
     if (portMapGenerate) {
         svFile = removeFileExt(svFile) + ".port_map";
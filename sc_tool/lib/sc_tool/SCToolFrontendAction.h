@@ -20,6 +20,7 @@
 
 namespace sc_elab { 
     class ElabDatabase; 
+    class MangledTypeDB;
 }
 
 namespace sc {
@@ -41,9 +42,15 @@ public:
     std::unordered_map<size_t, size_t> moveDynamicObjects(
                                             sc_elab::SCDesign& designDB);
 
+    /// Elaborate design with given top module, generate Verilog into @svFile
+    void runElaboration(clang::ASTContext &astCtx, 
+                        sc_elab::MangledTypeDB& typeDB, 
+                        void* topPtr, const std::string& svFile);
+    
     /// Create *.sv output file, generate all Verilog modules and intrinsics
     void runVerilogGeneration(sc_elab::ElabDatabase& elabDB,
-                        const std::unordered_map<size_t, size_t>& movedObjs);
+                        const std::unordered_map<size_t, size_t>& movedObjs,
+                        std::string svFile);
 };
 
 class SCElabFrontendAction : public clang::ASTFrontendAction 
@@ -56,10 +56,29 @@ cl::opt<bool> initResetLocalVars(
     cl::cat(ScToolCategory)
 );
 
+cl::opt<bool> svFuncGenerate(
+    "sv_func_generate",
+    cl::desc("Generate pure C++ functions as SystemVerilog functions"),
+    cl::cat(ScToolCategory)
+);
+
 cl::opt<std::string> modulePrefix (
     "module_prefix",
     cl::desc("Module prefix string"),
     cl::cat(ScToolCategory)
     );
 
+cl::opt<bool> cppModelGenerate(
+    "cpp_model_generate",
+    cl::desc("Generate cycle-based C++ model of the design"),
+    cl::cat(ScToolCategory)
+);
+
+cl::opt<bool> cppModelScModule(
+    "cpp_model_sc_module",
+    cl::desc("Generate C++ model with SystemC module which runs CTHREADs "
+             "as SC_METHODs"),
+    cl::cat(ScToolCategory)
+);
+
 
@@ -24,7 +24,10 @@ extern llvm::cl::opt<bool>          noRemoveExtraCode;
 extern llvm::cl::opt<bool>          checkUnsigned;
 extern llvm::cl::opt<bool>          initLocalVars;
 extern llvm::cl::opt<bool>          initResetLocalVars;
+extern llvm::cl::opt<bool>          svFuncGenerate;
 extern llvm::cl::opt<std::string>   modulePrefix;
+extern llvm::cl::opt<bool>          cppModelGenerate;
+extern llvm::cl::opt<bool>          cppModelScModule;
 
 // Remove unusable variables in reset section of CTHREAD
 inline bool REMOVE_RESET_UNUSED() {
@@ -146,7 +146,8 @@ sc_elab::VerilogProcCode ScProcAnalyzer::analyzeMethodProcess (
 //        }
 //        first = false;
 //
-//        auto callExpr = dyn_cast<const CallExpr>(entry.first.back());
+//        auto callExpr = dyn_cast<const CallExpr>(
+//                    travConst.getCallContexts()->getStmt(entry.first));
 //        cout << "    " << callExpr->getDirectCallee()->getNameAsString() 
 //             << " " << entry.second << endl;
 //    }
@@ -478,10 +479,12 @@ sc_elab::VerilogProcCode ScProcAnalyzer::analyzeMethodProcess (
     auto procState = shared_ptr<ScState>(globalState->clone());
     ScTraverseProc travProc(astCtx, procState, modval, procWriter.get(),
                             nullptr, nullptr, true);
-    travProc.setTermConds(travConst.getTermConds());
-    travProc.setLiveStmts(travConst.getLiveStmts());
-    travProc.setLiveTerms(travConst.getLiveTerms());
-    travProc.setConstEvalFuncs(travConst.getConstEvalFuncs());
+    travProc.setCallContexts(travConst.getCallContexts());
+    travProc.setTermConds(travConst.takeTermConds());
+    travProc.setLiveStmts(travConst.takeLiveStmts());
+    travProc.setLiveTerms(travConst.takeLiveTerms());
+    travProc.setConstEvalFuncs(travConst.takeConstEvalFuncs());
+    travProc.setVerilogModule(verMod);
 
     travProc.run(methodDecl, emptySensitivity);
     
@@ -664,7 +667,8 @@ std::string ScProcAnalyzer::analyzeSvaProperties(
     auto procState = shared_ptr<ScState>(globalState->clone());
     ScTraverseProc travProc(astCtx, procState, modval, procWriter.get(),
                             nullptr, nullptr, true);
-    travProc.setTermConds(travConst.getTermConds());
+    travProc.setCallContexts(travConst.getCallContexts());
+    travProc.setTermConds(travConst.takeTermConds());
     
     // Generate all properties
     std::string propStr;
@@ -19,6 +19,7 @@
 #include "sc_tool/diag/ScToolDiagnostic.h"
 #include "sc_tool/ScCommandLine.h"
 #include <vector>
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 
@@ -87,6 +88,59 @@ void ScState::parseParentForRec(SValue val, unsigned crossModule,
     parseParentForObj(dval, crossModule, valStack);
 }
 
+// ===========================================================================
+// Array summary 
+
+// Register array element which has tuple in state
+void ScState::regArrayElem(const SValue& eval)
+{
+    if (!eval.isArray() || eval.getArray().isUnknown()) return;
+    
+    SValue aval = eval;
+    size_t offset = aval.getArray().getOffset();
+    aval.getArray().setUnknownOffset();
+    arrayElems[aval].insert(offset);
+}
+
+// Get ordered offsets of array elements which could have tuple in state
+std::vector<size_t> ScState::getArrayElemOffsets(const SValue& aval) const
+{
+    SValue kval = aval;
+    kval.getArray().setUnknownOffset();
+    
+    auto i = arrayElems.find(kval);
+    if (i == arrayElems.end()) return std::vector<size_t>();
+    
+    // Order offsets to have deterministic tuple processing
+    std::vector<size_t> res(i->second.begin(), i->second.end());
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+// Remove offsets of array elements which have no tuple in state
+void ScState::compactArrayElems(const SValue& aval)
+{
+    SValue kval = aval;
+    kval.getArray().setUnknownOffset();
+    
+    auto i = arrayElems.find(kval);
+    if (i == arrayElems.end()) return;
+    
+    SValue eval = aval;
+    auto& offsets = i->second;
+    for (auto j = offsets.begin(); j != offsets.end(); ) {
+        eval.getArray().setOffset(*j);
+        if (tuples.count(eval) == 0) {
+            j = offsets.erase(j);
+        } else {
+            ++j;
+        }
+    }
+    if (offsets.empty()) {
+        arrayElems.erase(i);
+    }
+}
+
 // ===========================================================================
 // Public methods
 
@@ -231,6 +285,7 @@ void ScState::join(ScState* other)
     // If this is dead state and @other is not dead
     if (dead) {
         tuples.swap(other->tuples);
+        arrayElems.swap(other->arrayElems);
         levels.swap(other->levels);
         maxLevel = other->maxLevel;
         staticState.swap(other->staticState);
@@ -326,12 +381,14 @@ void ScState::setArrayNoValue(const SValue& val)
     //cout << "----- setArrayNoValue erase tuples for val " << val << endl;
     //if (val.getTypePtr()) val.getType()->dump();
     
+    // Only elements which have tuples are visited, other ones are NO_VALUE
     // Clear @unknown flag 
     SValue aval = val;
-    for (size_t i = 0; i < aval.getArray().getSize(); i++) {
+    for (size_t i : getArrayElemOffsets(val)) {
         aval.getArray().setOffset(i);
         removeIntSubValues(aval);
     }
+    compactArrayElems(val);
 }
 
 // Set record array elements accessed at unknown index to NO_VALUE, 
@@ -452,10 +509,13 @@ void ScState::putValue(const SValue& lval, const SValue& rval, bool deReference,
                         // Replace value for de-referenced variable
                         pair.first->second = rrval;
                     }
+                    regArrayElem(llval);
                 } else {
                     // Replace value 
                     pair.first->second = rrval;
                 }
+            } else {
+                regArrayElem(lval);
             }
             if (DebugOptions::isEnabled(DebugComponent::doState)) {
                 cout << "putValue (" << lval << ", " << rrval << ")" << endl;
@@ -488,9 +548,9 @@ SValue ScState::copyIntSubValues(const SValue& val, unsigned level,
     
     if (val.isArray()) {
         SValue aval = val;
-        size_t arrSize = val.getArray().getSize();
         
-        for (size_t i = 0; i < arrSize; ++i) {
+        // Elements without tuple have NO_VALUE, no copy required
+        for (size_t i : getArrayElemOffsets(val)) {
             aval.getArray().setOffset(i);
             cval.getArray().setOffset(i);
             // Recursively copy value of the element 
@@ -498,6 +558,7 @@ SValue ScState::copyIntSubValues(const SValue& val, unsigned level,
                                                parent, locvar, i)) 
             {
                 tuples.emplace(cval, rval);
+                regArrayElem(cval);
                 setValueLevel(cval, level);
             }
         }
@@ -564,12 +625,13 @@ void ScState::removeIntSubValues(const SValue& lval, bool doGetValue)
     } else 
     if (rval.isArray()) {
         SValue aval = rval;
-        size_t arrSize = aval.getArray().getSize();
         
-        for (size_t i = 0; i < arrSize; ++i) {
+        for (size_t i : getArrayElemOffsets(rval)) {
             aval.getArray().setOffset(i);
             removeIntSubValues(aval);
         }
+        compactArrayElems(rval);
+        
     } else 
     if (rval.isRecord()) {
         auto fields = getRecordFields(rval);
@@ -591,9 +653,8 @@ void ScState::removeSubValues(const SValue& val)
     //cout << "removeSubValues " << val << endl;
     if (val.isArray()) {
         SValue aval = val;
-        size_t arrSize = aval.getArray().getSize();
         
-        for (size_t i = 0; i < arrSize; ++i) {
+        for (size_t i : getArrayElemOffsets(val)) {
             aval.getArray().setOffset(i);
             
             auto j = tuples.find(aval);
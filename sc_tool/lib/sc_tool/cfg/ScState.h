@@ -140,6 +140,11 @@ class ScState
 protected:
     /// State tuples <SValue, SValue>
     std::unordered_map<SValue, SValue>    tuples;
+    /// Array summary: element without tuple has NO_VALUE, so only offsets of 
+    /// elements which could have tuple are stored, key is array value with 
+    /// unknown offset. Used to avoid iteration over all elements of large 
+    /// array at unknown index access, offsets could be superset of tuples
+    std::unordered_map<SValue, std::unordered_set<size_t>>  arrayElems;
     
     /// Level for variable/temporary/object value declarations
     std::vector<std::vector<SValue> >     levels;
@@ -201,6 +206,13 @@ protected:
     bool parseSvaArg = false;
     
 protected:
+    /// Register array element which has tuple in state
+    void regArrayElem(const SValue& eval);
+    /// Get ordered offsets of array elements which could have tuple in state
+    std::vector<size_t> getArrayElemOffsets(const SValue& aval) const;
+    /// Remove offsets of array elements which have no tuple in state
+    void compactArrayElems(const SValue& aval);
+    
     /// Auxiliary value parser functions
     void parseParentForVar(SValue val, unsigned crossModule,
                            std::vector<SValue>& valStack) const; 
@@ -58,20 +58,17 @@ void SubStmtVisitor::print() const
 
 //-----------------------------------------------------------------------------
 
-// Run analysis for process function 
-void ScStmtInfo::run(const clang::FunctionDecl* fdecl, unsigned level) 
+// Run analysis for function
+FuncStmtInfo::FuncStmtInfo(const clang::FunctionDecl* fdecl) 
 {
-    using namespace std;
-    
     if (fdecl) {
         clang::Stmt* returnStmt = nullptr;
-        analyzeStmt(fdecl->getBody(), level, returnStmt);
+        analyzeStmt(fdecl->getBody(), 0, returnStmt);
     }
-    //cout << "-------------------------------------------------" << endl;
 }
 
 // Recursively run analysis for statement
-void ScStmtInfo::analyzeStmt(clang::Stmt* stmt, unsigned level, 
+void FuncStmtInfo::analyzeStmt(clang::Stmt* stmt, unsigned level, 
                              clang::Stmt*& returnStmt, bool switchBody)
 {
     using namespace std;
@@ -130,6 +127,8 @@ void ScStmtInfo::analyzeStmt(clang::Stmt* stmt, unsigned level,
         if (ForStmt* forStmt = dyn_cast<ForStmt>(stmt)) {
             analyzeStmt(forStmt->getBody(), level+1, returnStmt, false);
             
+            forLoops.emplace(forStmt, ForLoopVisitor().getLoopInfo(forStmt));
+            
             ssVisitor.addSubStmts(forStmt->getCond(), forStmt);
             if (ssVisitor.hasCallExpr()) {
                 loopCallCond.insert(stmt);
@@ -198,6 +197,41 @@ void ScStmtInfo::analyzeStmt(clang::Stmt* stmt, unsigned level,
     }
 }
 
+//-----------------------------------------------------------------------------
+
+// Run analysis for process function 
+void ScStmtInfo::run(const clang::FunctionDecl* fdecl, unsigned level) 
+{
+    if (!fdecl) return;
+    
+    auto funcInfo = CfgFabric::getFabric(fdecl->getASTContext())->
+                    getStmtInfo(fdecl);
+    
+    auto i = funcLevels.find(funcInfo);
+    if (i != funcLevels.end()) {
+        // Function already added at the same level, nothing changed
+        if (i->second == level) return;
+        i->second = level;
+        
+    } else {
+        funcLevels.emplace(funcInfo, level);
+        
+        // Level independent information added once
+        const auto& breaks = funcInfo->getSwitchBreaks();
+        switchBreaks.insert(breaks.begin(), breaks.end());
+        const auto& groups = funcInfo->getDeclGroups();
+        declGroups.insert(groups.begin(), groups.end());
+        const auto& callConds = funcInfo->getLoopCallCond();
+        loopCallCond.insert(callConds.begin(), callConds.end());
+        const auto& subs = funcInfo->getSubStmts();
+        subStmts.insert(subs.begin(), subs.end());
+    }
+    
+    // Function can be called at different levels, last one is used
+    for (const auto& entry : funcInfo->getLevels()) {
+        levels[entry.first] = entry.second + level;
+    }
+}
 
 // Print all statement levels
 void ScStmtInfo::printLevels() const
@@ -20,6 +20,7 @@
 #include <clang/AST/RecursiveASTVisitor.h>
 #include "clang/AST/Stmt.h"
 #include "clang/AST/AST.h"
+#include "sc_tool/utils/CfgFabric.h"
 #include <unordered_map>
 #include <unordered_set>
 
@@ -51,18 +52,74 @@ public:
     /// Visited sub-statements include user function call expression
     bool hasCallExpr() const;
     
+    /// Get all sub-statements with their super-statements
+    const std::unordered_map<clang::Stmt*, clang::Stmt*>& getSubStmts() const {
+        return subStmts;
+    }
+    
     void print() const;
 };
 
 //------------------------------------------------------------------------------ 
 
+/// Statement levels relative to function body and other statement information
+/// for one function. It is built once in @CfgFabric and shared between 
+/// all process analyses, statement synthesis constraints are checked here
+class FuncStmtInfo
+{
+public:
+    /// Run analysis for function
+    explicit FuncStmtInfo(const clang::FunctionDecl* fdecl);
+    
+    const std::unordered_map<clang::Stmt*, unsigned>& getLevels() const {
+        return levels;
+    }
+    const std::unordered_set<clang::Stmt*>& getSwitchBreaks() const {
+        return switchBreaks;
+    }
+    const std::unordered_map<clang::Decl*, clang::Stmt*>& getDeclGroups() const {
+        return declGroups;
+    }
+    const std::unordered_set<clang::Stmt*>& getLoopCallCond() const {
+        return loopCallCond;
+    }
+    const std::unordered_map<clang::Stmt*, clang::Stmt*>& getSubStmts() const {
+        return ssVisitor.getSubStmts();
+    }
+    const std::unordered_map<const clang::ForStmt*, ForLoopInfo>& 
+    getForLoops() const {
+        return forLoops;
+    }
+    
+protected:
+    /// Statement levels, function body statements have zero level
+    std::unordered_map<clang::Stmt*, unsigned>  levels;
+    /// Break statements in switch case/default
+    std::unordered_set<clang::Stmt*>  switchBreaks;
+    /// Declaration from declaration groups
+    std::unordered_map<clang::Decl*, clang::Stmt*> declGroups;
+    /// Loops with function call in condition
+    std::unordered_set<clang::Stmt*> loopCallCond;
+    /// FOR loops counter information
+    std::unordered_map<const clang::ForStmt*, ForLoopInfo> forLoops;
+    /// Sub-statement visitor 
+    SubStmtVisitor ssVisitor;
+
+    /// Recursively run analysis for statement
+    void analyzeStmt(clang::Stmt* stmt, unsigned level, 
+                     clang::Stmt*& returnStmt, bool switchBody = false);
+};
+
+//------------------------------------------------------------------------------ 
+
 /// This class provides levels for statements based on analysis of AST and 
 /// checks statement synthesis constraints
 class ScStmtInfo 
 {
 public:
     
-    /// Run analysis for process function 
+    /// Run analysis for process function, function information is taken
+    /// from @CfgFabric and added with @level offset
     void run(const clang::FunctionDecl* fdecl, unsigned level);
     
     /// Get statement level
@@ -85,7 +142,7 @@ public:
     
     inline llvm::Optional<unsigned> 
     getSubStmtLevel(clang::Stmt* stmt) const {
-        if (auto ss = ssVisitor.getSuperStmt(stmt)) {
+        if (auto ss = getSuperStmt(stmt)) {
             return getLevel(ss);
         }
         return llvm::None;
@@ -93,7 +150,11 @@ public:
     
     /// Get statement for which given one is sub-statement or @nullptr
     clang::Stmt* getSuperStmt(clang::Stmt* stmt) const {
-        return ssVisitor.getSuperStmt(stmt);
+        auto i = subStmts.find(stmt);
+        if (i != subStmts.end()) {
+            return i->second;
+        }
+        return nullptr;
     }
     
     inline llvm::Optional<unsigned>
@@ -126,13 +187,11 @@ protected:
     std::unordered_map<clang::Decl*, clang::Stmt*> declGroups;
     /// Loops with function call in condition
     std::unordered_set<clang::Stmt*> loopCallCond;
-    /// Sub-statement visitor 
-    SubStmtVisitor ssVisitor;
-
-    /// Recursively run analysis for statement
-    void analyzeStmt(clang::Stmt* stmt, unsigned level, 
-                     clang::Stmt*& returnStmt, bool switchBody = false);
-    
+    /// Sub-statements with their super-statements
+    std::unordered_map<clang::Stmt*, clang::Stmt*> subStmts;
+    /// Functions already added with their last level, 
+    /// used to avoid repeated merge of the same function information
+    std::unordered_map<const FuncStmtInfo*, unsigned> funcLevels;
 };
 }
 
@@ -8,13 +8,13 @@
 #include "sc_tool/cfg/ScTraverseCommon.h"
 #include "sc_tool/utils/ScTypeTraits.h"
 #include "sc_tool/utils/CppTypeTraits.h"
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
 
 using namespace clang;
 using namespace sc;
 
-// For loop visitor instance
-ForLoopVisitor ForLoopVisitor::signleton;
-
 // Check if statement is member function of @sct_zero_width
 bool sc::isZeroWidthCall(clang::Stmt* stmt)
 {
@@ -60,7 +60,7 @@ bool sc::hasForExtrCntr(clang::Stmt* stmt)
     if (stmt == nullptr) return false;
     
     if (auto forStmt = dyn_cast<ForStmt>(stmt)) {
-        return !ForLoopVisitor::get().hasInternalCntr(forStmt);
+        return !CfgFabric::getForLoopInfo(forStmt).internalCntr;
     }
     return false;
 }
@@ -294,3 +294,168 @@ unsigned sc::getPredsNumber(AdjBlock block)
     return res;
 }
 
+namespace {
+
+/// Check expression has no side effects and refers to function parameters, 
+/// enumeration constants and SC data type operations only
+class PureExprVisitor : public RecursiveASTVisitor<PureExprVisitor> 
+{
+public:
+    explicit PureExprVisitor(const FunctionDecl* funcDecl_) : 
+        funcDecl(funcDecl_)
+    {}
+    
+    bool isPure(Expr* expr) {
+        pure = true;
+        TraverseStmt(expr);
+        return pure;
+    }
+    
+    bool VisitStmt(Stmt* stmt) 
+    {
+        if (isa<IntegerLiteral>(stmt) || isa<CXXBoolLiteralExpr>(stmt) ||
+            isa<CharacterLiteral>(stmt) || isa<ConstantExpr>(stmt) ||
+            isa<ParenExpr>(stmt) || isa<CastExpr>(stmt) ||
+            isa<ConditionalOperator>(stmt) || 
+            isa<MaterializeTemporaryExpr>(stmt) ||
+            isa<CXXBindTemporaryExpr>(stmt) || isa<ExprWithCleanups>(stmt) ||
+            isa<SubstNonTypeTemplateParmExpr>(stmt)) {
+            return true;
+        }
+        
+        if (auto binstmt = dyn_cast<BinaryOperator>(stmt)) {
+            pure = !binstmt->isAssignmentOp() && !binstmt->isCommaOp();
+            
+        } else 
+        if (auto unrstmt = dyn_cast<UnaryOperator>(stmt)) {
+            pure = !unrstmt->isIncrementDecrementOp() && 
+                   unrstmt->getOpcode() != UO_AddrOf && 
+                   unrstmt->getOpcode() != UO_Deref;
+            
+        } else 
+        if (auto refexpr = dyn_cast<DeclRefExpr>(stmt)) {
+            auto decl = refexpr->getDecl();
+            if (isa<ParmVarDecl>(decl)) {
+                pure = decl->getDeclContext() == funcDecl;
+            } else {
+                pure = isa<EnumConstantDecl>(decl) || 
+                       (isa<FunctionDecl>(decl) && isScDtDecl(decl));
+            }
+            
+        } else 
+        if (auto opcall = dyn_cast<CXXOperatorCallExpr>(stmt)) {
+            auto opcode = opcall->getOperator();
+            pure = isScDtDecl(opcall->getCalleeDecl()) && 
+                   !opcall->isAssignmentOp() && 
+                   opcode != OO_PlusPlus && opcode != OO_MinusMinus;
+            
+        } else 
+        if (auto mcall = dyn_cast<CXXMemberCallExpr>(stmt)) {
+            auto methodDecl = mcall->getMethodDecl();
+            pure = methodDecl && methodDecl->isConst() && isScDtDecl(methodDecl);
+            
+        } else 
+        if (auto memexpr = dyn_cast<MemberExpr>(stmt)) {
+            // Member function only, no field access 
+            pure = isa<CXXMethodDecl>(memexpr->getMemberDecl()) &&
+                   isScDtDecl(memexpr->getMemberDecl());
+            
+        } else 
+        if (auto ctorexpr = dyn_cast<CXXConstructExpr>(stmt)) {
+            pure = isScDtDecl(ctorexpr->getConstructor());
+            
+        } else {
+            pure = false;
+        }
+        
+        // Stop traverse at first impure expression
+        return pure;
+    }
+    
+protected:
+    bool isScDtDecl(const Decl* decl) {
+        if (!decl) return false;
+        auto nsname = getNamespaceAsStr(decl);
+        return (nsname && *nsname == "sc_dt");
+    }
+    
+    const FunctionDecl* funcDecl;
+    bool pure = true;
+};
+
+}
+
+// Analysis result for function definitions, @nullptr for impure function 
+static std::unordered_map<const FunctionDecl*, const Expr*> pureFuncs;
+static std::shared_mutex pureFuncsMutex;
+
+// Get return expression of pure function which can be generated as 
+// SystemVerilog function
+const clang::Expr* sc::getPureFuncReturn(const clang::FunctionDecl* funcDecl)
+{
+    if (!funcDecl) return nullptr;
+    const FunctionDecl* defDecl = funcDecl->getDefinition();
+    if (!defDecl) return nullptr;
+    
+    {
+        std::shared_lock<std::shared_mutex> lock(pureFuncsMutex);
+        auto i = pureFuncs.find(defDecl);
+        if (i != pureFuncs.end()) {
+            return i->second;
+        }
+    }
+    
+    auto checkType = [](QualType type) {
+        return (!type->isReferenceType() && !type->isPointerType() && 
+                !type->isEnumeralType() && isAnyInteger(type) && 
+                !isZeroWidthType(type));
+    };
+    
+    const Expr* retExpr = nullptr;
+    auto nsname = getNamespaceAsStr(defDecl);
+    auto methodDecl = dyn_cast<CXXMethodDecl>(defDecl);
+    
+    bool eligible = 
+        !(nsname && (*nsname == "sc_core" || *nsname == "sc_dt" || 
+                     *nsname == "std" || *nsname == "sct")) &&
+        !isLinkageDecl(defDecl) && 
+        !isa<CXXConstructorDecl>(defDecl) && !isa<CXXDestructorDecl>(defDecl) &&
+        !isa<CXXConversionDecl>(defDecl) && !defDecl->isOverloadedOperator() &&
+        !(methodDecl && methodDecl->isVirtual()) && 
+        !defDecl->isVariadic() && !defDecl->isDependentContext() &&
+        defDecl->getNumParams() != 0 && checkType(defDecl->getReturnType());
+    
+    if (eligible) {
+        for (auto parDecl : defDecl->parameters()) {
+            if (!checkType(parDecl->getType()) || parDecl->hasDefaultArg()) {
+                eligible = false; break;
+            }
+        }
+    }
+    
+    if (eligible) {
+        // Function body should be single return statement
+        const Stmt* body = defDecl->getBody();
+        if (auto compStmt = dyn_cast_or_null<CompoundStmt>(body)) {
+            body = (compStmt->size() == 1) ? compStmt->body_front() : nullptr;
+        }
+        if (auto retStmt = dyn_cast_or_null<ReturnStmt>(body)) {
+            auto expr = const_cast<Expr*>(retStmt->getRetValue());
+            if (expr && PureExprVisitor(defDecl).isPure(expr)) {
+                retExpr = expr;
+            }
+        }
+    }
+    
+    // Analysis does not modify AST, so it is done without lock, the function
+    // could be analyzed by another thread with the same result
+    std::unique_lock<std::shared_mutex> lock(pureFuncsMutex);
+    pureFuncs.emplace(defDecl, retExpr);
+    return retExpr;
+}
+
+void sc::resetPureFuncs()
+{
+    std::unique_lock<std::shared_mutex> lock(pureFuncsMutex);
+    pureFuncs.clear();
+}
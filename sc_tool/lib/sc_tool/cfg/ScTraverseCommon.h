@@ -16,10 +16,13 @@
 #define SCTRAVERSEBASE_H
 
 #include "sc_tool/diag/ScToolDiagnostic.h"
+#include "sc_tool/utils/CfgFabric.h"
 #include "clang/Analysis/CFG.h"
 #include <clang/AST/RecursiveASTVisitor.h>
 #include "clang/AST/Stmt.h"
 #include <iostream>
+#include <climits>
+#include <unordered_map>
 #include <unordered_set>
 #include <map>
 
@@ -78,9 +81,71 @@ public:
     }
 };
     
-/// Function call statement stack, used for constant propagation evaluated 
-/// condition value
-typedef std::vector<const clang::Stmt*> CallStmtStack;
+/// Call context identifier, function call statement stack interned in 
+/// @CallContexts, used as key for constant propagation evaluated values
+typedef unsigned CallContextId;
+
+/// Hash-consed tree of function call contexts, each context is parent 
+/// context and call statement mapped to small integer identifier.
+/// Contexts are created in ScTraverseConst and shared with ScTraverseProc
+class CallContexts 
+{
+public:
+    /// Empty call stack context
+    static const CallContextId ROOT_ID = 0;
+    /// Context which is not created
+    static const CallContextId NO_ID = UINT_MAX;
+
+    CallContexts() : nodes(1, Node{NO_ID, nullptr}) 
+    {}
+    
+    /// Get or create context for @stmt in @parent context
+    CallContextId getId(CallContextId parent, const clang::Stmt* stmt) 
+    {
+        auto i = ids.emplace(Key(parent, stmt), nodes.size());
+        if (i.second) {
+            nodes.push_back(Node{parent, stmt});
+        }
+        return i.first->second;
+    }
+    
+    /// Get context for @stmt in @parent context, NO_ID if it is not created
+    CallContextId findId(CallContextId parent, const clang::Stmt* stmt) const
+    {
+        if (parent == NO_ID) return NO_ID;
+        auto i = ids.find(Key(parent, stmt));
+        return (i != ids.end()) ? i->second : NO_ID;
+    }
+    
+    /// Last call statement of the context
+    const clang::Stmt* getStmt(CallContextId id) const {
+        return nodes.at(id).stmt;
+    }
+    
+    /// Parent context
+    CallContextId getParent(CallContextId id) const {
+        return nodes.at(id).parent;
+    }
+    
+private:
+    typedef std::pair<CallContextId, const clang::Stmt*> Key;
+    
+    struct KeyHash {
+        std::size_t operator () (const Key& key) const {
+            return (std::hash<const void*>()(key.second) ^ 
+                    (std::size_t(key.first) * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+    
+    struct Node {
+        CallContextId       parent;
+        const clang::Stmt*  stmt;
+    };
+    
+    /// Contexts by identifier
+    std::vector<Node> nodes;
+    std::unordered_map<Key, CallContextId, KeyHash> ids;
+};
 
 }
 
@@ -98,19 +163,6 @@ struct hash<sc::AdjBlock>
     }
 };
 
-// Hash function for @CallStmtStack
-template<> 
-struct hash<sc::CallStmtStack>  
-{
-    std::size_t operator () (const sc::CallStmtStack& obj) const {
-        using std::hash;
-        size_t res = 0;
-        for (auto i : obj) {
-            res += std::hash<const void*>()(i);
-        }
-        return res;
-    }
-};
 }
 
 //=============================================================================
@@ -124,15 +176,9 @@ protected :
     clang::VarDecl* initVar = nullptr;
     clang::VarDecl* incVar = nullptr;
     
-    static ForLoopVisitor signleton;
-
-    ForLoopVisitor() {}
-    
 public:
     
-    static ForLoopVisitor& get() {
-        return signleton;
-    }
+    ForLoopVisitor() {}
     
     bool VisitStmt(clang::Stmt* stmt) 
     {
@@ -175,6 +221,15 @@ public:
         this->TraverseStmt(stmt->getInit());
         return initVar;
     }
+    
+    /// Get counter declaration and internal counter flag together
+    ForLoopInfo getLoopInfo(clang::ForStmt* stmt) 
+    {
+        ForLoopInfo info;
+        info.internalCntr = hasInternalCntr(stmt);
+        info.cntrDecl = getCounterDecl(stmt);
+        return info;
+    }
 };
 
 /// Check if statement is member function of @sct_zero_width
@@ -228,6 +283,16 @@ bool isDefaultEmpty(const clang::SwitchCase* swcase);
 /// Get block predecessor number excluding &&/|| predecessors
 unsigned getPredsNumber(AdjBlock block);
 
+/// Get return expression of pure function which can be generated as 
+/// SystemVerilog function, that is function with integer parameters passed 
+/// by value and body with single return statement without side effects
+/// \return return expression or @nullptr if function is not pure
+const clang::Expr* getPureFuncReturn(const clang::FunctionDecl* funcDecl);
+
+/// Clear pure function analysis results, should be called before next AST 
+/// processing in the same process
+void resetPureFuncs();
+
 //=============================================================================
 
 /// Update predecessor scopes and return loop stack for the next block
@@ -149,6 +149,18 @@ void ScTraverseConst::registerAccessVar(bool isResetSection, const Stmt* stmt)
 // ---------------------------------------------------------------------------
 // Auxiliary functions
 
+// Get call context of current function from the context stack, 
+// check it is the same as found for the stack call points
+CallContextId ScTraverseConst::getCallContext() const
+{
+    auto callId = contextStack.getCallContext();
+#ifndef NDEBUG
+    SCT_TOOL_ASSERT (callId == contextStack.findCallContext(*callContexts),
+                     "Call context differs from context stack");
+#endif
+    return callId;
+}
+
 // Evaluate terminator condition if it is compile time constant
 void ScTraverseConst::evaluateTermCond(Stmt* stmt, SValue& val) 
 {
@@ -238,12 +250,12 @@ llvm::Optional<unsigned> ScTraverseConst::evaluateIterNumber(const Stmt* stmt)
 // Store ternary statement condition for SVA property
 void ScTraverseConst::putSvaCondTerm(const Stmt* stmt, SValue val) 
 {
-    auto callStack = contextStack.getStmtStack();
-    callStack.push_back(stmt);
+    auto callId = getCallContext();
+    callId = callContexts->getId(callId, stmt);
     // Add the same value for first iteration
-    callStack.push_back(stmt);
+    callId = callContexts->getId(callId, stmt);
 
-    auto i = termConds.emplace(callStack, val);
+    auto i = termConds.emplace(callId, val);
     if (!i.second) {
         if (i.first->second != val) {
             i.first->second = NO_VALUE;
@@ -251,7 +263,7 @@ void ScTraverseConst::putSvaCondTerm(const Stmt* stmt, SValue val)
         }
     }
     
-    //cout << "putSvaCondTerm " << hex << stmt << " stackSize " << callStack.size()  
+    //cout << "putSvaCondTerm " << hex << stmt << " callId " << callId  
     //     << " val " << val << dec << endl;
 }
 
@@ -390,20 +402,20 @@ void ScTraverseConst::parseReturnStmt(ReturnStmt* stmt, SValue& val)
     ScParseExprValue::parseReturnStmt(stmt, val);
 
     // Empty call stack possible for return from process function
-    auto callStack = contextStack.getStmtStack();
-    if (!callStack.empty()) {
+    auto callId = getCallContext();
+    if (callId != CallContexts::ROOT_ID) {
         // Try to get integer value for return value assignment
         SValue rval = getValueFromState(val);
 
         if (rval.isInteger()) {
-            auto i = constEvalFuncs.emplace(callStack, rval);
+            auto i = constEvalFuncs.emplace(callId, rval);
             if (!i.second) {
                 if (i.first->second != rval) {
                     i.first->second = NO_VALUE;
                 }
             }
         } else {
-            constEvalFuncs[callStack] = NO_VALUE;
+            constEvalFuncs[callId] = NO_VALUE;
         }
     }
 }
@@ -1151,7 +1163,7 @@ void ScTraverseConst::run()
                     }
                     
                     // Store and null function context
-                    contextStack.push_back( *(lastContext.get()) );
+                    contextStack.pushCall(*(lastContext.get()), *callContexts);
 
                     // Fill statement levels for current function
                     stmtInfo.run(funcDecl, level+1);  
@@ -1214,8 +1226,8 @@ void ScTraverseConst::run()
                         SValue val;
                         chooseExprMethod(init, val);
                         
-                        if (auto varDecl = ForLoopVisitor::get().
-                                           getCounterDecl(forstmt)) {
+                        if (auto varDecl = CfgFabric::getForLoopInfo(
+                                           forstmt).cntrDecl) {
                             val = SValue(varDecl, modval); 
                             state->regForLoopCounter(val);
                         }
@@ -1280,14 +1292,14 @@ void ScTraverseConst::run()
             
             // Store terminator condition to use in ScTraverseProc, 
             // different results joined to NO_VALUE
-            auto callStack = contextStack.getStmtStack();
-            callStack.push_back(term);
-            // Use call stack with double #term to distinguish first iteration
+            auto callId = getCallContext();
+            callId = callContexts->getId(callId, term);
+            // Use call context with double #term to distinguish first iteration
             if (loopFirstIter) {
-                callStack.push_back(term);
+                callId = callContexts->getId(callId, term);
             }
 
-            auto i = termConds.emplace(callStack, termCondValue);
+            auto i = termConds.emplace(callId, termCondValue);
             if (!i.second) {
                 SValue& curVal = i.first->second;
                 if (curVal.isInteger() && termCondValue.isInteger()) {
@@ -1303,7 +1315,7 @@ void ScTraverseConst::run()
                 }
             }
 
-            //cout << "putTermConds " << hex << term << " stackSize " << callStack.size()  
+            //cout << "putTermConds " << hex << term << " callId " << callId  
             //     << " val " << termCondValue << dec << endl;
             
             // Register terminator as live
@@ -1890,12 +1902,12 @@ void ScTraverseConst::run()
             // Mark function as not eligible for evaluation as constant if
             // it does not have simple return
             if (sideEffectFunc || !simpleReturnFunc) {
-                auto callStack = contextStack.getStmtStack();
+                auto callId = getCallContext();
                 // Skip empty stack as there is no function
-                if (!callStack.empty()) {
-                    constEvalFuncs[callStack] = NO_VALUE;
+                if (callId != CallContexts::ROOT_ID) {
+                    constEvalFuncs[callId] = NO_VALUE;
                 }
-                //cout << "Non simple return " << hex << (size_t)callStack.back() << dec << endl;
+                //cout << "Non simple return " << hex << (size_t)callContexts->getStmt(callId) << dec << endl;
             }
             
             // Restore callee function context
@@ -175,6 +175,8 @@ struct ConstFuncContext {
     /// Current function and all called functions change some non-local
     /// variables/channels through parameters or directly
     bool sideEffectFunc;
+    /// Call context of the function called at @callPoint, set in push
+    CallContextId callId = CallContexts::NO_ID;
    
     explicit ConstFuncContext(
                     const CfgCursor& callPoint_,
@@ -212,24 +214,32 @@ public:
         return cursorStack;
     }
     
-    CallStmtStack getStmtStack()
+    /// Push function context and create call context for its call point
+    void pushCall(const ConstFuncContext& ctx, CallContexts& contexts)
     {
-        using namespace clang;
-        CallStmtStack stmtStack;
-
-        for (auto& ctx : *this) {
-            auto& cursor = ctx.callPoint;
-            auto elm = cursor.getBlock()->operator [](cursor.getElementID());
-            
-            if (elm.getKind() == CFGElement::Kind::Statement) {
-                CFGStmt cfgstmt = elm.getAs<CFGStmt>().getValue();
-                stmtStack.push_back(cfgstmt.getStmt());
-                
-            } else {
-                SCT_TOOL_ASSERT (false, "Incorrect element kind");
-            }
-        }        
-        return stmtStack;
+        auto stmt = ctx.callPoint.getStmt();
+        SCT_TOOL_ASSERT (stmt, "Incorrect element kind");
+        
+        CallContextId id = contexts.getId(getCallContext(), stmt);
+        push_back(ctx);
+        back().callId = id;
+    }
+    
+    /// Get call context of the stack, stored in the last function context
+    CallContextId getCallContext() const
+    {
+        return empty() ? CallContexts::ROOT_ID : back().callId;
+    }
+    
+    /// Find call context for call points of all the functions in the stack,
+    /// used to check context stored in the last function context
+    CallContextId findCallContext(const CallContexts& contexts) const
+    {
+        CallContextId id = CallContexts::ROOT_ID;
+        for (const auto& ctx : *this) {
+            id = contexts.findId(id, ctx.callPoint.getStmt());
+        }
+        return id;
     }
     
     void printCursorStack() 
@@ -279,6 +289,9 @@ protected:
     /// check read-not-defined is empty in reset
     void registerAccessVar(bool isResetSection, const clang::Stmt* stmt);
     
+    /// Get call context of current function from the context stack
+    CallContextId getCallContext() const;
+    
     /// Evaluate terminator condition if it is compile time constant
     void evaluateTermCond(clang::Stmt* stmt, SValue& val);
     
@@ -348,9 +361,32 @@ public:
     }
     
     /// Get evaluated terminator condition values
-    const std::unordered_map<CallStmtStack, SValue>& getTermConds() const {
+    const std::unordered_map<CallContextId, SValue>& getTermConds() const {
         return termConds;        
     }
+    
+    /// Get call contexts used as keys of terminator conditions and 
+    /// constant evaluated functions
+    std::shared_ptr<CallContexts> getCallContexts() const {
+        return callContexts;
+    }
+    
+    /// Move analysis results to ScTraverseProc, called after analysis done
+    std::unordered_set<clang::Stmt*> takeLiveStmts() {
+        return std::move(liveStmts);
+    }
+    
+    std::unordered_set<clang::Stmt*> takeLiveTerms() {
+        return std::move(liveTerms);
+    }
+    
+    std::unordered_map<CallContextId, SValue> takeTermConds() {
+        return std::move(termConds);
+    }
+    
+    std::unordered_map<CallContextId, SValue> takeConstEvalFuncs() {
+        return std::move(constEvalFuncs);
+    }
    
     /// Get values defined in reset section
     const std::unordered_set<SValue>& getResetDefConsts() const {
@@ -421,7 +457,7 @@ public:
         return usedVals;
     }
     
-    std::unordered_map<CallStmtStack, SValue> getConstEvalFuncs() {
+    const std::unordered_map<CallContextId, SValue>& getConstEvalFuncs() const {
         return constEvalFuncs;
     }
     
@@ -524,11 +560,15 @@ protected:
     /// Not mandatory required statements, can be removed in @removeUnusedStmt()
     std::unordered_set<clang::Stmt*> simpleStmts;
     
+    /// Call contexts for #termConds and #constEvalFuncs, shared with 
+    /// ScTraverseProc
+    std::shared_ptr<CallContexts> callContexts = 
+                                  std::make_shared<CallContexts>();
     /// Evaluated terminator condition values, use in ScTraverseProc
-    std::unordered_map<CallStmtStack, SValue> termConds;
+    std::unordered_map<CallContextId, SValue> termConds;
     /// Functions evaluated as constants if stored SValue is integer or 
     /// not eligible if NO_VALUE stored
-    std::unordered_map<CallStmtStack, SValue> constEvalFuncs;
+    std::unordered_map<CallContextId, SValue> constEvalFuncs;
 
     /// CTHREAD wait states and constant propagation result providers
     ScCThreadStates* cthreadStates = nullptr;
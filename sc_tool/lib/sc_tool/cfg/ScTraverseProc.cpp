@@ -12,6 +12,7 @@
 #include "sc_tool/utils/DebugOptions.h"
 #include "sc_tool/ScCommandLine.h"
 #include "sc_tool/utils/CppTypeTraits.h"
+#include "sc_tool/elab/ScVerilogModule.h"
 
 #include "clang/AST/Decl.h"
 #include <memory>
@@ -112,24 +113,34 @@ bool ScTraverseProc::isWaitInCurrFunc()
     return isWaitInFunc(funcDecl);
 }
     
+// Get call context of current function from the context stack, 
+// check it is the same as found for the stack call points
+CallContextId ScTraverseProc::getCallContext() const
+{
+    auto callId = contextStack.getCallContext();
+#ifndef NDEBUG
+    SCT_TOOL_ASSERT (callId == contextStack.findCallContext(*callContexts),
+                     "Call context differs from context stack");
+#endif
+    return callId;
+}
+
 // Get terminator condition from CPA stored in #termConds
 void ScTraverseProc::getTermCondValue(const Stmt* stmt, SValue& val, SValue& fval) 
 {
-    auto callStack = contextStack.getStmtStack();
-    callStack.push_back(stmt);
-    auto i = termConds.find(callStack);
+    auto callId = getCallContext();
+    callId = callContexts->findId(callId, stmt);
+    auto i = termConds.find(callId);
     bool otherIters = (i != termConds.end());
     val = otherIters ? i->second : NO_VALUE;
 
     // Use double #term to distinguish first iteration for FOR/WHILE loops 
-    callStack.push_back(stmt);
-    i = termConds.find(callStack);
+    callId = callContexts->findId(callId, stmt);
+    i = termConds.find(callId);
     bool firstIter = (i != termConds.end());
     fval = firstIter ? i->second : NO_VALUE;
 
-//    cout << "Call stack first iter " << hex;
-//    for (auto i : callStack) cout << " " << i;
-//    cout << " fval " << fval << endl;
+//    cout << "Call context first iter " << callId << " fval " << fval << endl;
     
     if (firstIter && otherIters) {
         // Join first iteration value to all other iterations value
@@ -140,7 +151,7 @@ void ScTraverseProc::getTermCondValue(const Stmt* stmt, SValue& val, SValue& fva
         val = fval;
     }
     
-    //cout << "getTermConds " << hex << stmt << " stackSize " << callStack.size()  
+    //cout << "getTermConds " << hex << stmt << " callId " << callId  
     //     << " val " << val << dec << endl;
     //cout << "First iter " << fval.asString() << " " << firstIter 
     //      << ", other iters " << val.asString() << " " << otherIters << endl;
@@ -331,9 +342,9 @@ void ScTraverseProc::parseCall(CallExpr* expr, SValue& val)
             cout << "-------------------------------------" << endl;
         }
         
-        auto callStack = contextStack.getStmtStack();
-        callStack.push_back(expr);
-        auto i = constEvalFuncs.find(callStack);
+        auto callId = getCallContext();
+        callId = callContexts->findId(callId, expr);
+        auto i = constEvalFuncs.find(callId);
         
         if (i != constEvalFuncs.end()) {
             // Function call evaluated as constant
@@ -423,9 +434,9 @@ void ScTraverseProc::parseMemberCall(CXXMemberCallExpr* expr, SValue& tval,
             cout << "-------------------------------------" << endl;
         }
                     
-        auto callStack = contextStack.getStmtStack();
-        callStack.push_back(expr);
-        auto i = constEvalFuncs.find(callStack);
+        auto callId = getCallContext();
+        callId = callContexts->findId(callId, expr);
+        auto i = constEvalFuncs.find(callId);
         
         if (i != constEvalFuncs.end()) {
             // Function call evaluated as constant
@@ -633,11 +644,94 @@ void ScTraverseProc::chooseExprMethod(Stmt *stmt, SValue &val)
             codeWriter->putValueExpr(stmt, val);
         }
 
+    } else 
+    if (auto callFuncDecl = getSvFuncCallee(stmt)) {
+        // Pure function call generated as SV function call
+        val = NO_VALUE;
+        putSvFuncCall(cast<CallExpr>(stmt), callFuncDecl);
+        
     } else {
         ScGenerateExpr::chooseExprMethod(stmt, val);
     }
 }
 
+// Get called function if the call should be generated as SV function call
+const FunctionDecl* ScTraverseProc::getSvFuncCallee(const Stmt* stmt)
+{
+    if (!svFuncGenerate || !verMod || codeWriter->isParseSvaArg()) {
+        return nullptr;
+    }
+    
+    auto expr = dyn_cast<CallExpr>(stmt);
+    if (!expr || isa<CXXOperatorCallExpr>(expr)) return nullptr;
+    
+    // Method called for another record can have side effects in object expression
+    if (auto mexpr = dyn_cast<CXXMemberCallExpr>(expr)) {
+        auto thisExpr = mexpr->getImplicitObjectArgument();
+        if (!thisExpr || !isa<CXXThisExpr>(thisExpr->IgnoreImpCasts())) {
+            return nullptr;
+        }
+    }
+    
+    auto callFuncDecl = expr->getDirectCallee();
+    if (!getPureFuncReturn(callFuncDecl)) return nullptr;
+    
+    // Function call evaluated as constant is replaced with the constant
+    auto callId = getCallContext();
+    callId = callContexts->findId(callId, stmt);
+    if (constEvalFuncs.count(callId)) return nullptr;
+    
+    return callFuncDecl;
+}
+
+// Get name of SV function for pure function, generate the function 
+// in the module if it is not done yet
+std::string ScTraverseProc::getSvFuncName(const FunctionDecl* callFuncDecl)
+{
+    auto defDecl = callFuncDecl->getDefinition();
+    if (auto name = verMod->getSvFunctionName(defDecl)) {
+        return *name;
+    }
+    
+    // Function name should not conflict with module and process local names
+    string name = verMod->getNameGen().getUniqueName(
+                                        defDecl->getNameAsString(), true);
+    
+    // Parse return expression with separate writer and module state clone, 
+    // so parameter names and terms do not depend on the current process
+    ScVerilogWriter funcWriter(sm, true, state->getExtrValNames(), 
+                               verMod->getNameGen(), state->getVarTraits(),
+                               state->getWaitNVarName());
+    ScGenerateExpr funcGen(astCtx, shared_ptr<ScState>(state->clone()), true,
+                           synmodval, &funcWriter);
+    auto retExpr = removeExprCleanups(const_cast<Expr*>(
+                                      getPureFuncReturn(defDecl)));
+    funcGen.parse(retExpr);
+    
+    verMod->addSvFunction(defDecl, name, funcWriter.getFuncDeclVerilog(
+                          name, defDecl, synmodval, retExpr));
+    
+    if (DebugOptions::isEnabled(DebugComponent::doGenFuncCall)) {
+        cout << "Generate SV function " << name << endl;
+    }
+    return name;
+}
+
+// Parse call arguments and put SV function call
+void ScTraverseProc::putSvFuncCall(CallExpr* expr, 
+                                   const FunctionDecl* callFuncDecl)
+{
+    vector<const Expr*> args;
+    for (auto arg : expr->arguments()) {
+        SValue aval;
+        chooseExprMethod(arg, aval);
+        args.push_back(arg);
+    }
+    
+    string name = getSvFuncName(callFuncDecl);
+    codeWriter->putFuncCall(expr, name, args);
+}
+
 // ------------------------------------------------------------------------
 // Context functions
 
@@ -982,11 +1076,17 @@ void ScTraverseProc::run()
                                            "No level found for sub-statement");
                     }
                     
+                    // Pure function call generated as part of its statement,
+                    // such call without result used is removed
+                    if (isStmt && getSvFuncCallee(currStmt)) {
+                        isStmt = false;
+                    }
+                    
                     // Check function call is not evaluated as constant
                     if (isStmt) {
-                        auto callStack = contextStack.getStmtStack();
-                        callStack.push_back(currStmt);
-                        isStmt = constEvalFuncs.count(callStack) == 0;
+                        auto callId = getCallContext();
+                        callId = callContexts->findId(callId, currStmt);
+                        isStmt = constEvalFuncs.count(callId) == 0;
                         //cout << "isCallSubStmt " << isStmt << " " << hex << currStmt << dec << endl;
                     }
 
@@ -1135,7 +1235,7 @@ void ScTraverseProc::run()
                         
                         // Add current call statement to the context, use clone
                         // to allocate scope graph pointer to avoid changing it
-                        contextStack.push_back(waitCntx);
+                        contextStack.pushCall(waitCntx, *callContexts);
                         auto waitCntxStack = contextStack.clone(inMainLoop);
                         waitContexts.push_back(waitCntxStack);
                         contextStack.pop_back();
@@ -1219,7 +1319,7 @@ void ScTraverseProc::run()
                                     loopStack.back().stmt, scopeGraph);
                         
                         // Store and null function context
-                        contextStack.push_back( *(lastContext.get()) );
+                        contextStack.pushCall(*(lastContext.get()), *callContexts);
                         
                         // Start called function with empty @delayed and loop stack
                         delayed.clear();
@@ -1958,7 +2058,7 @@ void ScTraverseProc::run()
             }
 
             // Store current context stack to analyze it after break/continue done
-            contextStack.push_back( *(lastContext.get()) );
+            contextStack.pushCall(*(lastContext.get()), *callContexts);
             ScProcContext currContextStack = contextStack;
             storedContextStacks.push_back(currContextStack); // TODO: add std::move
             lastContext = nullptr;
@@ -2130,29 +2230,32 @@ vector<ScProcContext>& ScTraverseProc::getWaitContexts() {
 }
 
 // Get evaluated terminator condition values
-// TODO: use std::move for #conds
-void ScTraverseProc::setTermConds(const unordered_map<CallStmtStack, SValue>& conds) 
+void ScTraverseProc::setTermConds(unordered_map<CallContextId, SValue> conds) 
 {
-    termConds = conds;
+    termConds = std::move(conds);
     if (DebugOptions::isEnabled(DebugComponent::doConstResult)) {
         cout << "termConds size " << termConds.size() << endl;
         for (auto& i : termConds) {
-            const Stmt* stmt = i.first.back();
+            const Stmt* stmt = callContexts->getStmt(i.first);
             cout << "    " << getFileName(stmt->getSourceRange().getBegin().printToString(sm)) 
                  <<  " : " << i.second.asString() << endl;
         }
     }
 }
 
-void ScTraverseProc::setConstEvalFuncs(const std::unordered_map<
-                                       CallStmtStack, SValue>& funcs) 
+void ScTraverseProc::setConstEvalFuncs(std::unordered_map<
+                                       CallContextId, SValue> funcs) 
 {
-    for (const auto& entry : funcs) {
+    // Remove not integer and not eligible functions in place
+    for (auto i = funcs.begin(); i != funcs.end(); ) {
         // Skip NO_VALUE first as it could be for non-function call
-        if (!entry.second.isInteger()) continue;
+        if (!i->second.isInteger()) {
+            i = funcs.erase(i);
+            continue;
+        }
         
-        SCT_TOOL_ASSERT (!entry.first.empty(), "Empty call stack");
-        auto callStmt = entry.first.back(); 
+        SCT_TOOL_ASSERT (i->first != CallContexts::ROOT_ID, "Empty call stack");
+        auto callStmt = callContexts->getStmt(i->first); 
         auto callExpr = dyn_cast<CallExpr>(callStmt);
         
         if (!callExpr) {
@@ -2160,10 +2263,13 @@ void ScTraverseProc::setConstEvalFuncs(const std::unordered_map<
         }
         // Skip functions with @wait()
         auto funcDecl = callExpr->getDirectCallee();
-        if (hasWaitFuncs.count(funcDecl) != 0) continue;
-
-        constEvalFuncs.insert(entry);
+        if (hasWaitFuncs.count(funcDecl) != 0) {
+            i = funcs.erase(i);
+            continue;
+        }
+        ++i;
     }
+    constEvalFuncs = std::move(funcs);
 }
 
 /// Report lack/extra sensitive to SS channels
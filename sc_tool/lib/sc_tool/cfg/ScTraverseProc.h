@@ -167,6 +167,9 @@ struct ScFuncContext {
     bool breakContext;
     /// Current function has all the branches stopped at wait() calls, no exit achieved
     bool noExitFunc;
+    /// Call context of the function called at @callPoint, set in push,
+    /// NO_ID if it is not created in CPA
+    CallContextId callId = CallContexts::NO_ID;
     
     /// Scope graph printer
     std::shared_ptr<ScScopeGraph> scopeGraph;
@@ -218,24 +221,34 @@ public:
         return cursorStack;
     }
     
-    CallStmtStack getStmtStack()
+    /// Push function context and find call context for its call point,
+    /// break/continue context has no call statement and gets NO_ID
+    void pushCall(const ScFuncContext& ctx, const CallContexts& contexts)
     {
-        using namespace clang;
-        CallStmtStack stmtStack;
-
-        for (auto& ctx : *this) {
-            auto& cursor = ctx.callPoint;
-            auto elm = cursor.getBlock()->operator [](cursor.getElementID());
-            
-            if (elm.getKind() == CFGElement::Kind::Statement) {
-                CFGStmt cfgstmt = elm.getAs<CFGStmt>().getValue();
-                stmtStack.push_back(cfgstmt.getStmt());
-                
-            } else {
-                SCT_TOOL_ASSERT (false, "Incorrect element kind");
-            }
-        }        
-        return stmtStack;
+        auto stmt = ctx.callPoint.getStmt();
+        CallContextId id = stmt ? 
+                           contexts.findId(getCallContext(), stmt) :
+                           CallContexts::NO_ID;
+        push_back(ctx);
+        back().callId = id;
+    }
+    
+    /// Get call context of the stack, NO_ID if it is not created in CPA
+    CallContextId getCallContext() const
+    {
+        return empty() ? CallContexts::ROOT_ID : back().callId;
+    }
+    
+    /// Find call context for call points of all the functions in the stack,
+    /// used to check context stored in the last function context
+    CallContextId findCallContext(const CallContexts& contexts) const
+    {
+        CallContextId id = CallContexts::ROOT_ID;
+        for (const auto& ctx : *this) {
+            auto stmt = ctx.callPoint.getStmt();
+            id = stmt ? contexts.findId(id, stmt) : CallContexts::NO_ID;
+        }
+        return id;
     }
     
     void printCursorStack() 
@@ -315,6 +328,9 @@ protected:
     /// Check if current function has wait() inside
     bool isWaitInCurrFunc() override;
     
+    /// Get call context of current function from the context stack
+    CallContextId getCallContext() const;
+    
     /// Get terminator condition from CPA stored in @termConds
     /// \param val  -- at all iterations including first
     /// \param fval -- at first iteration only, used for loop with wait()
@@ -353,6 +369,18 @@ protected:
     /// Remove sub-statements from generator
     void chooseExprMethod(clang::Stmt *stmt, SValue &val) override;
     
+    /// Get called function if the call should be generated as SV function call
+    /// \return function declaration or @nullptr
+    const clang::FunctionDecl* getSvFuncCallee(const clang::Stmt* stmt);
+    
+    /// Get name of SV function for pure function, generate the function 
+    /// in the module if it is not done yet
+    std::string getSvFuncName(const clang::FunctionDecl* callFuncDecl);
+    
+    /// Parse call arguments and put SV function call
+    void putSvFuncCall(clang::CallExpr* expr, 
+                       const clang::FunctionDecl* callFuncDecl);
+    
     /// Initialize analysis context at function entry
     void initContext();
     
@@ -400,19 +428,25 @@ public:
     /// Get wait contexts
     std::vector<ScProcContext>& getWaitContexts();
     
-    void setLiveStmts(const std::unordered_set<clang::Stmt*>& stmts) {
-        liveStmts = stmts;
+    void setLiveStmts(std::unordered_set<clang::Stmt*> stmts) {
+        liveStmts = std::move(stmts);
+    }
+    
+    void setLiveTerms(std::unordered_set<clang::Stmt*> stmts) {
+        liveTerms = std::move(stmts);
     }
     
-    void setLiveTerms(const std::unordered_set<clang::Stmt*>& stmts) {
-        liveTerms = stmts;
+    /// Set call contexts used as keys in terminator conditions and 
+    /// functions evaluated as constants
+    void setCallContexts(std::shared_ptr<CallContexts> contexts) {
+        callContexts = std::move(contexts);
     }
     
     /// Get evaluated terminator condition values
-    void setTermConds(const std::unordered_map<CallStmtStack, SValue>& conds);
+    void setTermConds(std::unordered_map<CallContextId, SValue> conds);
     
     /// Filter and set functions evaluated as constants
-    void setConstEvalFuncs(const std::unordered_map<CallStmtStack, SValue>& funcs);
+    void setConstEvalFuncs(std::unordered_map<CallContextId, SValue> funcs);
     
     /// Current process has reset signal
     void setHasReset(bool hasReset_) {
@@ -432,6 +466,11 @@ public:
         mainLoopStmt = stmt;
     }
     
+    /// Set module where SV functions for pure functions are generated 
+    void setVerilogModule(sc_elab::VerilogModule* verMod_) {
+        verMod = verMod_;
+    }
+    
     /// Report error for lack/extra sensitive to SS channels
     void reportSctChannel(sc_elab::ProcessView procView,
                           const clang::FunctionDecl* funcDecl);
@@ -499,13 +538,16 @@ protected:
     std::unordered_set<clang::Stmt*> liveStmts;    
     /// Live terminators, also includes switch cases/default
     std::unordered_set<clang::Stmt*> liveTerms;
+    /// Call contexts from ScTraverseConst
+    std::shared_ptr<CallContexts> callContexts = 
+                                  std::make_shared<CallContexts>();
     /// Evaluated terminator condition values, used in ScTraverseProc
     /// To distinguish FOR/WHILE first iteration loop terminator is 
-    /// placed into #CallStmtStack twice, and once for other iterations
-    std::unordered_map<CallStmtStack, SValue> termConds;
+    /// placed into call context twice, and once for other iterations
+    std::unordered_map<CallContextId, SValue> termConds;
     /// Functions evaluated as constants if stored SValue is integer or 
     /// not eligible if NO_VALUE stored
-    std::unordered_map<CallStmtStack, SValue> constEvalFuncs;
+    std::unordered_map<CallContextId, SValue> constEvalFuncs;
     
     /// THREAD wait states and constant propagation result providers
     const ScCThreadStates* cthreadStates = nullptr;
@@ -517,6 +559,8 @@ protected:
     bool hasReset;
     /// Main loop terminator for CTHREAD
     const clang::Stmt* mainLoopStmt = nullptr;
+    /// Module for SV functions generated for pure functions
+    sc_elab::VerilogModule* verMod = nullptr;
     /// PROC_STATE is not generated for threads with only a 1 state
     bool isSingleStateThread;
     /// Entered into main loop of CTHREAD process
@@ -0,0 +1,2900 @@
+/******************************************************************************
+ * Copyright (c) 2020, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/**
+ * Cycle-based C++ model generator.
+ */
+
+#include "sc_tool/cpp_model/ScCppModelWriter.h"
+#include "sc_tool/cpp_model/ScSvParser.h"
+
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace sc {
+
+using namespace sv;
+
+namespace {
+
+/// Maximal number of evaluations of combinational loop
+const unsigned COMB_LOOP_ITER_NUM = 100;
+
+/// Helper functions included into every model header
+const char* const MODEL_HELPERS = R"(
+#ifndef SCT_MODEL_HELPERS
+#define SCT_MODEL_HELPERS
+
+// Helper functions of generated cycle-based models
+namespace sct_model {
+
+template <unsigned W>
+inline int64_t sext(uint64_t x) {
+    return W >= 64 ? (int64_t)x : (int64_t)(x << (64-W)) >> (64-W);
+}
+
+template <unsigned W>
+inline uint64_t mask(uint64_t x) {
+    return W >= 64 ? x : x & ((1ULL << W) - 1);
+}
+
+template <class T>
+inline bool isZero(const T& x) { return x == 0; }
+
+// Result type of integer operation, operands have the same signedness
+template <class T, class U>
+using IntRes = typename std::enable_if<std::is_integral<T>::value &&
+                                       std::is_integral<U>::value,
+                                       std::common_type_t<T, U>>::type;
+
+template <class T, class U>
+inline IntRes<T, U> div(T a, U b) {
+    using R = IntRes<T, U>;
+    if (b == 0) return 0;
+    if (std::is_signed<R>::value && (R)b == (R)-1) {
+        return (R)(0 - (uint64_t)a);
+    }
+    return (R)a / (R)b;
+}
+
+template <class T, class U>
+inline IntRes<T, U> mod(T a, U b) {
+    using R = IntRes<T, U>;
+    if (b == 0 || (std::is_signed<R>::value && (R)b == (R)-1)) return 0;
+    return (R)a % (R)b;
+}
+
+template <class T>
+inline typename std::enable_if<std::is_integral<T>::value, T>::type
+shl(T a, uint64_t b) {
+    return b < 64 ? (T)((uint64_t)a << b) : 0;
+}
+
+inline uint64_t shr(uint64_t a, uint64_t b) {
+    return b < 64 ? a >> b : 0;
+}
+
+inline int64_t sra(int64_t a, uint64_t b) {
+    return b < 64 ? a >> b : (a < 0 ? -1 : 0);
+}
+
+template <class T>
+inline T pow(T a, uint64_t b) {
+    uint64_t r = 1;
+    for (uint64_t x = (uint64_t)a; b; b >>= 1, x *= x) if (b & 1) r *= x;
+    return (T)r;
+}
+
+inline uint64_t parity(uint64_t x) {
+    return __builtin_parityll(x);
+}
+
+template <class T>
+inline uint64_t bit(const T& x, uint64_t i) {
+    return i < 64 ? ((uint64_t)x >> i) & 1 : 0;
+}
+
+template <unsigned W, class T>
+inline uint64_t bits(const T& x, uint64_t i) {
+    return i < 64 ? mask<W>((uint64_t)x >> i) : 0;
+}
+
+// Write N bits starting from LO of variable with width W
+template <unsigned W, class T>
+inline void setbits(T& x, uint64_t lo, unsigned n, uint64_t v) {
+    if (lo >= W) return;
+    uint64_t m = (n >= 64 ? ~0ULL : (1ULL << n) - 1) << lo;
+    uint64_t r = ((uint64_t)x & ~m) | ((v << lo) & m);
+    x = std::is_signed<T>::value ? (T)sext<W>(r) : (T)mask<W>(r);
+}
+
+// Add D to variable with width W, narrow variable is kept canonical
+template <unsigned W, class T>
+inline T add(const T& x, int d) {
+    if constexpr (std::is_integral<T>::value) {
+        uint64_t r = (uint64_t)x + (uint64_t)(int64_t)d;
+        return std::is_signed<T>::value ? (T)sext<W>(r) : (T)mask<W>(r);
+    } else {
+        return T(x + d);
+    }
+}
+
+template <unsigned W, class T>
+inline T preinc(T& x) { return x = add<W>(x, 1); }
+
+template <unsigned W, class T>
+inline T predec(T& x) { return x = add<W>(x, -1); }
+
+template <unsigned W, class T>
+inline T postinc(T& x) { T r = x; x = add<W>(x, 1); return r; }
+
+template <unsigned W, class T>
+inline T postdec(T& x) { T r = x; x = add<W>(x, -1); return r; }
+
+template <unsigned N, unsigned W>
+inline uint64_t rep(uint64_t x) {
+    uint64_t r = 0;
+    for (unsigned i = 0; i < N; i++) r = (r << W) | x;
+    return r;
+}
+
+// Array element access, out of bound read returns zero, write is ignored
+template <class T, size_t N>
+inline T& at(std::array<T, N>& a, uint64_t i) {
+    static T dummy;
+    return i < N ? a[i] : (dummy = T());
+}
+
+template <class T, size_t N>
+inline const T& at(const std::array<T, N>& a, uint64_t i) {
+    static T dummy;
+    return i < N ? a[i] : (dummy = T());
+}
+
+template <class T, class V>
+inline void fill(T& x, const V& v) { x = v; }
+
+// Value assigned to variable modified in it by increment/decrement,
+// function call sequences the modification before the assignment
+template <class T>
+inline T val(T x) { return x; }
+
+template <class T, size_t N, class V>
+inline void fill(std::array<T, N>& a, const V& v) {
+    for (auto& x : a) fill(x, v);
+}
+
+}  // namespace sct_model
+
+#endif  // SCT_MODEL_HELPERS
+)";
+
+/// Helper functions for variables wider than 64 bit
+const char* const MODEL_BIG_HELPERS = R"(
+#ifndef SCT_MODEL_BIG_HELPERS
+#define SCT_MODEL_BIG_HELPERS
+
+namespace sct_model {
+
+inline bool isZero(const sc_dt::sc_unsigned& x) { return x.iszero(); }
+inline bool isZero(const sc_dt::sc_signed& x) { return x.iszero(); }
+
+inline sc_dt::sc_unsigned div(const sc_dt::sc_unsigned& a,
+                              const sc_dt::sc_unsigned& b) {
+    return b.iszero() ? sc_dt::sc_unsigned(a.length()) : a / b;
+}
+
+inline sc_dt::sc_signed div(const sc_dt::sc_signed& a,
+                            const sc_dt::sc_signed& b) {
+    return b.iszero() ? sc_dt::sc_signed(a.length()) : a / b;
+}
+
+inline sc_dt::sc_unsigned mod(const sc_dt::sc_unsigned& a,
+                              const sc_dt::sc_unsigned& b) {
+    return b.iszero() ? sc_dt::sc_unsigned(a.length()) : a % b;
+}
+
+inline sc_dt::sc_signed mod(const sc_dt::sc_signed& a,
+                            const sc_dt::sc_signed& b) {
+    return b.iszero() ? sc_dt::sc_signed(a.length()) : a % b;
+}
+
+inline sc_dt::sc_unsigned shl(const sc_dt::sc_unsigned& a, uint64_t b) {
+    return a << (sc_dt::uint64)b;
+}
+
+inline sc_dt::sc_signed shl(const sc_dt::sc_signed& a, uint64_t b) {
+    return a << (sc_dt::uint64)b;
+}
+
+inline sc_dt::sc_unsigned shr(const sc_dt::sc_unsigned& a, uint64_t b) {
+    return a >> (sc_dt::uint64)b;
+}
+
+inline sc_dt::sc_signed sra(const sc_dt::sc_signed& a, uint64_t b) {
+    return a >> (sc_dt::uint64)b;
+}
+
+// Big literal from 64bit words, least significant first,
+// part selection is not used as it can be called in static initialization
+template <int W>
+inline sc_dt::sc_biguint<W> big(std::initializer_list<uint64_t> words) {
+    sc_dt::sc_biguint<W> r = 0;
+    for (auto i = std::rbegin(words); i != std::rend(words); ++i) {
+        r = (r << 64) | sc_dt::sc_biguint<W>((sc_dt::uint64)*i);
+    }
+    return r;
+}
+
+template <unsigned W>
+inline uint64_t bit(const sc_dt::sc_unsigned& x, uint64_t i) {
+    return i < W ? (uint64_t)x[(int)i] : 0;
+}
+
+template <unsigned W>
+inline uint64_t bit(const sc_dt::sc_signed& x, uint64_t i) {
+    return i < W ? (uint64_t)x[(int)i] : 0;
+}
+
+// Bits [I+N-1 : I] of wide variable with width W
+template <unsigned W, unsigned N>
+inline sc_dt::sc_biguint<N> bits(const sc_dt::sc_unsigned& x, uint64_t i) {
+    return i < W ? sc_dt::sc_biguint<N>(x >> (sc_dt::uint64)i) :
+                   sc_dt::sc_biguint<N>(0);
+}
+
+template <unsigned W, unsigned N>
+inline sc_dt::sc_biguint<N> bits(const sc_dt::sc_signed& x, uint64_t i) {
+    return i < W ? sc_dt::sc_biguint<N>(sc_dt::sc_biguint<W>(x) >>
+                                        (sc_dt::uint64)i) :
+                   sc_dt::sc_biguint<N>(0);
+}
+
+template <unsigned W, class T, class V>
+inline void setbits(T& x, uint64_t lo, unsigned n, const V& v) {
+    if (lo >= W) return;
+    unsigned hi = std::min((unsigned)(lo + n - 1), W - 1);
+    x.range(hi, (int)lo) = sc_dt::sc_biguint<W>(v);
+}
+
+// Concatenation with width more than 64 bit
+template <unsigned W>
+inline void catPart(sc_dt::sc_biguint<W>&) {}
+
+template <unsigned W, unsigned N, unsigned... NS, class T, class... TS>
+inline void catPart(sc_dt::sc_biguint<W>& r, const T& x, const TS&... xs) {
+    r = (r << N) | sc_dt::sc_biguint<W>(sc_dt::sc_biguint<N>(x));
+    catPart<W, NS...>(r, xs...);
+}
+
+template <unsigned W, unsigned... NS, class... TS>
+inline sc_dt::sc_biguint<W> cat(const TS&... xs) {
+    sc_dt::sc_biguint<W> r = 0;
+    catPart<W, NS...>(r, xs...);
+    return r;
+}
+
+template <unsigned N, unsigned W, class T>
+inline sc_dt::sc_biguint<N * W> bigrep(const T& x) {
+    sc_dt::sc_biguint<N * W> r = 0;
+    sc_dt::sc_biguint<N * W> v = sc_dt::sc_biguint<W>(x);
+    for (unsigned i = 0; i < N; i++) r = (r << W) | v;
+    return r;
+}
+
+}  // namespace sct_model
+
+#endif  // SCT_MODEL_BIG_HELPERS
+)";
+
+//=============================================================================
+
+/// C++ keywords and model member names which cannot be used as variable
+const std::unordered_set<std::string> RESERVED_NAMES = {
+    "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor",
+    "bool", "break", "case", "catch", "char", "char16_t", "char32_t",
+    "class", "compl", "const", "constexpr", "const_cast", "continue",
+    "decltype", "default", "delete", "do", "double", "dynamic_cast", "else",
+    "enum", "explicit", "export", "extern", "false", "float", "for",
+    "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace",
+    "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or",
+    "or_eq", "private", "protected", "public", "register",
+    "reinterpret_cast", "return", "short", "signed", "sizeof", "static",
+    "static_assert", "static_cast", "struct", "switch", "template", "this",
+    "thread_local", "throw", "true", "try", "typedef", "typeid", "typename",
+    "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t",
+    "while", "xor", "xor_eq", "std", "sc_dt", "sct_model",
+    "eval", "clock", "clockBegin", "clockEnd", "evalComb", "asyncReset", 
+    "assert_errors", "assertFailed",
+    "int8_t", "int16_t", "int32_t", "int64_t",
+    "uint8_t", "uint16_t", "uint32_t", "uint64_t"
+};
+
+std::string maskLiteral(unsigned w)
+{
+    if (w >= 64) return "0xFFFFFFFFFFFFFFFFULL";
+    std::ostringstream os;
+    os << "0x" << std::hex << std::uppercase << ((1ULL << w) - 1) << "ULL";
+    return os.str();
+}
+
+/// Storage type of scalar variable
+std::string scalarType(unsigned width, bool isSigned)
+{
+    if (width > 64) {
+        return std::string(isSigned ? "sc_dt::sc_bigint<" :
+                           "sc_dt::sc_biguint<") + std::to_string(width) + ">";
+    }
+    unsigned bits = width <= 8 ? 8 : width <= 16 ? 16 : width <= 32 ? 32 : 64;
+    return std::string(isSigned ? "int" : "uint") + std::to_string(bits) +
+           "_t";
+}
+
+/// Storage type with unpacked dimensions starting from @dim
+std::string declType(const Decl& decl, size_t dim = 0)
+{
+    std::string type = scalarType(decl.width, decl.isSigned);
+    for (size_t i = decl.dims.size(); i > dim; i--) {
+        type = "std::array<" + type + ", " + std::to_string(decl.dims[i-1]) +
+               ">";
+    }
+    return type;
+}
+
+bool isExactStorage(unsigned width)
+{
+    return width == 8 || width == 16 || width == 32 || width == 64;
+}
+
+/// Integer literal of context type
+std::string intLiteral(uint64_t v, bool isSigned)
+{
+    if (!isSigned) return std::to_string(v) + "ULL";
+    int64_t s = (int64_t)v;
+    if (s == INT64_MIN) return "(-9223372036854775807LL - 1)";
+    return s < 0 ? "(" + std::to_string(s) + "LL)" : std::to_string(s) + "LL";
+}
+
+/// Value words extended to @width with sign extension if @isSigned
+std::vector<uint64_t> extendWords(const std::vector<uint64_t>& val,
+                                  unsigned valWidth, bool isSigned,
+                                  unsigned width)
+{
+    size_t num = (width + 63) / 64;
+    std::vector<uint64_t> res(num, 0);
+    for (size_t i = 0; i < num && i < val.size(); i++) res[i] = val[i];
+
+    // Truncate to literal width
+    for (size_t i = 0; i < num; i++) {
+        if (i*64 >= valWidth) {
+            res[i] = 0;
+        } else if (i*64 + 64 > valWidth) {
+            res[i] &= (1ULL << (valWidth - i*64)) - 1;
+        }
+    }
+    // Sign extension
+    if (isSigned && valWidth > 0) {
+        unsigned sb = valWidth - 1;
+        if (sb/64 < num && ((res[sb/64] >> (sb % 64)) & 1)) {
+            for (unsigned i = valWidth; i < num*64; i++) {
+                res[i/64] |= 1ULL << (i % 64);
+            }
+        }
+    }
+    // Truncate to result width
+    if (width % 64) {
+        res[num-1] &= (1ULL << (width % 64)) - 1;
+    }
+    return res;
+}
+
+/// Sign extension of @width bit value
+int64_t signExtend(uint64_t v, unsigned width)
+{
+    if (width == 0 || width >= 64) return (int64_t)v;
+    return (int64_t)(v << (64 - width)) >> (64 - width);
+}
+
+unsigned bitLength(const std::vector<uint64_t>& val)
+{
+    for (size_t i = val.size(); i > 0; i--) {
+        if (val[i-1]) {
+            unsigned n = 64;
+            while (!((val[i-1] >> (n-1)) & 1)) n--;
+            return (unsigned)(i-1)*64 + n;
+        }
+    }
+    return 0;
+}
+
+//=============================================================================
+
+struct Scope;
+
+/// Flattened variable or parameter
+struct VarRef
+{
+    const Decl* decl;
+    std::string name;
+    bool isPort = false;
+    PortDir dir = PortDir::Input;
+    /// Scalar parameter evaluated at generation time
+    bool isConst = false;
+    int64_t value = 0;
+    /// Shadow variable for non-blocking assignment
+    std::string shadow;
+};
+
+/// Flattened function
+struct FuncRef
+{
+    const Function* func;
+    const Scope* scope;
+    std::string name;
+    bool rwDone = false;
+    bool rwBusy = false;
+    std::set<size_t> reads;
+    std::set<size_t> writes;
+};
+
+/// Flattened process
+struct ProcRef
+{
+    const Process* proc;
+    const Scope* scope;
+    std::string name;
+    std::set<size_t> reads;
+    std::set<size_t> writes;
+    /// Non-blocking written variables
+    std::set<size_t> nbWrites;
+};
+
+/// Module instance in flattened hierarchy
+struct Scope
+{
+    const Module* mod;
+    const Scope* parent = nullptr;
+    std::string prefix;
+    std::string path;
+    /// Bound ports: port name to port declaration and expression in parent
+    std::unordered_map<std::string,
+                       std::pair<const Decl*, ExprPtr>> binds;
+    /// Variables, parameters and unbound ports
+    std::unordered_map<std::string, size_t> vars;
+    std::unordered_map<std::string, size_t> funcs;
+};
+
+/// Identifier resolution result
+struct Resolved
+{
+    enum Kind { Local, Member, Bound };
+
+    Kind kind;
+    const Decl* decl;
+    /// Local variable name
+    std::string name;
+    /// Member variable index
+    size_t var = 0;
+    /// Bound port expression and its scope
+    ExprPtr bound;
+    const Scope* scope = nullptr;
+};
+
+/// Self-determined expression code
+struct Leaf
+{
+    std::string code;
+    unsigned width;
+    bool isSigned;
+    /// Code type is uint64_t/int64_t, no cast required
+    bool is64 = false;
+};
+
+/// Assignment target
+struct Target
+{
+    enum Kind { Whole, Bits, BigBits };
+
+    Kind kind = Whole;
+    std::string code;
+    const Decl* decl = nullptr;
+    /// Scalar width and signedness of whole target
+    unsigned width = 1;
+    bool isSigned = false;
+    /// Remaining array dimensions
+    size_t dims = 0;
+    /// Bits: base variable width, low bit code and bit number
+    unsigned baseWidth = 0;
+    std::string lo;
+    unsigned bitNum = 1;
+};
+
+class ModelWriter
+{
+public:
+    ModelWriter(std::vector<Module> mods, bool scModule) :
+        mods(std::move(mods)), scModule(scModule)
+    {}
+
+    void run(const std::string& topName, std::ostream& os);
+
+private:
+    [[noreturn]] void error(unsigned line, const std::string& msg) const
+    {
+        std::string mod = cur ? " in module " + cur->mod->name : "";
+        throw SvParseError(line, msg + mod);
+    }
+
+    std::string uniqueName(const std::string& base)
+    {
+        std::string name = base;
+        if (RESERVED_NAMES.count(name)) name += "_";
+        std::string res = name;
+        for (unsigned i = 1; !usedNames.insert(res).second; i++) {
+            res = name + "_" + std::to_string(i);
+        }
+        return res;
+    }
+
+    static std::string localName(const std::string& name)
+    {
+        return RESERVED_NAMES.count(name) ? name + "_" : name;
+    }
+
+    //-------------------------------------------------------------------------
+    // Elaboration
+
+    void elaborate(const Module* mod, const Scope* parent,
+                   const std::string& prefix, const std::string& path,
+                   const Instance* inst);
+
+    //-------------------------------------------------------------------------
+    // Types and names
+
+    Resolved resolve(const std::string& name, unsigned line) const;
+    void typeOf(const ExprPtr& e);
+    size_t arrayDims(const ExprPtr& e);
+    unsigned constValue(const ExprPtr& e);
+    bool isConstant(const ExprPtr& e, int64_t& val);
+
+    //-------------------------------------------------------------------------
+    // Read and write sets
+
+    void collectStmt(const StmtPtr& st, std::set<size_t>& reads,
+                     std::set<size_t>& writes, std::set<size_t>* nbWrites);
+    void collectExpr(const ExprPtr& e, std::set<size_t>& reads,
+                     std::set<size_t>& writes);
+    void collectLhs(const ExprPtr& e, std::set<size_t>& reads,
+                    std::set<size_t>& writes, bool read);
+    void collectFunc(FuncRef& func);
+
+    //-------------------------------------------------------------------------
+    // Expressions
+
+    std::string memberName(size_t var, bool shadow) const;
+    Leaf emitLeaf(const ExprPtr& e);
+    std::string toContext(const Leaf& leaf, unsigned cw, bool cs);
+    std::string wrap(const std::string& code, unsigned cw, bool cs);
+    std::string emitCtx(const ExprPtr& e, unsigned cw, bool cs, bool exact);
+    std::string emitSelf(const ExprPtr& e, bool exact);
+    std::string emitCond(const ExprPtr& e);
+    std::string emitIndex(const ExprPtr& e);
+    std::string emitShift(const ExprPtr& e);
+    std::string emitArray(const ExprPtr& e);
+    std::string convert(const std::string& code, unsigned cw,
+                        unsigned width, bool isSigned);
+    std::string emitValue(const ExprPtr& e, const Decl& decl, size_t dim);
+    Target emitTarget(const ExprPtr& e);
+    std::string emitCall(const std::string& name, unsigned line,
+                         const std::vector<ExprPtr>& args);
+    std::string emitIncDec(const ExprPtr& e);
+    static bool hasIncDec(const ExprPtr& e);
+
+    //-------------------------------------------------------------------------
+    // Statements
+
+    void emitStmt(const StmtPtr& st, const std::string& ind);
+    void emitBody(const StmtPtr& st, const std::string& ind);
+    void emitDecl(const Decl& decl, const std::string& ind);
+    void emitAssign(const ExprPtr& lhs, const ExprPtr& rhs,
+                    const std::string& ind);
+    void emitFunction(const FuncRef& func);
+    void emitProcess(const ProcRef& proc);
+
+    void emitScModule(const Module* top, const std::string& modelName,
+                      std::ostream& os);
+
+    void pushLocals() { locals.emplace_back(); }
+    void popLocals() { locals.pop_back(); }
+    void addLocal(const Decl& decl)
+    {
+        locals.back()[decl.name] = &decl;
+        localNames.insert(localName(decl.name));
+    }
+    void collectLocalNames(const StmtPtr& st);
+    void collectReadNames(const StmtPtr& st);
+    void collectReadNames(const ExprPtr& e, bool lhs);
+
+private:
+    std::vector<Module> mods;
+    std::unordered_map<std::string, const Module*> modMap;
+
+    std::vector<std::unique_ptr<Scope>> scopes;
+    std::vector<VarRef> vars;
+    std::vector<FuncRef> funcs;
+    std::vector<ProcRef> combProcs;
+    std::vector<ProcRef> ffProcs;
+    std::unordered_set<std::string> usedNames;
+    /// Clock signals and edges
+    std::set<std::string> clocks;
+    bool negedgeClock = false;
+    bool bigUsed = false;
+    /// Generate SystemC module which runs the model in SC_METHODs
+    bool scModule;
+
+    /// Current scope, function and local variable scopes
+    const Scope* cur = nullptr;
+    const Function* curFunc = nullptr;
+    std::vector<std::unordered_map<std::string, const Decl*>> locals;
+    /// All local names of current function, used to detect shadowing
+    std::unordered_set<std::string> localNames;
+    /// Names read in current function, other local variables are only
+    /// assigned and declared as maybe unused
+    std::unordered_set<std::string> readNames;
+    /// Non-blocking assignment target is emitted
+    bool nbTarget = false;
+
+    /// Emitted member functions
+    std::ostringstream out;
+};
+
+//=============================================================================
+// Elaboration
+
+void ModelWriter::elaborate(const Module* mod, const Scope* parent,
+                            const std::string& prefix,
+                            const std::string& path, const Instance* inst)
+{
+    scopes.emplace_back(new Scope());
+    Scope* scope = scopes.back().get();
+    scope->mod = mod;
+    scope->parent = parent;
+    scope->prefix = prefix;
+    scope->path = path;
+
+    // Port bindings
+    if (inst) {
+        for (auto& bind : inst->binds) {
+            auto i = std::find_if(mod->ports.begin(), mod->ports.end(),
+                        [&](const Port& p) { return p.decl.name == bind.first; });
+            if (i == mod->ports.end()) {
+                cur = parent;
+                error(inst->line, "unknown port " + bind.first);
+            }
+            if (bind.second) {
+                scope->binds[bind.first] = {&i->decl, bind.second};
+            }
+        }
+    }
+    for (auto& port : mod->ports) {
+        if (scope->binds.count(port.decl.name)) continue;
+        VarRef var;
+        var.decl = &port.decl;
+        var.name = uniqueName(prefix + port.decl.name);
+        var.isPort = !parent;
+        var.dir = port.dir;
+        scope->vars[port.decl.name] = vars.size();
+        vars.push_back(var);
+    }
+
+    // Variables and parameters
+    std::vector<Decl> params;
+    for (auto& decl : mod->vars) {
+        VarRef var;
+        var.decl = &decl;
+        var.name = uniqueName(prefix + decl.name);
+        if (decl.isParam) {
+            params.push_back(decl);
+            var.isConst = decl.dims.empty() && decl.width <= 64 &&
+                          evalConst(decl.init, params, var.value);
+        }
+        scope->vars[decl.name] = vars.size();
+        vars.push_back(var);
+    }
+
+    for (auto& func : mod->funcs) {
+        FuncRef ref;
+        ref.func = &func;
+        ref.scope = scope;
+        ref.name = uniqueName(prefix + func.name);
+        scope->funcs[func.name] = funcs.size();
+        funcs.push_back(ref);
+    }
+
+    unsigned procNum = 0;
+    for (auto& proc : mod->procs) {
+        ProcRef ref;
+        ref.proc = &proc;
+        ref.scope = scope;
+        std::string name = proc.name.empty() ?
+                           "proc_" + std::to_string(procNum) : proc.name;
+        ref.name = uniqueName(prefix + name);
+        procNum++;
+        if (proc.kind == Process::Ff) {
+            ffProcs.push_back(ref);
+        } else {
+            combProcs.push_back(ref);
+        }
+    }
+
+    for (auto& child : mod->insts) {
+        auto i = modMap.find(child.moduleName);
+        if (i == modMap.end()) {
+            cur = scope;
+            error(child.line, "module " + child.moduleName + " not found, "
+                  "Verilog intrinsic modules are not supported");
+        }
+        elaborate(i->second, scope, prefix + child.name + "__",
+                  path + "." + child.name, &child);
+    }
+}
+
+//=============================================================================
+// Types and names
+
+Resolved ModelWriter::resolve(const std::string& name, unsigned line) const
+{
+    Resolved res;
+    for (auto i = locals.rbegin(); i != locals.rend(); ++i) {
+        auto j = i->find(name);
+        if (j != i->end()) {
+            res.kind = Resolved::Local;
+            res.decl = j->second;
+            res.name = localName(name);
+            return res;
+        }
+    }
+    auto b = cur->binds.find(name);
+    if (b != cur->binds.end()) {
+        res.kind = Resolved::Bound;
+        res.decl = b->second.first;
+        res.bound = b->second.second;
+        res.scope = cur->parent;
+        return res;
+    }
+    auto v = cur->vars.find(name);
+    if (v != cur->vars.end()) {
+        res.kind = Resolved::Member;
+        res.var = v->second;
+        res.decl = vars[v->second].decl;
+        return res;
+    }
+    error(line, "unknown identifier " + name);
+}
+
+unsigned ModelWriter::constValue(const ExprPtr& e)
+{
+    int64_t v;
+    if (!isConstant(e, v)) error(e->line, "constant expression expected");
+    return (unsigned)v;
+}
+
+bool ModelWriter::isConstant(const ExprPtr& e, int64_t& val)
+{
+    if (e->kind == ExprKind::Ident) {
+        Resolved r = resolve(e->op, e->line);
+        if (r.kind == Resolved::Member && vars[r.var].isConst) {
+            val = vars[r.var].value;
+            return true;
+        }
+        return false;
+    }
+    if (e->kind == ExprKind::Number) {
+        return evalConst(e, {}, val);
+    }
+    if (e->kind == ExprKind::Unary || e->kind == ExprKind::Binary) {
+        // Substitute parameters with their values
+        std::vector<Decl> params;
+        std::function<bool(const ExprPtr&)> collect =
+            [&](const ExprPtr& x) -> bool {
+            if (x->kind == ExprKind::Ident) {
+                int64_t v;
+                if (!isConstant(x, v)) return false;
+                Decl d;
+                d.name = x->op;
+                d.init = std::make_shared<Expr>(ExprKind::Number, x->line);
+                d.init->value.push_back((uint64_t)v);
+                d.init->isSigned = true;
+                params.push_back(d);
+                return true;
+            }
+            for (auto& a : x->args) if (!collect(a)) return false;
+            return true;
+        };
+        return collect(e) && evalConst(e, params, val);
+    }
+    return false;
+}
+
+size_t ModelWriter::arrayDims(const ExprPtr& e)
+{
+    if (e->kind == ExprKind::Ident) {
+        Resolved r = resolve(e->op, e->line);
+        return r.decl->dims.size();
+    }
+    if (e->kind == ExprKind::Index) {
+        size_t n = arrayDims(e->args[0]);
+        return n ? n-1 : 0;
+    }
+    return 0;
+}
+
+void ModelWriter::typeOf(const ExprPtr& e)
+{
+    if (e->selfWidth >= 0) return;
+    unsigned w = 1;
+    bool s = false;
+
+    switch (e->kind) {
+    case ExprKind::Ident: {
+        Resolved r = resolve(e->op, e->line);
+        w = r.decl->width;
+        s = r.decl->isSigned;
+        break;
+    }
+    case ExprKind::Number:
+        if (e->width) {
+            w = e->width;
+        } else {
+            w = std::max(32U, bitLength(e->value));
+        }
+        s = e->isSigned;
+        break;
+    case ExprKind::Fill:
+        w = 1;
+        break;
+    case ExprKind::Unary:
+        typeOf(e->args[0]);
+        if (e->op == "+" || e->op == "-" || e->op == "~") {
+            w = e->args[0]->selfWidth;
+            s = e->args[0]->selfSigned;
+        }
+        break;
+    case ExprKind::Binary: {
+        auto& a = e->args[0];
+        auto& b = e->args[1];
+        typeOf(a);
+        typeOf(b);
+        const std::string& op = e->op;
+        if (op == "+" || op == "-" || op == "*" || op == "/" || op == "%" ||
+            op == "&" || op == "|" || op == "^" || op == "~^") {
+            w = std::max(a->selfWidth, b->selfWidth);
+            s = a->selfSigned && b->selfSigned;
+        } else if (op == "<<" || op == ">>" || op == "<<<" || op == ">>>" ||
+                   op == "**") {
+            w = a->selfWidth;
+            s = a->selfSigned;
+        }
+        break;
+    }
+    case ExprKind::Ternary:
+        for (auto& a : e->args) typeOf(a);
+        w = std::max(e->args[1]->selfWidth, e->args[2]->selfWidth);
+        s = e->args[1]->selfSigned && e->args[2]->selfSigned;
+        break;
+    case ExprKind::Index:
+        typeOf(e->args[0]);
+        typeOf(e->args[1]);
+        if (arrayDims(e->args[0])) {
+            w = e->args[0]->selfWidth;
+            s = e->args[0]->selfSigned;
+        }
+        break;
+    case ExprKind::Range: {
+        typeOf(e->args[0]);
+        unsigned hi = constValue(e->args[1]);
+        unsigned lo = constValue(e->args[2]);
+        if (hi < lo) error(e->line, "incorrect range");
+        w = hi - lo + 1;
+        break;
+    }
+    case ExprKind::PartSel:
+        typeOf(e->args[0]);
+        typeOf(e->args[1]);
+        w = constValue(e->args[2]);
+        break;
+    case ExprKind::Concat:
+        w = 0;
+        for (auto& a : e->args) {
+            typeOf(a);
+            w += a->selfWidth;
+        }
+        break;
+    case ExprKind::Repl:
+        typeOf(e->args[1]);
+        w = constValue(e->args[0]) * e->args[1]->selfWidth;
+        break;
+    case ExprKind::Cast:
+        typeOf(e->args[0]);
+        if (e->width) {
+            w = e->width;
+            s = e->args[0]->selfSigned;
+        } else {
+            w = e->args[0]->selfWidth;
+            s = e->isSigned;
+        }
+        break;
+    case ExprKind::Call:
+        if (e->op == "$clog2" || e->op == "$bits") {
+            w = 32;
+            s = true;
+        } else {
+            auto i = cur->funcs.find(e->op);
+            if (i == cur->funcs.end()) {
+                error(e->line, "unknown function " + e->op);
+            }
+            const Function* f = funcs[i->second].func;
+            if (f->isVoid) error(e->line, "void function in expression");
+            w = f->result.width;
+            s = f->result.isSigned;
+        }
+        break;
+    case ExprKind::IncDec:
+        typeOf(e->args[0]);
+        w = e->args[0]->selfWidth;
+        s = e->args[0]->selfSigned;
+        break;
+    case ExprKind::Pattern:
+        w = 0;
+        break;
+    }
+    if (w == 0 && e->kind != ExprKind::Pattern) {
+        error(e->line, "zero width expression");
+    }
+    e->selfWidth = (int)w;
+    e->selfSigned = s;
+}
+
+//=============================================================================
+// Read and write sets
+
+void ModelWriter::collectLocalNames(const StmtPtr& st)
+{
+    if (!st) return;
+    if (st->kind == StmtKind::Decl) {
+        localNames.insert(localName(st->decl.name));
+    }
+    for (auto& s : st->stmts) collectLocalNames(s);
+    for (auto& i : st->items) collectLocalNames(i.body);
+    collectLocalNames(st->step);
+    collectLocalNames(st->body);
+}
+
+void ModelWriter::collectReadNames(const StmtPtr& st)
+{
+    if (!st) return;
+    if (st->kind == StmtKind::Assign) {
+        // Compound assignment reads its target
+        bool compound = st->name != "=" && st->name != "<=";
+        collectReadNames(st->lhs, !compound);
+    }
+    collectReadNames(st->decl.init, false);
+    collectReadNames(st->cond, false);
+    collectReadNames(st->rhs, false);
+    for (auto& a : st->args) collectReadNames(a, false);
+    for (auto& s : st->stmts) collectReadNames(s);
+    for (auto& i : st->items) {
+        for (auto& l : i.labels) collectReadNames(l, false);
+        collectReadNames(i.body);
+    }
+    collectReadNames(st->step);
+    collectReadNames(st->body);
+}
+
+void ModelWriter::collectReadNames(const ExprPtr& e, bool lhs)
+{
+    if (!e) return;
+    if (e->kind == ExprKind::Ident) {
+        if (!lhs) readNames.insert(e->op);
+        return;
+    }
+    // Assignment target base is not read, its indices are read
+    bool base = lhs && (e->kind == ExprKind::Index ||
+                        e->kind == ExprKind::Range ||
+                        e->kind == ExprKind::PartSel);
+    bool all = lhs && e->kind == ExprKind::Concat;
+    for (size_t i = 0; i < e->args.size(); i++) {
+        collectReadNames(e->args[i], all || (base && i == 0));
+    }
+}
+
+void ModelWriter::collectExpr(const ExprPtr& e, std::set<size_t>& reads,
+                              std::set<size_t>& writes)
+{
+    if (!e) return;
+    if (e->kind == ExprKind::Ident) {
+        Resolved r = resolve(e->op, e->line);
+        if (r.kind == Resolved::Member) {
+            reads.insert(r.var);
+        } else if (r.kind == Resolved::Bound) {
+            auto savedCur = cur;
+            auto savedLocals = std::move(locals);
+            locals.clear();
+            cur = r.scope;
+            collectExpr(r.bound, reads, writes);
+            cur = savedCur;
+            locals = std::move(savedLocals);
+        }
+        return;
+    }
+    if (e->kind == ExprKind::IncDec) {
+        collectLhs(e->args[0], reads, writes, true);
+        return;
+    }
+    if (e->kind == ExprKind::Call && e->op[0] != '$') {
+        auto i = cur->funcs.find(e->op);
+        if (i == cur->funcs.end()) error(e->line, "unknown function " + e->op);
+        FuncRef& func = funcs[i->second];
+        collectFunc(func);
+        reads.insert(func.reads.begin(), func.reads.end());
+        writes.insert(func.writes.begin(), func.writes.end());
+    }
+    for (auto& a : e->args) collectExpr(a, reads, writes);
+}
+
+void ModelWriter::collectLhs(const ExprPtr& e, std::set<size_t>& reads,
+                             std::set<size_t>& writes, bool read)
+{
+    if (e->kind == ExprKind::Ident) {
+        Resolved r = resolve(e->op, e->line);
+        if (r.kind == Resolved::Member) {
+            writes.insert(r.var);
+            if (read) reads.insert(r.var);
+        } else if (r.kind == Resolved::Bound) {
+            auto savedCur = cur;
+            auto savedLocals = std::move(locals);
+            locals.clear();
+            cur = r.scope;
+            collectLhs(r.bound, reads, writes, read);
+            cur = savedCur;
+            locals = std::move(savedLocals);
+        }
+        return;
+    }
+    if (e->kind == ExprKind::Index || e->kind == ExprKind::Range ||
+        e->kind == ExprKind::PartSel) {
+        collectLhs(e->args[0], reads, writes, read);
+        for (size_t i = 1; i < e->args.size(); i++) {
+            collectExpr(e->args[i], reads, writes);
+        }
+        return;
+    }
+    if (e->kind == ExprKind::Concat) {
+        for (auto& a : e->args) collectLhs(a, reads, writes, read);
+        return;
+    }
+    error(e->line, "unsupported assignment target");
+}
+
+void ModelWriter::collectStmt(const StmtPtr& st, std::set<size_t>& reads,
+                              std::set<size_t>& writes,
+                              std::set<size_t>* nbWrites)
+{
+    if (!st) return;
+
+    switch (st->kind) {
+    case StmtKind::Block:
+        pushLocals();
+        for (auto& s : st->stmts) collectStmt(s, reads, writes, nbWrites);
+        popLocals();
+        break;
+    case StmtKind::Decl:
+        collectExpr(st->decl.init, reads, writes);
+        addLocal(st->decl);
+        break;
+    case StmtKind::If:
+        collectExpr(st->cond, reads, writes);
+        for (auto& s : st->stmts) collectStmt(s, reads, writes, nbWrites);
+        break;
+    case StmtKind::Case:
+        collectExpr(st->cond, reads, writes);
+        for (auto& item : st->items) {
+            for (auto& l : item.labels) collectExpr(l, reads, writes);
+            collectStmt(item.body, reads, writes, nbWrites);
+        }
+        break;
+    case StmtKind::For:
+        pushLocals();
+        for (auto& s : st->stmts) collectStmt(s, reads, writes, nbWrites);
+        collectExpr(st->cond, reads, writes);
+        collectStmt(st->step, reads, writes, nbWrites);
+        collectStmt(st->body, reads, writes, nbWrites);
+        popLocals();
+        break;
+    case StmtKind::While:
+    case StmtKind::DoWhile:
+        collectExpr(st->cond, reads, writes);
+        collectStmt(st->body, reads, writes, nbWrites);
+        break;
+    case StmtKind::Return:
+        collectExpr(st->rhs, reads, writes);
+        break;
+    case StmtKind::Assign: {
+        bool compound = st->name != "=" && st->name != "<=";
+        if (st->name == "<=" && nbWrites) {
+            std::set<size_t> nbw;
+            collectLhs(st->lhs, reads, nbw, false);
+            nbWrites->insert(nbw.begin(), nbw.end());
+            writes.insert(nbw.begin(), nbw.end());
+        } else {
+            collectLhs(st->lhs, reads, writes, compound);
+        }
+        collectExpr(st->rhs, reads, writes);
+        break;
+    }
+    case StmtKind::ExprStmt:
+    case StmtKind::Assert:
+        collectExpr(st->rhs, reads, writes);
+        collectExpr(st->cond, reads, writes);
+        break;
+    case StmtKind::Call: {
+        auto i = cur->funcs.find(st->name);
+        if (i == cur->funcs.end()) {
+            error(st->line, "unknown function " + st->name);
+        }
+        FuncRef& func = funcs[i->second];
+        collectFunc(func);
+        reads.insert(func.reads.begin(), func.reads.end());
+        writes.insert(func.writes.begin(), func.writes.end());
+        for (auto& a : st->args) collectExpr(a, reads, writes);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void ModelWriter::collectFunc(FuncRef& func)
+{
+    if (func.rwDone) return;
+    if (func.rwBusy) {
+        error(func.func->line, "recursive function " + func.func->name);
+    }
+    func.rwBusy = true;
+
+    auto savedCur = cur;
+    auto savedFunc = curFunc;
+    auto savedLocals = std::move(locals);
+    locals.clear();
+    cur = func.scope;
+    curFunc = func.func;
+
+    pushLocals();
+    for (auto& p : func.func->params) addLocal(p.decl);
+    if (!func.func->isVoid) addLocal(func.func->result);
+    collectStmt(func.func->body, func.reads, func.writes, nullptr);
+    popLocals();
+
+    cur = savedCur;
+    curFunc = savedFunc;
+    locals = std::move(savedLocals);
+    func.rwBusy = false;
+    func.rwDone = true;
+}
+
+//=============================================================================
+// Expressions
+
+std::string ModelWriter::memberName(size_t var, bool shadow) const
+{
+    const VarRef& v = vars[var];
+    if (shadow && !v.shadow.empty()) return v.shadow;
+    return localNames.count(v.name) ? "this->" + v.name : v.name;
+}
+
+std::string ModelWriter::wrap(const std::string& code, unsigned cw, bool cs)
+{
+    if (cw > 64) {
+        return std::string(cs ? "sc_dt::sc_bigint<" : "sc_dt::sc_biguint<") +
+               std::to_string(cw) + ">(" + code + ")";
+    }
+    if (cw == 64) return std::string(cs ? "(int64_t)(" : "(uint64_t)(") +
+                         code + ")";
+    if (cs) {
+        return "sct_model::sext<" + std::to_string(cw) + ">(" + code + ")";
+    }
+    return "(" + code + " & " + maskLiteral(cw) + ")";
+}
+
+std::string ModelWriter::toContext(const Leaf& leaf, unsigned cw, bool cs)
+{
+    if (cw <= 64) {
+        if (cs) {
+            return leaf.is64 ? leaf.code : "(int64_t)(" + leaf.code + ")";
+        }
+        if (leaf.isSigned) {
+            std::string c = "(uint64_t)(" + leaf.code + ")";
+            return leaf.width >= 64 ? c :
+                   "(" + c + " & " + maskLiteral(leaf.width) + ")";
+        }
+        return leaf.is64 ? leaf.code : "(uint64_t)(" + leaf.code + ")";
+    }
+
+    std::string w = std::to_string(cw);
+    if (cs) {
+        if (leaf.width > 64) return leaf.code;
+        return "sc_dt::sc_bigint<" + w + ">((int64_t)(" + leaf.code + "))";
+    }
+    if (leaf.width > 64) {
+        return leaf.isSigned ? "sc_dt::sc_biguint<" + w + ">(" +
+                               "sc_dt::sc_biguint<" +
+                               std::to_string(leaf.width) + ">(" +
+                               leaf.code + "))" : leaf.code;
+    }
+    Leaf l = leaf;
+    return "sc_dt::sc_biguint<" + w + ">(" + toContext(l, 64, false) + ")";
+}
+
+std::string ModelWriter::emitSelf(const ExprPtr& e, bool exact)
+{
+    typeOf(e);
+    return emitCtx(e, e->selfWidth, e->selfSigned, exact);
+}
+
+std::string ModelWriter::emitCond(const ExprPtr& e)
+{
+    typeOf(e);
+    // Logical and relational operators give bool, no conversion required
+    bool isBool = (e->kind == ExprKind::Unary && e->op != "+" &&
+                   e->op != "-" && e->op != "~" && e->op != "^" &&
+                   e->op != "~^") ||
+                  (e->kind == ExprKind::Binary &&
+                   (e->op == "&&" || e->op == "||" || e->op == "==" ||
+                    e->op == "!=" || e->op == "<" || e->op == "<=" ||
+                    e->op == ">" || e->op == ">="));
+    if (isBool) return emitLeaf(e).code;
+    std::string c = emitSelf(e, true);
+    if (e->selfWidth > 64) return "!sct_model::isZero(" + c + ")";
+    return c;
+}
+
+std::string ModelWriter::emitIndex(const ExprPtr& e)
+{
+    typeOf(e);
+    int64_t v;
+    if (isConstant(e, v)) {
+        return std::to_string((uint64_t)v) + "ULL";
+    }
+    if (e->selfWidth > 64) {
+        return "(" + emitSelf(e, true) + ").to_uint64()";
+    }
+    Leaf l;
+    l.code = emitSelf(e, true);
+    l.width = e->selfWidth;
+    l.isSigned = e->selfSigned;
+    l.is64 = true;
+    return l.isSigned ? "(uint64_t)(" + l.code + ")" : l.code;
+}
+
+std::string ModelWriter::emitShift(const ExprPtr& e)
+{
+    return emitIndex(e);
+}
+
+std::string ModelWriter::emitArray(const ExprPtr& e)
+{
+    if (e->kind == ExprKind::Ident) {
+        Resolved r = resolve(e->op, e->line);
+        if (r.kind == Resolved::Local) return r.name;
+        if (r.kind == Resolved::Member) return memberName(r.var, nbTarget);
+
+        auto savedCur = cur;
+        auto savedLocals = std::move(locals);
+        locals.clear();
+        cur = r.scope;
+        std::string res = emitArray(r.bound);
+        cur = savedCur;
+        locals = std::move(savedLocals);
+        return res;
+    }
+    if (e->kind == ExprKind::Index) {
+        bool savedNb = nbTarget;
+        std::string base = emitArray(e->args[0]);
+        nbTarget = false;
+        std::string idx = emitIndex(e->args[1]);
+        nbTarget = savedNb;
+        return "sct_model::at(" + base + ", " + idx + ")";
+    }
+    error(e->line, "array expected");
+}
+
+Leaf ModelWriter::emitLeaf(const ExprPtr& e)
+{
+    typeOf(e);
+    Leaf leaf;
+    leaf.width = e->selfWidth;
+    leaf.isSigned = e->selfSigned;
+    const std::string& op = e->op;
+
+    switch (e->kind) {
+    case ExprKind::Ident: {
+        Resolved r = resolve(op, e->line);
+        if (r.kind == Resolved::Bound) {
+            auto savedCur = cur;
+            auto savedLocals = std::move(locals);
+            locals.clear();
+            cur = r.scope;
+            Leaf res = emitLeaf(r.bound);
+            cur = savedCur;
+            locals = std::move(savedLocals);
+            // Port declaration type is used
+            res.width = leaf.width;
+            res.isSigned = leaf.isSigned;
+            res.is64 = res.is64 && leaf.width <= 64;
+            return res;
+        }
+        if (!r.decl->dims.empty()) {
+            error(e->line, "array " + op + " used in expression");
+        }
+        if (r.kind == Resolved::Local) {
+            leaf.code = r.name;
+        } else {
+            const VarRef& v = vars[r.var];
+            if (v.isConst) {
+                leaf.code = intLiteral((uint64_t)v.value, leaf.isSigned);
+                leaf.is64 = true;
+                return leaf;
+            }
+            leaf.code = memberName(r.var, false);
+        }
+        leaf.is64 = r.decl->width > 32 && r.decl->width <= 64 &&
+                    r.decl->dims.empty();
+        return leaf;
+    }
+    case ExprKind::Index: {
+        if (arrayDims(e->args[0])) {
+            // Not all dimensions indexed, element is unpacked array itself
+            if (size_t rest = arrayDims(e)) {
+                ExprPtr base = e;
+                size_t indices = 0;
+                while (base->kind == ExprKind::Index) {
+                    base = base->args[0]; indices++;
+                }
+                error(e->line, "array " + base->op + " indexed with " + 
+                      std::to_string(indices) + " of " + 
+                      std::to_string(indices + rest) + " dimensions is "
+                      "used in expression, unpacked array value is "
+                      "not supported");
+            }
+            leaf.code = emitArray(e);
+            leaf.is64 = leaf.width > 32 && leaf.width <= 64;
+            return leaf;
+        }
+        const ExprPtr& base = e->args[0];
+        typeOf(base);
+        std::string b = emitSelf(base, true);
+        std::string i = emitIndex(e->args[1]);
+        if (base->selfWidth > 64) {
+            leaf.code = "sct_model::bit<" + std::to_string(base->selfWidth) +
+                        ">(" + b + ", " + i + ")";
+        } else {
+            leaf.code = "sct_model::bit(" + b + ", " + i + ")";
+        }
+        leaf.is64 = true;
+        return leaf;
+    }
+    case ExprKind::Range:
+    case ExprKind::PartSel: {
+        const ExprPtr& base = e->args[0];
+        typeOf(base);
+        std::string b = emitSelf(base, true);
+        std::string lo;
+        if (e->kind == ExprKind::Range) {
+            lo = std::to_string(constValue(e->args[2]));
+        } else if (op == "+:") {
+            lo = emitIndex(e->args[1]);
+        } else {
+            lo = "(" + emitIndex(e->args[1]) + " - " +
+                 std::to_string(leaf.width - 1) + ")";
+        }
+        std::string w = std::to_string(leaf.width);
+        if (base->selfWidth > 64) {
+            bigUsed = true;
+            std::string bits = "sct_model::bits<" +
+                               std::to_string(base->selfWidth) + ", " + w +
+                               ">(" + b + ", " + lo + ")";
+            leaf.code = leaf.width > 64 ? bits : bits + ".to_uint64()";
+        } else if (e->kind == ExprKind::Range && !base->selfSigned) {
+            std::string sh = lo == "0" ? b : "(" + b + " >> " + lo + ")";
+            leaf.code = leaf.width >= (unsigned)base->selfWidth ? sh :
+                        "(" + sh + " & " + maskLiteral(leaf.width) + ")";
+        } else {
+            leaf.code = "sct_model::bits<" + w + ">(" + b + ", " + lo + ")";
+        }
+        leaf.is64 = leaf.width <= 64 && !leaf.code.empty() &&
+                    (e->kind != ExprKind::Range || base->selfSigned ||
+                     base->selfWidth > 64 || leaf.code != b ||
+                     base->selfWidth > 32);
+        return leaf;
+    }
+    case ExprKind::Concat: {
+        if (leaf.width > 64) {
+            bigUsed = true;
+            std::string widths, parts;
+            for (auto& a : e->args) {
+                widths += ", " + std::to_string(a->selfWidth);
+                parts += std::string(parts.empty() ? "" : ", ") +
+                         emitSelf(a, true);
+            }
+            leaf.code = "sct_model::cat<" + std::to_string(leaf.width) +
+                        widths + ">(" + parts + ")";
+            return leaf;
+        }
+        unsigned lo = leaf.width;
+        std::string code;
+        for (auto& a : e->args) {
+            lo -= a->selfWidth;
+            if (a->kind == ExprKind::Number && bitLength(a->value) == 0) {
+                continue;
+            }
+            Leaf part;
+            part.code = emitSelf(a, true);
+            part.width = a->selfWidth;
+            part.isSigned = a->selfSigned;
+            part.is64 = true;
+            std::string c = toContext(part, 64, false);
+            if (lo) c = "(" + c + " << " + std::to_string(lo) + ")";
+            code += std::string(code.empty() ? "" : " | ") + c;
+        }
+        leaf.code = code.empty() ? "0ULL" : "(" + code + ")";
+        leaf.is64 = true;
+        return leaf;
+    }
+    case ExprKind::Repl: {
+        const ExprPtr& c = e->args[1];
+        unsigned n = constValue(e->args[0]);
+        std::string inner = emitSelf(c, true);
+        if (leaf.width > 64) {
+            bigUsed = true;
+            leaf.code = "sct_model::bigrep<" + std::to_string(n) + ", " +
+                        std::to_string(c->selfWidth) + ">(" + inner + ")";
+        } else {
+            leaf.code = "sct_model::rep<" + std::to_string(n) + ", " +
+                        std::to_string(c->selfWidth) + ">(" + inner + ")";
+            leaf.is64 = true;
+        }
+        return leaf;
+    }
+    case ExprKind::Cast: {
+        const ExprPtr& a = e->args[0];
+        if (e->width) {
+            // Size cast, argument is extended or truncated
+            unsigned cw = std::max(e->width, (unsigned)a->selfWidth);
+            std::string c = emitCtx(a, cw, a->selfSigned, false);
+            if (e->width > 64) {
+                leaf.code = wrap(c, e->width, leaf.isSigned);
+            } else {
+                if (cw > 64) {
+                    c = "(" + c + ").to_uint64()";
+                    if (leaf.isSigned) c = "(int64_t)" + c;
+                }
+                leaf.code = wrap(c, e->width, leaf.isSigned);
+                leaf.is64 = true;
+            }
+        } else {
+            std::string c = emitSelf(a, true);
+            if (leaf.isSigned == a->selfSigned) {
+                leaf.code = c;
+                leaf.is64 = true;
+            } else if (leaf.width > 64) {
+                leaf.code = wrap(c, leaf.width, leaf.isSigned);
+            } else if (leaf.isSigned) {
+                leaf.code = wrap(c, leaf.width, true);
+                leaf.is64 = true;
+            } else {
+                leaf.code = wrap("(uint64_t)(" + c + ")", leaf.width, false);
+                leaf.is64 = true;
+            }
+        }
+        return leaf;
+    }
+    case ExprKind::Call: {
+        if (op == "$clog2") {
+            leaf.code = intLiteral(constValue(e), true);
+            leaf.is64 = true;
+            return leaf;
+        }
+        if (op == "$bits") {
+            if (e->args.size() != 1) error(e->line, "incorrect $bits");
+            typeOf(e->args[0]);
+            leaf.code = intLiteral(e->args[0]->selfWidth, true);
+            leaf.is64 = true;
+            return leaf;
+        }
+        leaf.code = emitCall(op, e->line, e->args);
+        leaf.is64 = leaf.width > 32 && leaf.width <= 64;
+        return leaf;
+    }
+    case ExprKind::IncDec:
+        leaf.code = emitIncDec(e);
+        leaf.is64 = leaf.width > 32 && leaf.width <= 64;
+        return leaf;
+
+    case ExprKind::Unary: {
+        // Logical not and reductions
+        const ExprPtr& a = e->args[0];
+        if (op == "!") {
+            leaf.code = "(!" + emitCond(a) + ")";
+            return leaf;
+        }
+        std::string c = emitSelf(a, true);
+        std::string f;
+        if (a->selfWidth > 64) {
+            std::string v = a->selfSigned ?
+                "sc_dt::sc_biguint<" + std::to_string(a->selfWidth) + ">(" +
+                c + ")" : c;
+            f = op == "&" || op == "~&" ? "and_reduce" :
+                op == "|" || op == "~|" ? "or_reduce" : "xor_reduce";
+            leaf.code = "(" + v + ")." + f + "()";
+        } else {
+            Leaf l;
+            l.code = c;
+            l.width = a->selfWidth;
+            l.isSigned = a->selfSigned;
+            l.is64 = true;
+            std::string v = toContext(l, 64, false);
+            if (op == "&" || op == "~&") {
+                leaf.code = "(" + v + " == " + maskLiteral(l.width) + ")";
+            } else if (op == "|" || op == "~|") {
+                leaf.code = "(" + v + " != 0)";
+            } else {
+                leaf.code = "sct_model::parity(" + v + ")";
+                leaf.is64 = true;
+            }
+        }
+        if (op[0] == '~') {
+            leaf.code = "(!" + leaf.code + ")";
+            leaf.is64 = false;
+        }
+        return leaf;
+    }
+    case ExprKind::Binary: {
+        // Relational and logical operators
+        const ExprPtr& a = e->args[0];
+        const ExprPtr& b = e->args[1];
+        if (op == "&&" || op == "||") {
+            leaf.code = "(" + emitCond(a) + " " + op + " " + emitCond(b) + ")";
+            return leaf;
+        }
+        unsigned cw = std::max(a->selfWidth, b->selfWidth);
+        bool cs = a->selfSigned && b->selfSigned;
+        leaf.code = "(" + emitCtx(a, cw, cs, true) + " " + op + " " +
+                    emitCtx(b, cw, cs, true) + ")";
+        return leaf;
+    }
+    default:
+        error(e->line, "unsupported expression");
+    }
+}
+
+std::string ModelWriter::emitCtx(const ExprPtr& e, unsigned cw, bool cs,
+                                 bool exact)
+{
+    typeOf(e);
+    if (cw > 64) bigUsed = true;
+    const std::string& op = e->op;
+
+    switch (e->kind) {
+    case ExprKind::Number:
+    case ExprKind::Fill: {
+        std::vector<uint64_t> val;
+        if (e->kind == ExprKind::Fill) {
+            val = extendWords(e->value, 1, e->value[0] != 0, cw);
+        } else {
+            val = extendWords(e->value, e->selfWidth, e->selfSigned, cw);
+        }
+        if (cw <= 64) {
+            uint64_t v = val[0];
+            if (cs) v = (uint64_t)signExtend(v, cw);
+            return intLiteral(v, cs);
+        }
+        std::string words;
+        for (auto w : val) {
+            words += std::string(words.empty() ? "" : ", ") +
+                     std::to_string(w) + "ULL";
+        }
+        std::string c = "sct_model::big<" + std::to_string(cw) + ">({" +
+                        words + "})";
+        return cs ? wrap(c, cw, true) : c;
+    }
+    case ExprKind::Unary:
+        if (op == "+") {
+            return emitCtx(e->args[0], cw, cs, exact);
+        }
+        if (op == "-" || op == "~") {
+            std::string c = "(" + op + emitCtx(e->args[0], cw, cs, false) +
+                            ")";
+            return exact ? wrap(c, cw, cs) : c;
+        }
+        break;
+
+    case ExprKind::Binary: {
+        const ExprPtr& a = e->args[0];
+        const ExprPtr& b = e->args[1];
+        if (op == "+" || op == "-" || op == "*") {
+            std::string c = "(" + emitCtx(a, cw, cs, false) + " " + op + " " +
+                            emitCtx(b, cw, cs, false) + ")";
+            return exact ? wrap(c, cw, cs) : c;
+        }
+        if (op == "&" || op == "|" || op == "^") {
+            return "(" + emitCtx(a, cw, cs, exact) + " " + op + " " +
+                   emitCtx(b, cw, cs, exact) + ")";
+        }
+        if (op == "~^") {
+            std::string c = "(~(" + emitCtx(a, cw, cs, false) + " ^ " +
+                            emitCtx(b, cw, cs, false) + "))";
+            return exact ? wrap(c, cw, cs) : c;
+        }
+        if (op == "/" || op == "%") {
+            std::string ca = emitCtx(a, cw, cs, true);
+            std::string cb = emitCtx(b, cw, cs, true);
+            if (cw > 64) {
+                ca = wrap(ca, cw, cs);
+                cb = wrap(cb, cw, cs);
+            }
+            std::string c = std::string(op == "/" ? "sct_model::div(" :
+                            "sct_model::mod(") + ca + ", " + cb + ")";
+            return cw > 64 ? wrap(c, cw, cs) : c;
+        }
+        if (op == "**") {
+            std::string c = "sct_model::pow(" + emitCtx(a, cw, cs, false) +
+                            ", " + emitShift(b) + ")";
+            if (cw > 64) error(e->line, "power for wide operand");
+            return exact ? wrap(c, cw, cs) : c;
+        }
+        if (op == "<<" || op == "<<<") {
+            std::string ca = emitCtx(a, cw, cs, false);
+            int64_t sh;
+            std::string c;
+            if (cw <= 64 && isConstant(b, sh) && sh >= 0 && sh < 64) {
+                c = "(" + ca + " << " + std::to_string(sh) + ")";
+            } else {
+                if (cw > 64) ca = wrap(ca, cw, cs);
+                c = "sct_model::shl(" + ca + ", " + emitShift(b) + ")";
+            }
+            return exact || cw > 64 ? wrap(c, cw, cs) : c;
+        }
+        if (op == ">>" || op == ">>>") {
+            std::string ca = emitCtx(a, cw, cs, true);
+            int64_t sh;
+            bool constSh = cw <= 64 && isConstant(b, sh) && sh >= 0 &&
+                           sh < 64;
+            std::string sb = constSh ? std::to_string(sh) : emitShift(b);
+            if (cs && op == ">>>") {
+                if (cw > 64) {
+                    return wrap("sct_model::sra(" + wrap(ca, cw, true) +
+                                ", " + sb + ")", cw, true);
+                }
+                return constSh ? "(" + ca + " >> " + sb + ")" :
+                                 "sct_model::sra(" + ca + ", " + sb + ")";
+            }
+            if (cs) {
+                // Logical shift of signed operand
+                std::string u = cw > 64 ? wrap(ca, cw, false) :
+                                wrap("(uint64_t)(" + ca + ")", cw, false);
+                std::string c = "sct_model::shr(" + u + ", " + sb + ")";
+                return cw > 64 ? wrap(c, cw, true) :
+                       wrap("(int64_t)" + c, cw, true);
+            }
+            if (cw > 64) {
+                return wrap("sct_model::shr(" + wrap(ca, cw, false) + ", " +
+                            sb + ")", cw, false);
+            }
+            return constSh ? "(" + ca + " >> " + sb + ")" :
+                             "sct_model::shr(" + ca + ", " + sb + ")";
+        }
+        break;
+    }
+    case ExprKind::Ternary: {
+        std::string c = emitCond(e->args[0]);
+        std::string a = emitCtx(e->args[1], cw, cs, exact);
+        std::string b = emitCtx(e->args[2], cw, cs, exact);
+        if (cw > 64) {
+            a = wrap(a, cw, cs);
+            b = wrap(b, cw, cs);
+        }
+        return "(" + c + " ? " + a + " : " + b + ")";
+    }
+    default:
+        break;
+    }
+
+    // Self-determined operand
+    Leaf leaf = emitLeaf(e);
+    return toContext(leaf, cw, cs);
+}
+
+std::string ModelWriter::convert(const std::string& code, unsigned cw,
+                                 unsigned width, bool isSigned)
+{
+    std::string type = scalarType(width, isSigned);
+    if (width > 64) {
+        return type + "(" + code + ")";
+    }
+    std::string c = code;
+    if (cw > 64) {
+        c = "(" + c + ").to_uint64()";
+    }
+    if (isExactStorage(width)) {
+        return "(" + type + ")(" + c + ")";
+    }
+    if (isSigned) {
+        return "(" + type + ")sct_model::sext<" + std::to_string(width) +
+               ">(" + c + ")";
+    }
+    return "(" + type + ")(" + c + " & " + maskLiteral(width) + ")";
+}
+
+std::string ModelWriter::emitValue(const ExprPtr& e, const Decl& decl,
+                                   size_t dim)
+{
+    if (dim < decl.dims.size()) {
+        std::string type = declType(decl, dim);
+        if (e->kind == ExprKind::Pattern && e->op != "default") {
+            if (e->args.size() != decl.dims[dim]) {
+                error(e->line, "incorrect number of array elements");
+            }
+            std::string res = type + "{{";
+            for (size_t i = 0; i < e->args.size(); i++) {
+                res += std::string(i ? ", " : "") +
+                       emitValue(e->args[i], decl, dim+1);
+            }
+            return res + "}}";
+        }
+        if (e->kind == ExprKind::Pattern || e->kind == ExprKind::Fill) {
+            const ExprPtr& v = e->kind == ExprKind::Pattern ? e->args[0] : e;
+            std::string res = type + "{{";
+            for (size_t i = 0; i < decl.dims[dim]; i++) {
+                res += std::string(i ? ", " : "") + emitValue(v, decl, dim+1);
+            }
+            return res + "}}";
+        }
+        return emitArray(e);
+    }
+
+    typeOf(e);
+    unsigned cw = std::max(decl.width, (unsigned)e->selfWidth);
+    int64_t v;
+    if (cw <= 64 && e->kind != ExprKind::Fill && isConstant(e, v)) {
+        // Constant is converted at generation time
+        uint64_t u = (uint64_t)v;
+        if (decl.width < 64) u &= (1ULL << decl.width) - 1;
+        if (decl.isSigned) u = (uint64_t)signExtend(u, decl.width);
+        return "(" + scalarType(decl.width, decl.isSigned) + ")" +
+               intLiteral(u, decl.isSigned);
+    }
+    std::string c = emitCtx(e, cw, e->selfSigned, false);
+    return convert(c, cw, decl.width, decl.isSigned);
+}
+
+Target ModelWriter::emitTarget(const ExprPtr& e)
+{
+    Target t;
+    if (e->kind == ExprKind::Ident) {
+        Resolved r = resolve(e->op, e->line);
+        if (r.kind == Resolved::Bound) {
+            auto savedCur = cur;
+            auto savedLocals = std::move(locals);
+            locals.clear();
+            cur = r.scope;
+            t = emitTarget(r.bound);
+            cur = savedCur;
+            locals = std::move(savedLocals);
+            return t;
+        }
+        t.code = r.kind == Resolved::Local ? r.name :
+                 memberName(r.var, nbTarget);
+        if (r.kind == Resolved::Member && vars[r.var].isConst) {
+            error(e->line, "assignment to parameter " + e->op);
+        }
+        t.decl = r.decl;
+        t.width = r.decl->width;
+        t.isSigned = r.decl->isSigned;
+        t.dims = r.decl->dims.size();
+        return t;
+    }
+    if (e->kind == ExprKind::Index) {
+        Target base = emitTarget(e->args[0]);
+        bool savedNb = nbTarget;
+        nbTarget = false;
+        std::string idx = emitIndex(e->args[1]);
+        nbTarget = savedNb;
+        if (base.kind != Target::Whole) {
+            error(e->line, "unsupported assignment target");
+        }
+        if (base.dims) {
+            base.code = "sct_model::at(" + base.code + ", " + idx + ")";
+            base.dims--;
+            return base;
+        }
+        t.kind = base.width > 64 ? Target::BigBits : Target::Bits;
+        t.code = base.code;
+        t.baseWidth = base.width;
+        t.isSigned = base.isSigned;
+        t.lo = idx;
+        t.bitNum = 1;
+        t.width = 1;
+        return t;
+    }
+    if (e->kind == ExprKind::Range || e->kind == ExprKind::PartSel) {
+        Target base = emitTarget(e->args[0]);
+        if (base.kind != Target::Whole || base.dims) {
+            error(e->line, "unsupported assignment target");
+        }
+        bool savedNb = nbTarget;
+        nbTarget = false;
+        typeOf(e);
+        t.bitNum = e->selfWidth;
+        if (e->kind == ExprKind::Range) {
+            t.lo = std::to_string(constValue(e->args[2])) + "ULL";
+        } else if (e->op == "+:") {
+            t.lo = emitIndex(e->args[1]);
+        } else {
+            t.lo = "(" + emitIndex(e->args[1]) + " - " +
+                   std::to_string(t.bitNum - 1) + ")";
+        }
+        nbTarget = savedNb;
+        t.kind = base.width > 64 ? Target::BigBits : Target::Bits;
+        t.code = base.code;
+        t.baseWidth = base.width;
+        t.isSigned = base.isSigned;
+        t.width = t.bitNum;
+        return t;
+    }
+    error(e->line, "unsupported assignment target");
+}
+
+std::string ModelWriter::emitCall(const std::string& name, unsigned line,
+                                  const std::vector<ExprPtr>& args)
+{
+    auto i = cur->funcs.find(name);
+    if (i == cur->funcs.end()) error(line, "unknown function " + name);
+    const FuncRef& func = funcs[i->second];
+    const Function* f = func.func;
+    if (args.size() != f->params.size()) {
+        error(line, "incorrect number of arguments for " + name);
+    }
+    std::string res = func.name + "(";
+    for (size_t j = 0; j < args.size(); j++) {
+        const Port& p = f->params[j];
+        std::string a;
+        if (p.dir == PortDir::Input) {
+            a = emitValue(args[j], p.decl, 0);
+        } else {
+            Target t = emitTarget(args[j]);
+            if (t.kind != Target::Whole) {
+                error(line, "unsupported output argument");
+            }
+            a = t.code;
+        }
+        res += std::string(j ? ", " : "") + a;
+    }
+    return res + ")";
+}
+
+bool ModelWriter::hasIncDec(const ExprPtr& e)
+{
+    if (e->kind == ExprKind::IncDec) return true;
+    for (auto& a : e->args) {
+        if (hasIncDec(a)) return true;
+    }
+    return false;
+}
+
+std::string ModelWriter::emitIncDec(const ExprPtr& e)
+{
+    Target t = emitTarget(e->args[0]);
+    if (t.kind != Target::Whole || t.dims) {
+        error(e->line, "unsupported increment operand");
+    }
+    if (isExactStorage(t.width)) {
+        return e->prefix ? "(" + e->op + t.code + ")" :
+                           "(" + t.code + e->op + ")";
+    }
+    if (t.width > 64) bigUsed = true;
+    std::string f = std::string(e->prefix ? "pre" : "post") +
+                    (e->op == "++" ? "inc" : "dec");
+    return "sct_model::" + f + "<" + std::to_string(t.width) + ">(" +
+           t.code + ")";
+}
+
+//=============================================================================
+// Statements
+
+void ModelWriter::emitAssign(const ExprPtr& lhs, const ExprPtr& rhs,
+                             const std::string& ind)
+{
+    if (lhs->kind == ExprKind::Concat) {
+        // {a, b} = x is split into parts starting from least significant
+        typeOf(lhs);
+        typeOf(rhs);
+        unsigned lo = 0;
+        for (size_t i = lhs->args.size(); i > 0; i--) {
+            const ExprPtr& part = lhs->args[i-1];
+            auto sel = std::make_shared<Expr>(ExprKind::PartSel, lhs->line);
+            auto cast = std::make_shared<Expr>(ExprKind::Cast, lhs->line);
+            cast->width = std::max(lhs->selfWidth, rhs->selfWidth);
+            cast->args.push_back(rhs);
+            auto l = std::make_shared<Expr>(ExprKind::Number, lhs->line);
+            l->value.push_back(lo);
+            l->isSigned = true;
+            auto w = std::make_shared<Expr>(ExprKind::Number, lhs->line);
+            w->value.push_back(part->selfWidth);
+            w->isSigned = true;
+            sel->op = "+:";
+            sel->args = {cast, l, w};
+            lo += part->selfWidth;
+            emitAssign(part, sel, ind);
+        }
+        return;
+    }
+
+    Target t = emitTarget(lhs);
+
+    if (t.dims) {
+        if (rhs->kind == ExprKind::Pattern && rhs->op == "default") {
+            out << ind << "sct_model::fill(" << t.code << ", " <<
+                emitValue(rhs->args[0], *t.decl, t.decl->dims.size()) << ");\n";
+        } else if (rhs->kind == ExprKind::Fill) {
+            out << ind << "sct_model::fill(" << t.code << ", " <<
+                emitValue(rhs, *t.decl, t.decl->dims.size()) << ");\n";
+        } else {
+            out << ind << t.code << " = " <<
+                emitValue(rhs, *t.decl, t.decl->dims.size() - t.dims) << ";\n";
+        }
+        return;
+    }
+
+    typeOf(rhs);
+    if (t.kind == Target::Whole) {
+        Decl d;
+        d.width = t.width;
+        d.isSigned = t.isSigned;
+        if (t.width > 64) {
+            unsigned cw = std::max(t.width, (unsigned)rhs->selfWidth);
+            out << ind << t.code << " = " <<
+                emitCtx(rhs, cw, rhs->selfSigned, false) << ";\n";
+        } else if (hasIncDec(rhs)) {
+            out << ind << t.code << " = sct_model::val(" <<
+                emitValue(rhs, d, 0) << ");\n";
+        } else {
+            out << ind << t.code << " = " << emitValue(rhs, d, 0) << ";\n";
+        }
+        return;
+    }
+
+    unsigned cw = std::max(t.bitNum, (unsigned)rhs->selfWidth);
+    std::string c = emitCtx(rhs, cw, rhs->selfSigned, false);
+    std::string bw = std::to_string(t.baseWidth);
+
+    if (t.kind == Target::Bits) {
+        if (cw > 64) c = "(" + c + ").to_uint64()";
+        out << ind << "sct_model::setbits<" << bw << ">(" << t.code <<
+            ", " << t.lo << ", " << t.bitNum << ", (uint64_t)(" << c <<
+            "));\n";
+    } else {
+        bigUsed = true;
+        if (cw <= 64) c = "(uint64_t)(" + c + ")";
+        out << ind << "sct_model::setbits<" << bw << ">(" << t.code <<
+            ", " << t.lo << ", " << t.bitNum << ", " <<
+            wrap(c, t.bitNum, false) << ");\n";
+    }
+}
+
+void ModelWriter::emitDecl(const Decl& decl, const std::string& ind)
+{
+    out << ind << (readNames.count(decl.name) ? "" : "[[maybe_unused]] ") <<
+        declType(decl) << " " << localName(decl.name);
+    if (decl.init) {
+        out << " = " << emitValue(decl.init, decl, 0);
+    } else {
+        out << "{}";
+    }
+    out << ";\n";
+    addLocal(decl);
+}
+
+void ModelWriter::emitBody(const StmtPtr& st, const std::string& ind)
+{
+    if (st->kind == StmtKind::Block) {
+        emitStmt(st, ind);
+    } else {
+        out << ind << "{\n";
+        emitStmt(st, ind + "    ");
+        out << ind << "}\n";
+    }
+}
+
+void ModelWriter::emitStmt(const StmtPtr& st, const std::string& ind)
+{
+    std::string ind2 = ind + "    ";
+
+    switch (st->kind) {
+    case StmtKind::Block:
+        out << ind << "{\n";
+        pushLocals();
+        for (auto& s : st->stmts) emitStmt(s, ind2);
+        popLocals();
+        out << ind << "}\n";
+        break;
+
+    case StmtKind::Decl:
+        emitDecl(st->decl, ind);
+        break;
+
+    case StmtKind::If:
+        out << ind << "if (" << emitCond(st->cond) << ")\n";
+        emitBody(st->stmts[0], ind);
+        if (st->stmts.size() > 1) {
+            out << ind << "else\n";
+            emitBody(st->stmts[1], ind);
+        }
+        break;
+
+    case StmtKind::Case: {
+        // Lowered to if-else chain, so break in case item exits loop
+        bool first = true;
+        const CaseItem* deflt = nullptr;
+        for (auto& item : st->items) {
+            if (item.labels.empty()) {
+                deflt = &item;
+                continue;
+            }
+            std::string cond;
+            for (auto& label : item.labels) {
+                auto eq = std::make_shared<Expr>(ExprKind::Binary, st->line);
+                eq->op = "==";
+                eq->args = {st->cond, label};
+                cond += std::string(cond.empty() ? "" : " || ") +
+                        emitCond(eq);
+            }
+            out << ind << (first ? "if (" : "else if (") << cond << ")\n";
+            emitBody(item.body, ind);
+            first = false;
+        }
+        if (deflt) {
+            if (!first) out << ind << "else\n";
+            emitBody(deflt->body, ind);
+        }
+        break;
+    }
+    case StmtKind::For:
+        out << ind << "{\n";
+        pushLocals();
+        for (auto& s : st->stmts) emitStmt(s, ind2);
+        out << ind2 << "for (; " << (st->cond ? emitCond(st->cond) : "") <<
+            "; ";
+        if (st->step) {
+            // Step statement is emitted as expression
+            std::ostringstream saved;
+            saved << out.str();
+            out.str("");
+            emitStmt(st->step, "");
+            std::string step = out.str();
+            out.str("");
+            out << saved.str();
+            while (!step.empty() && (step.back() == '\n' ||
+                   step.back() == ';')) step.pop_back();
+            out << step;
+        }
+        out << ")\n";
+        emitBody(st->body, ind2);
+        popLocals();
+        out << ind << "}\n";
+        break;
+
+    case StmtKind::While:
+        out << ind << "while (" << emitCond(st->cond) << ")\n";
+        emitBody(st->body, ind);
+        break;
+
+    case StmtKind::DoWhile:
+        out << ind << "do\n";
+        emitBody(st->body, ind);
+        out << ind << "while (" << emitCond(st->cond) << ");\n";
+        break;
+
+    case StmtKind::Break:
+        out << ind << "break;\n";
+        break;
+
+    case StmtKind::Continue:
+        out << ind << "continue;\n";
+        break;
+
+    case StmtKind::Return:
+        if (st->rhs) {
+            if (!curFunc || curFunc->isVoid) {
+                error(st->line, "return value in void function");
+            }
+            out << ind << "return " <<
+                emitValue(st->rhs, curFunc->result, 0) << ";\n";
+        } else if (curFunc && !curFunc->isVoid) {
+            out << ind << "return " << localName(curFunc->name) << ";\n";
+        } else {
+            out << ind << "return;\n";
+        }
+        break;
+
+    case StmtKind::Assign:
+        if (st->name == "=" || st->name == "<=") {
+            nbTarget = st->name == "<=";
+            emitAssign(st->lhs, st->rhs, ind);
+            nbTarget = false;
+        } else {
+            // Compound assignment
+            auto e = std::make_shared<Expr>(ExprKind::Binary, st->line);
+            e->op = st->name.substr(0, st->name.size()-1);
+            e->args = {st->lhs, st->rhs};
+            emitAssign(st->lhs, e, ind);
+        }
+        break;
+
+    case StmtKind::ExprStmt:
+        if (st->rhs->kind == ExprKind::IncDec) {
+            std::string c = emitIncDec(st->rhs);
+            if (c.front() == '(' && c.back() == ')') {
+                c = c.substr(1, c.size()-2);
+            }
+            out << ind << c << ";\n";
+        } else {
+            out << ind << emitSelf(st->rhs, false) << ";\n";
+        }
+        break;
+
+    case StmtKind::Call:
+        out << ind << emitCall(st->name, st->line, st->args) << ";\n";
+        break;
+
+    case StmtKind::Assert: {
+        std::string msg = st->name.empty() ?
+                          "Assertion failed at line " + std::to_string(st->line) :
+                          st->name;
+        std::string esc;
+        for (char c : msg) {
+            if (c == '"' || c == '\\') esc += '\\';
+            esc += c;
+        }
+        out << ind << "if (!" << emitCond(st->cond) << ") assertFailed(\"" <<
+            esc << "\");\n";
+        break;
+    }
+    case StmtKind::Empty:
+        break;
+    }
+}
+
+void ModelWriter::emitFunction(const FuncRef& func)
+{
+    cur = func.scope;
+    curFunc = func.func;
+    locals.clear();
+    localNames.clear();
+    const Function* f = func.func;
+
+    for (auto& p : f->params) localNames.insert(localName(p.decl.name));
+    if (!f->isVoid) localNames.insert(localName(f->name));
+    collectLocalNames(f->body);
+    readNames.clear();
+    if (!f->isVoid) readNames.insert(f->result.name);
+    collectReadNames(f->body);
+
+    out << "    // Function " << f->name << " of " << func.scope->path << "\n";
+    out << "    " << (f->isVoid ? "void" : declType(f->result)) << " " <<
+        func.name << "(";
+    pushLocals();
+    for (size_t i = 0; i < f->params.size(); i++) {
+        const Port& p = f->params[i];
+        out << (i ? ", " : "") << declType(p.decl) <<
+            (p.dir == PortDir::Input ? " " : "& ") << localName(p.decl.name);
+        addLocal(p.decl);
+    }
+    out << ")\n    {\n";
+    if (!f->isVoid) {
+        emitDecl(f->result, "        ");
+    }
+    for (auto& s : f->body->stmts) emitStmt(s, "        ");
+    if (!f->isVoid) {
+        out << "        return " << localName(f->name) << ";\n";
+    }
+    popLocals();
+    out << "    }\n\n";
+    curFunc = nullptr;
+}
+
+void ModelWriter::emitProcess(const ProcRef& proc)
+{
+    cur = proc.scope;
+    curFunc = nullptr;
+    locals.clear();
+    localNames.clear();
+    collectLocalNames(proc.proc->body);
+    readNames.clear();
+    collectReadNames(proc.proc->body);
+
+    static const char* const KIND_NAMES[] = {
+        "always_comb", "always_latch", "assign", "always_ff"
+    };
+    out << "    // " << KIND_NAMES[proc.proc->kind] << " " <<
+        proc.proc->name << " of " << proc.scope->path << "\n";
+    out << "    void " << proc.name << "()\n";
+    pushLocals();
+    if (proc.proc->body->kind == StmtKind::Block) {
+        emitStmt(proc.proc->body, "    ");
+    } else {
+        out << "    {\n";
+        emitStmt(proc.proc->body, "        ");
+        out << "    }\n";
+    }
+    popLocals();
+    out << "\n";
+}
+
+//=============================================================================
+
+void ModelWriter::run(const std::string& topName, std::ostream& os)
+{
+    for (auto& mod : mods) {
+        if (!modMap.emplace(mod.name, &mod).second) {
+            throw SvParseError(mod.line, "duplicate module " + mod.name);
+        }
+    }
+
+    // Top module
+    const Module* top = nullptr;
+    if (!topName.empty()) {
+        auto i = modMap.find(topName);
+        if (i == modMap.end()) {
+            throw SvParseError(0, "top module " + topName + " not found");
+        }
+        top = i->second;
+    } else {
+        std::unordered_set<std::string> instantiated;
+        for (auto& mod : mods) {
+            for (auto& inst : mod.insts) instantiated.insert(inst.moduleName);
+        }
+        for (auto& mod : mods) {
+            if (!instantiated.count(mod.name)) {
+                top = &mod;
+                break;
+            }
+        }
+        if (!top) throw SvParseError(0, "no top module found");
+    }
+
+    // Top module ports keep their names
+    for (auto& port : top->ports) {
+        if (RESERVED_NAMES.count(port.decl.name)) {
+            throw SvParseError(port.decl.line, "port name " +
+                               port.decl.name + " is reserved in C++ model");
+        }
+    }
+    elaborate(top, nullptr, "", top->name, nullptr);
+
+    // Read and write sets
+    for (auto& proc : combProcs) {
+        cur = proc.scope;
+        locals.clear();
+        pushLocals();
+        collectStmt(proc.proc->body, proc.reads, proc.writes, nullptr);
+        popLocals();
+    }
+    std::set<size_t> ffReads;
+    std::set<size_t> ffNbWrites;
+    for (auto& proc : ffProcs) {
+        cur = proc.scope;
+        locals.clear();
+        pushLocals();
+        collectStmt(proc.proc->body, proc.reads, proc.writes, &proc.nbWrites);
+        popLocals();
+        ffReads.insert(proc.reads.begin(), proc.reads.end());
+        ffNbWrites.insert(proc.nbWrites.begin(), proc.nbWrites.end());
+
+        // Clock is the first edge, the others are asynchronous resets
+        const Edge& edge = proc.proc->edges.front();
+        std::set<size_t> clk, dummy;
+        collectExpr(edge.signal, clk, dummy);
+        for (size_t v : clk) clocks.insert(vars[v].name);
+        if (!edge.posedge) negedgeClock = true;
+    }
+
+    // Registers read in clocked processes are updated through shadow
+    for (size_t v : ffNbWrites) {
+        if (ffReads.count(v)) {
+            vars[v].shadow = uniqueName(vars[v].name + "_nb");
+        }
+    }
+
+    // Levelization: edge from writer to reader process
+    size_t n = combProcs.size();
+    std::vector<std::vector<size_t>> succs(n);
+    std::unordered_map<size_t, std::vector<size_t>> writers;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t v : combProcs[i].writes) writers[v].push_back(i);
+    }
+    for (size_t i = 0; i < n; i++) {
+        std::set<size_t> s;
+        for (size_t v : combProcs[i].reads) {
+            auto w = writers.find(v);
+            if (w == writers.end()) continue;
+            for (size_t j : w->second) if (j != i) s.insert(j);
+        }
+        for (size_t j : s) succs[j].push_back(i);
+    }
+
+    // Tarjan strongly connected components, produced in reverse order
+    std::vector<std::vector<size_t>> sccs;
+    {
+        std::vector<int> index(n, -1), low(n, 0);
+        std::vector<bool> onStack(n, false);
+        std::vector<size_t> stack;
+        int counter = 0;
+        std::function<void(size_t)> visit = [&](size_t v) {
+            index[v] = low[v] = counter++;
+            stack.push_back(v);
+            onStack[v] = true;
+            for (size_t w : succs[v]) {
+                if (index[w] < 0) {
+                    visit(w);
+                    low[v] = std::min(low[v], low[w]);
+                } else if (onStack[w]) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+            }
+            if (low[v] == index[v]) {
+                std::vector<size_t> scc;
+                size_t w;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    onStack[w] = false;
+                    scc.push_back(w);
+                } while (w != v);
+                std::sort(scc.begin(), scc.end());
+                sccs.push_back(scc);
+            }
+        };
+        for (size_t i = 0; i < n; i++) {
+            if (index[i] < 0) visit(i);
+        }
+        std::reverse(sccs.begin(), sccs.end());
+    }
+
+    // Member functions
+    for (auto& func : funcs) emitFunction(func);
+    for (auto& proc : combProcs) emitProcess(proc);
+    for (auto& proc : ffProcs) emitProcess(proc);
+    localNames.clear();
+    std::string methods = out.str();
+
+    // Asynchronous reset active condition of clocked processes, 
+    // empty for process without asynchronous reset
+    std::vector<std::string> resetConds;
+    // Reset state member and reset edge local variable names
+    std::vector<std::pair<std::string, std::string>> resetNames;
+    for (auto& proc : ffProcs) {
+        cur = proc.scope;
+        locals.clear();
+        std::string cond;
+        const auto& edges = proc.proc->edges;
+        for (size_t i = 1; i < edges.size(); i++) {
+            std::string c = emitCond(edges[i].signal);
+            cond += std::string(cond.empty() ? "" : " || ") + 
+                    (edges[i].posedge ? "(" + c + ")" : "!(" + c + ")");
+        }
+        resetConds.push_back(cond);
+        if (cond.empty()) {
+            resetNames.emplace_back();
+        } else {
+            resetNames.emplace_back(uniqueName(proc.name + "_reset"),
+                                    uniqueName(proc.name + "_reset_edge"));
+        }
+    }
+    bool asyncReset = std::any_of(resetConds.begin(), resetConds.end(),
+                                  [](const std::string& c) {
+                                      return !c.empty(); });
+
+    //-------------------------------------------------------------------------
+    std::string modelName = top->name + "_model";
+    std::string guard;
+    for (char c : modelName) guard += (char)std::toupper(c);
+    guard += "_H";
+
+    os << "//==============================================================="
+          "===============\n";
+    os << "//\n";
+    os << "// Cycle-based C++ model of module " << top->name << "\n";
+    os << "//\n";
+    os << "// Set inputs, call eval() to update combinational logic and\n";
+    os << "// clock() to advance one clock cycle. Port values should be\n";
+    os << "// within their declared width.\n";
+    if (clocks.size() > 1) {
+        os << "//\n// Clocks";
+        for (auto& c : clocks) os << " " << c;
+        os << " are considered as one clock domain.\n";
+    }
+    if (negedgeClock) {
+        os << "//\n// Negative edge clocked processes are evaluated at the "
+              "same edge as others.\n";
+    }
+    os << "//\n";
+    os << "//==============================================================="
+          "===============\n\n";
+    os << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+    if (bigUsed || scModule) os << "#include <systemc.h>\n";
+    os << "#include <algorithm>\n#include <array>\n#include <cstdint>\n"
+          "#include <cstdio>\n#include <iterator>\n#include <tuple>\n#include <type_traits>\n";
+    os << MODEL_HELPERS;
+    if (bigUsed) os << MODEL_BIG_HELPERS;
+    os << "\n";
+
+    os << "struct " << modelName << "\n{\n";
+    os << "    // Ports\n";
+    for (auto& v : vars) {
+        if (!v.isPort) continue;
+        os << "    " << declType(*v.decl) << " " << v.name << "{};    // " <<
+            (v.dir == PortDir::Input ? "input" :
+             v.dir == PortDir::Output ? "output" : "inout") << "\n";
+    }
+    os << "\n    // Variables\n";
+    for (size_t i = 0; i < vars.size(); i++) {
+        auto& v = vars[i];
+        if (v.isPort) continue;
+        if (v.isConst) {
+            os << "    static constexpr " <<
+                (v.decl->isSigned ? "int64_t " : "uint64_t ") << v.name <<
+                " = " << intLiteral(v.value, v.decl->isSigned) << ";\n";
+            continue;
+        }
+        os << "    " << declType(*v.decl) << " " << v.name;
+        if (v.decl->init) {
+            // Initialization in scope of module
+            cur = nullptr;
+            for (auto& s : scopes) {
+                if (s->vars.count(v.decl->name) &&
+                    s->vars.at(v.decl->name) == i) cur = s.get();
+            }
+            locals.clear();
+            out.str("");
+            os << " = " << emitValue(v.decl->init, *v.decl, 0) << ";\n";
+        } else {
+            os << "{};\n";
+        }
+    }
+    bool shadows = false;
+    for (auto& v : vars) {
+        if (v.shadow.empty()) continue;
+        if (!shadows) os << "\n    // Shadow variables of registers\n";
+        shadows = true;
+        os << "    " << declType(*v.decl) << " " << v.shadow << "{};\n";
+    }
+    if (asyncReset) {
+        os << "\n    // Asynchronous reset was active at previous eval()\n";
+        for (auto& names : resetNames) {
+            if (names.first.empty()) continue;
+            os << "    bool " << names.first << " = false;\n";
+        }
+    }
+    os << "\n    // Number of failed immediate assertions\n";
+    os << "    unsigned assert_errors = 0;\n\n";
+
+    os << "    void assertFailed(const char* msg)\n    {\n";
+    os << "        assert_errors++;\n";
+    os << "        std::fprintf(stderr, \"%s\\n\", msg);\n    }\n\n";
+
+    // Combinational logic
+    if (asyncReset) {
+        os << "    // Evaluate combinational logic and apply asynchronous "
+              "reset which\n    // becomes active\n";
+        os << "    void eval()\n    {\n";
+        os << "        evalComb();\n";
+        os << "        if (asyncReset()) evalComb();\n";
+        os << "    }\n\n";
+
+        // Clocked process is run at reset edge as in SV, while reset is 
+        // active the process is run in clock() as well
+        os << "    // Run clocked processes which asynchronous reset becomes "
+              "active,\n    // return true if any\n";
+        os << "    bool asyncReset()\n    {\n";
+        std::string any;
+        for (size_t i = 0; i < ffProcs.size(); i++) {
+            if (resetConds[i].empty()) continue;
+            const auto& names = resetNames[i];
+            os << "        bool " << names.second << " = !" << names.first << 
+                " && (" << resetConds[i] << ");\n";
+            os << "        " << names.first << " = " << resetConds[i] << ";\n";
+            any += std::string(any.empty() ? "" : " || ") + names.second;
+        }
+        bool single = any.find(' ') == std::string::npos;
+        os << "        if (" << (single ? "!" + any : "!(" + any + ")") <<
+            ") return false;\n";
+        for (auto& v : vars) {
+            if (!v.shadow.empty()) {
+                os << "        " << v.shadow << " = " << v.name << ";\n";
+            }
+        }
+        for (size_t i = 0; i < ffProcs.size(); i++) {
+            if (resetConds[i].empty()) continue;
+            os << "        if (" << resetNames[i].second << ") " << 
+                ffProcs[i].name << "();\n";
+        }
+        for (auto& v : vars) {
+            if (!v.shadow.empty()) {
+                os << "        " << v.name << " = " << v.shadow << ";\n";
+            }
+        }
+        os << "        return true;\n";
+        os << "    }\n\n";
+        
+        os << "    // Evaluate combinational logic\n";
+        os << "    void evalComb()\n    {\n";
+    } else {
+        os << "    // Evaluate combinational logic\n";
+        os << "    void eval()\n    {\n";
+    }
+    for (auto& scc : sccs) {
+        if (scc.size() == 1) {
+            os << "        " << combProcs[scc[0]].name << "();\n";
+            continue;
+        }
+        std::set<size_t> loopVars;
+        for (size_t i : scc) {
+            loopVars.insert(combProcs[i].writes.begin(),
+                            combProcs[i].writes.end());
+        }
+        std::string tuple;
+        for (size_t v : loopVars) {
+            tuple += std::string(tuple.empty() ? "" : ", ") + vars[v].name;
+        }
+        os << "        // Combinational loop evaluated until fixed point\n";
+        os << "        for (unsigned i = 0; ; i++) {\n";
+        os << "            auto prev = std::make_tuple(" << tuple << ");\n";
+        for (size_t i : scc) {
+            os << "            " << combProcs[i].name << "();\n";
+        }
+        os << "            if (prev == std::make_tuple(" << tuple <<
+            ")) break;\n";
+        os << "            if (i == " << COMB_LOOP_ITER_NUM << ") {\n";
+        os << "                assertFailed(\"Combinational loop does not "
+              "converge\");\n";
+        os << "                break;\n            }\n";
+        os << "        }\n";
+    }
+    os << "    }\n\n";
+
+    // Clock
+    os << "    // Evaluate combinational logic, update registers and\n";
+    os << "    // evaluate combinational logic with new register values\n";
+    os << "    void clock()\n    {\n";
+    os << "        clockBegin();\n";
+    for (auto& proc : ffProcs) {
+        os << "        " << proc.name << "();\n";
+    }
+    os << "        clockEnd();\n";
+    os << "    }\n\n";
+
+    // Clock edge split around clocked processes, which can be run 
+    // in any order between these functions
+    os << "    // Evaluate combinational logic before clocked processes\n";
+    os << "    void clockBegin()\n    {\n";
+    os << "        eval();\n";
+    for (auto& v : vars) {
+        if (!v.shadow.empty()) {
+            os << "        " << v.shadow << " = " << v.name << ";\n";
+        }
+    }
+    os << "    }\n\n";
+    os << "    // Update registers after clocked processes and evaluate\n";
+    os << "    // combinational logic with new register values\n";
+    os << "    void clockEnd()\n    {\n";
+    for (auto& v : vars) {
+        if (!v.shadow.empty()) {
+            os << "        " << v.name << " = " << v.shadow << ";\n";
+        }
+    }
+    os << "        eval();\n";
+    os << "    }\n\n";
+
+    os << methods;
+    os << "};\n\n";
+
+    if (scModule) emitScModule(top, modelName, os);
+    os << "#endif /* " << guard << " */\n";
+}
+
+void ModelWriter::emitScModule(const Module* top, const std::string& modelName,
+                               std::ostream& os)
+{
+    std::string name = top->name + "_sc";
+
+    // Port names which hide sc_module members or names used in the module
+    // code and cannot be renamed as ports are bound by name
+    static const std::unordered_set<std::string> SC_RESERVED_NAMES = {
+        "sc_core", "sc_dt", "sc_module", "sc_module_name", "size_t",
+        "SC_CURRENT_USER_MODULE", "name", "basename", "kind", "print", "dump",
+        "trace", "simcontext", "get_parent_object", "get_child_objects",
+        "get_child_events", "add_attribute", "get_attribute", 
+        "remove_attribute", "remove_all_attributes", "num_attributes", 
+        "attr_cltn", "sensitive", "sensitive_pos", "sensitive_neg", 
+        "dont_initialize", "reset_signal_is", "async_reset_signal_is", 
+        "set_stack_size", "next_trigger", "wait", "timed_out", "halt", 
+        "at_posedge", "at_negedge", "before_end_of_elaboration", 
+        "end_of_elaboration", "start_of_simulation", "end_of_simulation"
+    };
+
+    // Clock port, the only clock domain is supported
+    const VarRef* clock = nullptr;
+    std::vector<const VarRef*> ports;
+    std::unordered_set<std::string> portNames;
+    for (auto& v : vars) {
+        if (!v.isPort) continue;
+        if (SC_RESERVED_NAMES.count(v.name) || v.name == name || 
+            v.name == modelName) {
+            throw SvParseError(v.decl->line, "port name " + v.name +
+                               " is reserved in SystemC module");
+        }
+        if (v.dir == PortDir::Inout) {
+            throw SvParseError(v.decl->line, "inout port " + v.name +
+                               " is not supported in SystemC module");
+        }
+        if (v.decl->dims.size() > 1) {
+            throw SvParseError(v.decl->line, "multi-dimensional port " +
+                               v.name + " is not supported in SystemC module");
+        }
+        portNames.insert(v.name);
+        if (clocks.count(v.name)) {
+            clock = &v;
+        } else {
+            ports.push_back(&v);
+        }
+    }
+    if (!ffProcs.empty() && (!clock || clocks.size() > 1)) {
+        std::string names;
+        for (auto& c : clocks) names += " " + c;
+        throw SvParseError(top->line, "SystemC module requires one clock "
+                           "input port, clocks are" + names);
+    }
+
+    // Generated member, method and local names differ from port names,
+    // SC_METHOD declares local process handle with "_handle" suffix
+    std::unordered_set<std::string> memberNames;
+    auto memberName = [&](const std::string& base) {
+        std::string n = base;
+        while (portNames.count(n) || portNames.count(n + "_handle") ||
+               memberNames.count(n) || SC_RESERVED_NAMES.count(n)) {
+            n += "_";
+        }
+        memberNames.insert(n);
+        return n;
+    };
+    std::string model = memberName("model");
+    std::string modName = memberName("mod_name");
+    std::string combProc = memberName("combProc");
+    std::string readInputs = memberName("readInputs");
+    std::string writeOutputs = memberName("writeOutputs");
+    std::string modelUpdated = memberName("modelUpdated");
+    std::string clockStart = memberName("clockStart");
+    std::string clockFinish = memberName("clockFinish");
+    std::string pending = memberName("pending");
+    std::string idx = memberName("i");
+    std::vector<std::string> procMethods;
+    for (auto& proc : ffProcs) {
+        procMethods.push_back(memberName(proc.name + "_method"));
+    }
+
+    // Port types are the same as in port map file
+    auto portType = [](const VarRef& v) {
+        const Decl& d = *v.decl;
+        std::string type;
+        if (d.width == 1 && !d.isSigned) {
+            type = "bool";
+        } else if (d.width <= 64) {
+            type = std::string(d.isSigned ? "sc_dt::sc_int<" :
+                               "sc_dt::sc_uint<") + std::to_string(d.width) +
+                   ">";
+        } else {
+            type = scalarType(d.width, d.isSigned);
+        }
+        std::string port = std::string(v.dir == PortDir::Input ?
+                           "sc_core::sc_in<" : "sc_core::sc_out<") + type + ">";
+        if (!d.dims.empty()) {
+            port = "sc_core::sc_vector<" + port + ">";
+        }
+        return port;
+    };
+    auto readPort = [](const VarRef& v, const std::string& port) {
+        const Decl& d = *v.decl;
+        std::string c = port + ".read()";
+        if (d.width > 64 || (d.width == 1 && !d.isSigned)) return c;
+        c += d.isSigned ? ".to_int64()" : ".to_uint64()";
+        return "(" + scalarType(d.width, d.isSigned) + ")" + c;
+    };
+    auto writePort = [](const VarRef& v, const std::string& value) {
+        const Decl& d = *v.decl;
+        if (d.width == 1 && !d.isSigned) return value + " != 0";
+        return value;
+    };
+
+    os << "// SystemC module with the model evaluated in SC_METHODs, used\n";
+    os << "// instead of module " << top->name << " to avoid thread context "
+          "switches.\n";
+    os << "// Each clocked process, which is CTHREAD state machine or "
+          "clocked\n";
+    os << "// method, is run in its own SC_METHOD at the clock edge. "
+          "Combinational\n";
+    os << "// logic and asynchronous reset are evaluated in SC_METHOD "
+          "sensitive\n";
+    os << "// to all inputs. One clock is supported.\n";
+    os << "struct " << name << " : sc_core::sc_module\n{\n";
+    if (clock) {
+        os << "    sc_core::sc_in<bool> " << clock->name << ";\n";
+    }
+    for (auto* v : ports) {
+        os << "    " << portType(*v) << " " << v->name << ";\n";
+    }
+    os << "\n    " << modelName << " " << model << ";\n";
+    os << "    // Model outputs changed, ports are written in one process\n";
+    os << "    sc_core::sc_event " << modelUpdated << ";\n";
+    if (!ffProcs.empty()) {
+        os << "    // Clocked processes not run yet at current clock edge\n";
+        os << "    unsigned " << pending << " = 0;\n";
+    }
+    os << "\n";
+
+    os << "    SC_HAS_PROCESS(" << name << ");\n\n";
+    os << "    explicit " << name << "(const sc_core::sc_module_name& " <<
+        modName << ") :\n";
+    os << "        sc_module(" << modName << ")";
+    if (clock) {
+        os << ",\n        " << clock->name << "(\"" << clock->name << "\")";
+    }
+    for (auto* v : ports) {
+        os << ",\n        " << v->name << "(\"" << v->name << "\"";
+        if (!v->decl->dims.empty()) os << ", " << v->decl->dims[0];
+        os << ")";
+    }
+    os << "\n    {\n";
+    os << "        SC_METHOD(" << combProc << ");\n";
+    for (auto* v : ports) {
+        if (v->dir != PortDir::Input) continue;
+        if (v->decl->dims.empty()) {
+            os << "        sensitive << " << v->name << ";\n";
+        } else {
+            os << "        for (size_t " << idx << " = 0; " << idx << " < " <<
+                v->decl->dims[0] << "; " << idx << "++) sensitive << " <<
+                v->name << "[" << idx << "];\n";
+        }
+    }
+    os << "\n        SC_METHOD(" << writeOutputs << ");\n";
+    os << "        sensitive << " << modelUpdated << ";\n";
+    os << "        dont_initialize();\n";
+    for (auto& proc : procMethods) {
+        os << "\n        SC_METHOD(" << proc << ");\n";
+        os << "        sensitive << " << clock->name <<
+            (negedgeClock ? ".neg()" : ".pos()") << ";\n";
+        os << "        dont_initialize();\n";
+    }
+    os << "    }\n\n";
+
+    // Input ports copied to the model, output ports copied from the model
+    // in the same evaluation phase by immediate notification
+    os << "    void " << readInputs << "()\n    {\n";
+    for (auto* v : ports) {
+        if (v->dir != PortDir::Input) continue;
+        if (v->decl->dims.empty()) {
+            os << "        " << model << "." << v->name << " = " <<
+                readPort(*v, v->name) << ";\n";
+        } else {
+            os << "        for (size_t " << idx << " = 0; " << idx << " < " <<
+                v->decl->dims[0] << "; " << idx << "++) {\n";
+            os << "            " << model << "." << v->name << "[" << idx <<
+                "] = " << readPort(*v, v->name + "[" + idx + "]") << ";\n";
+            os << "        }\n";
+        }
+    }
+    os << "    }\n\n";
+
+    os << "    void " << writeOutputs << "()\n    {\n";
+    for (auto* v : ports) {
+        if (v->dir != PortDir::Output) continue;
+        if (v->decl->dims.empty()) {
+            os << "        " << v->name << ".write(" <<
+                writePort(*v, model + "." + v->name) << ");\n";
+        } else {
+            os << "        for (size_t " << idx << " = 0; " << idx << " < " <<
+                v->decl->dims[0] << "; " << idx << "++) {\n";
+            os << "            " << v->name << "[" << idx << "].write(" <<
+                writePort(*v, model + "." + v->name + "[" + idx + "]") <<
+                ");\n";
+            os << "        }\n";
+        }
+    }
+    os << "    }\n\n";
+
+    // Asynchronous reset is applied in eval() at the reset edge
+    os << "    // Input change evaluates combinational logic and applies "
+          "asynchronous\n";
+    os << "    // reset, skipped at clock edge as done by clocked processes\n";
+    os << "    void " << combProc << "()\n    {\n";
+    if (!ffProcs.empty()) {
+        os << "        if (" << pending << " != 0) return;\n";
+    }
+    os << "        " << readInputs << "();\n";
+    os << "        " << model << ".eval();\n";
+    os << "        " << modelUpdated << ".notify();\n";
+    os << "    }\n";
+
+    if (!ffProcs.empty()) {
+        // Clocked process methods are run in the same evaluation phase in
+        // any order, the first one starts clock edge and the last one 
+        // updates registers
+        os << "\n    // The first clocked process at the clock edge "
+              "evaluates combinational logic\n";
+        os << "    void " << clockStart << "()\n    {\n";
+        os << "        if (" << pending << " != 0) return;\n";
+        os << "        " << pending << " = " << ffProcs.size() << ";\n";
+        os << "        " << readInputs << "();\n";
+        os << "        " << model << ".clockBegin();\n";
+        os << "    }\n\n";
+
+        os << "    // The last clocked process at the clock edge updates "
+              "registers\n";
+        os << "    void " << clockFinish << "()\n    {\n";
+        os << "        if (--" << pending << " != 0) return;\n";
+        os << "        " << model << ".clockEnd();\n";
+        os << "        " << modelUpdated << ".notify();\n";
+        os << "    }\n";
+
+        for (size_t i = 0; i < ffProcs.size(); i++) {
+            os << "\n    void " << procMethods[i] << "()\n    {\n";
+            os << "        " << clockStart << "();\n";
+            os << "        " << model << "." << ffProcs[i].name << "();\n";
+            os << "        " << clockFinish << "();\n";
+            os << "    }\n";
+        }
+    }
+    os << "};\n\n";
+}
+
+}  // namespace
+
+//=============================================================================
+
+bool generateCppModel(const std::string& svText, const std::string& topName,
+                      bool scModule, std::ostream& os, std::string& err)
+{
+    try {
+        ModelWriter writer(parseSv(svText), scModule);
+        std::ostringstream ss;
+        writer.run(topName, ss);
+        os << ss.str();
+        return true;
+
+    } catch (const SvParseError& e) {
+        err = e.what();
+        return false;
+    }
+}
+
+}  // namespace sc
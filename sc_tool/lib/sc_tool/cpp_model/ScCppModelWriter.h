@@ -0,0 +1,52 @@
+/******************************************************************************
+ * Copyright (c) 2020, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/**
+ * Cycle-based C++ model generator.
+ *
+ * Translates generated SystemVerilog into one C++ structure with flattened
+ * module hierarchy. Combinational processes are levelized and evaluated in
+ * topological order in eval(), processes in combinational loops are
+ * evaluated until fixed point. Register update processes are evaluated in
+ * clock(), non-blocking assignments to registers read by other register
+ * update processes are done through shadow variables.
+ *
+ * Variables up to 64 bit are represented as C++ integer types, wider ones
+ * as sc_biguint/sc_bigint. All clocked processes belong to one clock domain
+ * which is advanced by clock(), asynchronous reset is applied in eval() 
+ * when the reset becomes active.
+ *
+ * Optionally SystemC module with the same ports is generated, it runs the
+ * model in SC_METHODs. CTHREADs are already state machines in generated
+ * SystemVerilog, so each of them is run in its own SC_METHOD at the clock 
+ * edge without thread context switches. Combinational logic and asynchronous
+ * reset are evaluated in SC_METHOD sensitive to inputs. The module supports
+ * one clock only.
+ */
+
+#ifndef SCCPPMODELWRITER_H
+#define SCCPPMODELWRITER_H
+
+#include <ostream>
+#include <string>
+
+namespace sc {
+
+/// Generate C++ model header for top module of given SystemVerilog text
+/// \param svText   -- generated SystemVerilog of all modules
+/// \param topName  -- top module name, if empty module which is not
+///                    instantiated in other modules is used
+/// \param scModule -- generate SystemC module running the model
+/// \param os       -- output stream for model header
+/// \param err      -- error description if model is not generated
+/// \return true if model is generated
+bool generateCppModel(const std::string& svText, const std::string& topName,
+                      bool scModule, std::ostream& os, std::string& err);
+
+}  // namespace sc
+
+#endif /* SCCPPMODELWRITER_H */
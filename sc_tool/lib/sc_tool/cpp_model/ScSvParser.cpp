@@ -0,0 +1,1178 @@
+/******************************************************************************
+ * Copyright (c) 2020, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/**
+ * Parser of generated SystemVerilog used by C++ model generator.
+ */
+
+#include "sc_tool/cpp_model/ScSvParser.h"
+
+#include <cctype>
+#include <unordered_map>
+
+namespace sc {
+namespace sv {
+
+namespace {
+
+//=============================================================================
+// Lexer
+
+enum class TokKind { Ident, Number, String, Punct, End };
+
+struct Token
+{
+    TokKind kind;
+    std::string text;
+    unsigned line;
+    // Number
+    std::vector<uint64_t> value;
+    unsigned width = 0;
+    bool isSigned = false;
+    bool based = false;
+    // Fill literal '0 or '1
+    bool fill = false;
+};
+
+// Multiply-add for arbitrary width value
+void mulAdd(std::vector<uint64_t>& val, unsigned mul, unsigned add)
+{
+    unsigned __int128 carry = add;
+    for (auto& w : val) {
+        unsigned __int128 r = (unsigned __int128)w * mul + carry;
+        w = (uint64_t)r;
+        carry = r >> 64;
+    }
+    if (carry) val.push_back((uint64_t)carry);
+}
+
+// Punctuators, longest first
+const char* const PUNCTS[] = {
+    "<<<=", ">>>=", "<<<", ">>>", "===", "!==", "|->", "|=>",
+    "<<=", ">>=", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||",
+    "~&", "~|", "~^", "^~", "++", "--", "+=", "-=", "*=", "/=", "%=",
+    "&=", "|=", "^=", "+:", "-:", "**", "##", "::", "'{", "'(",
+    "+", "-", "*", "/", "%", "&", "|", "^", "~", "!", "<", ">", "=",
+    "?", ":", ";", ",", ".", "(", ")", "[", "]", "{", "}", "@", "#", "$", "'"
+};
+
+class Lexer
+{
+public:
+    explicit Lexer(const std::string& text) : s(text)
+    {}
+
+    std::vector<Token> run()
+    {
+        std::vector<Token> toks;
+        while (true) {
+            skipSpace();
+            Token t;
+            t.line = line;
+            if (pos >= s.size()) {
+                t.kind = TokKind::End;
+                toks.push_back(t);
+                break;
+            }
+            char c = s[pos];
+
+            if (std::isalpha(c) || c == '_' || c == '$') {
+                size_t b = pos++;
+                while (pos < s.size() && (std::isalnum(s[pos]) ||
+                       s[pos] == '_' || s[pos] == '$')) pos++;
+                t.kind = TokKind::Ident;
+                t.text = s.substr(b, pos-b);
+
+            } else if (std::isdigit(c)) {
+                size_t b = pos;
+                while (pos < s.size() && (std::isdigit(s[pos]) ||
+                       s[pos] == '_')) pos++;
+                std::string digits = s.substr(b, pos-b);
+                size_t p = pos;
+                while (p < s.size() && s[p] == ' ') p++;
+
+                if (p+1 < s.size() && s[p] == '\'' && isBaseChar(s, p+1)) {
+                    pos = p;
+                    readBased(t);
+                    t.width = std::stoul(removeUnderscore(digits));
+                    if (t.width == 0) error("zero width literal");
+                } else {
+                    t.kind = TokKind::Number;
+                    t.value.push_back(0);
+                    for (char d : digits) {
+                        if (d != '_') mulAdd(t.value, 10, d - '0');
+                    }
+                    t.isSigned = true;
+                }
+
+            } else if (c == '\'' && pos+1 < s.size() && isBaseChar(s, pos+1)) {
+                readBased(t);
+
+            } else if (c == '\'' && pos+1 < s.size() &&
+                       (s[pos+1] == '0' || s[pos+1] == '1')) {
+                t.kind = TokKind::Number;
+                t.fill = true;
+                t.value.push_back(s[pos+1] == '1' ? 1 : 0);
+                pos += 2;
+
+            } else if (c == '"') {
+                size_t b = ++pos;
+                while (pos < s.size() && s[pos] != '"') {
+                    if (s[pos] == '\\') pos++;
+                    if (s[pos] == '\n') line++;
+                    pos++;
+                }
+                t.kind = TokKind::String;
+                t.text = s.substr(b, pos-b);
+                pos++;
+
+            } else if (c == '`') {
+                // Compiler directives like `ifndef INTEL_SVA_OFF, code under
+                // the condition is always kept
+                while (pos < s.size() && s[pos] != '\n') pos++;
+                continue;
+
+            } else {
+                t.kind = TokKind::Punct;
+                for (const char* p : PUNCTS) {
+                    size_t l = std::char_traits<char>::length(p);
+                    if (s.compare(pos, l, p) == 0) {
+                        t.text = p;
+                        pos += l;
+                        break;
+                    }
+                }
+                if (t.text.empty()) {
+                    error(std::string("unexpected symbol ") + c);
+                }
+            }
+            toks.push_back(t);
+        }
+        return toks;
+    }
+
+private:
+    [[noreturn]] void error(const std::string& msg)
+    {
+        throw SvParseError(line, msg);
+    }
+
+    static bool isBaseChar(const std::string& s, size_t p)
+    {
+        if (p < s.size() && (s[p] == 's' || s[p] == 'S')) p++;
+        if (p >= s.size()) return false;
+        char b = std::tolower(s[p]);
+        return (b == 'b' || b == 'o' || b == 'd' || b == 'h');
+    }
+
+    static std::string removeUnderscore(const std::string& s)
+    {
+        std::string res;
+        for (char c : s) if (c != '_') res += c;
+        return res;
+    }
+
+    // Read based literal starting from apostrophe
+    void readBased(Token& t)
+    {
+        pos++;
+        t.kind = TokKind::Number;
+        t.based = true;
+        if (s[pos] == 's' || s[pos] == 'S') {
+            t.isSigned = true;
+            pos++;
+        }
+        char b = std::tolower(s[pos++]);
+        unsigned radix = b == 'b' ? 2 : b == 'o' ? 8 : b == 'd' ? 10 : 16;
+        while (pos < s.size() && s[pos] == ' ') pos++;
+
+        t.value.push_back(0);
+        bool digits = false;
+        while (pos < s.size() && (std::isxdigit(s[pos]) || s[pos] == '_')) {
+            char d = std::tolower(s[pos++]);
+            if (d == '_') continue;
+            unsigned v = std::isdigit(d) ? d - '0' : d - 'a' + 10;
+            if (v >= radix) error("incorrect digit in literal");
+            mulAdd(t.value, radix, v);
+            digits = true;
+        }
+        if (!digits) error("literal without digits");
+    }
+
+    void skipSpace()
+    {
+        while (pos < s.size()) {
+            if (s[pos] == '\n') {
+                line++; pos++;
+            } else if (std::isspace(s[pos])) {
+                pos++;
+            } else if (s.compare(pos, 2, "//") == 0) {
+                while (pos < s.size() && s[pos] != '\n') pos++;
+            } else if (s.compare(pos, 2, "/*") == 0) {
+                pos += 2;
+                while (pos < s.size() && s.compare(pos, 2, "*/") != 0) {
+                    if (s[pos] == '\n') line++;
+                    pos++;
+                }
+                pos += 2;
+            } else {
+                break;
+            }
+        }
+    }
+
+    const std::string& s;
+    size_t pos = 0;
+    unsigned line = 1;
+};
+
+//=============================================================================
+// Parser
+
+class Parser
+{
+public:
+    explicit Parser(std::vector<Token> toks) : t(std::move(toks))
+    {}
+
+    std::vector<Module> run()
+    {
+        std::vector<Module> mods;
+        while (!atEnd()) {
+            if (isIdent("module")) {
+                mods.push_back(parseModule());
+            } else {
+                error("module expected");
+            }
+        }
+        return mods;
+    }
+
+private:
+    //-------------------------------------------------------------------------
+    // Token helpers
+
+    const Token& cur() const { return t[p]; }
+    const Token& peek(unsigned n = 1) const
+    {
+        return t[std::min(p + n, (unsigned)t.size()-1)];
+    }
+    bool atEnd() const { return cur().kind == TokKind::End; }
+    unsigned line() const { return cur().line; }
+
+    bool isIdent(const char* s) const
+    {
+        return cur().kind == TokKind::Ident && cur().text == s;
+    }
+    bool isPunct(const char* s) const
+    {
+        return cur().kind == TokKind::Punct && cur().text == s;
+    }
+    bool acceptIdent(const char* s)
+    {
+        if (isIdent(s)) { p++; return true; }
+        return false;
+    }
+    bool accept(const char* s)
+    {
+        if (isPunct(s)) { p++; return true; }
+        return false;
+    }
+    void expect(const char* s)
+    {
+        if (!accept(s)) error(std::string("'") + s + "' expected");
+    }
+    void expectIdent(const char* s)
+    {
+        if (!acceptIdent(s)) error(std::string("'") + s + "' expected");
+    }
+    std::string name()
+    {
+        if (cur().kind != TokKind::Ident || cur().text[0] == '$') {
+            error("identifier expected");
+        }
+        return t[p++].text;
+    }
+
+    [[noreturn]] void error(const std::string& msg) const
+    {
+        std::string near = cur().kind == TokKind::End ?
+                           "end of file" : "'" + cur().text + "'";
+        throw SvParseError(line(), msg + " near " + near);
+    }
+
+    // Skip balanced brackets starting from current open bracket
+    void skipBalanced()
+    {
+        unsigned level = 0;
+        do {
+            if (atEnd()) error("unbalanced brackets");
+            if (isPunct("(") || isPunct("[") || isPunct("{") ||
+                isPunct("'{") || isPunct("'(")) level++;
+            if (isPunct(")") || isPunct("]") || isPunct("}")) level--;
+            p++;
+        } while (level);
+    }
+
+    // Concurrent assertion: [label :] assert property (...) ;
+    bool isAssertProperty() const
+    {
+        if (cur().kind == TokKind::Ident && peek().text == ":" &&
+            peek(2).text == "assert" && peek(3).text == "property") {
+            return true;
+        }
+        return (isIdent("assert") && peek().text == "property");
+    }
+
+    void skipAssertProperty()
+    {
+        while (!isIdent("assert")) p++;
+        p += 2;
+        if (!isPunct("(")) error("'(' expected");
+        skipBalanced();
+        expect(";");
+    }
+
+    //-------------------------------------------------------------------------
+    // Declarations
+
+    unsigned constValue(const ExprPtr& e)
+    {
+        int64_t v;
+        if (!evalConst(e, params, v)) {
+            throw SvParseError(e->line, "constant expression expected");
+        }
+        return (unsigned)v;
+    }
+
+    // Parse [signed] [H:L] after type keyword
+    void parseType(Decl& d)
+    {
+        if (acceptIdent("signed")) d.isSigned = true;
+        else acceptIdent("unsigned");
+
+        d.width = 1;
+        if (accept("[")) {
+            unsigned hi = constValue(parseExpr());
+            expect(":");
+            unsigned lo = constValue(parseExpr());
+            expect("]");
+            if (lo > hi) error("ascending ranges are not supported");
+            d.width = hi - lo + 1;
+        }
+    }
+
+    bool isTypeStart() const
+    {
+        return isIdent("logic") || isIdent("integer") || isIdent("reg") ||
+               isIdent("wire") || isIdent("bit");
+    }
+
+    // Parse type keyword and type, return base declaration
+    Decl parseBaseType()
+    {
+        Decl d;
+        d.line = line();
+        if (acceptIdent("integer")) {
+            d.isInteger = true;
+            d.isSigned = !acceptIdent("unsigned");
+            d.width = 32;
+        } else if (acceptIdent("logic") || acceptIdent("reg") ||
+                   acceptIdent("wire") || acceptIdent("bit")) {
+            parseType(d);
+        } else {
+            error("type expected");
+        }
+        return d;
+    }
+
+    // Parse name with unpacked dimensions
+    void parseDims(Decl& d)
+    {
+        while (accept("[")) {
+            unsigned a = constValue(parseExpr());
+            if (accept(":")) {
+                unsigned b = constValue(parseExpr());
+                if (a != 0) error("array range must start from zero");
+                a = b + 1;
+            }
+            expect("]");
+            d.dims.push_back(a);
+        }
+    }
+
+    // Parse declaration list finished with semicolon
+    std::vector<Decl> parseDeclList(bool isParam)
+    {
+        Decl base;
+        if (isParam && !isTypeStart()) {
+            base.width = 32;
+            base.isSigned = true;
+            base.line = line();
+        } else {
+            base = parseBaseType();
+        }
+        base.isParam = isParam;
+
+        std::vector<Decl> res;
+        do {
+            Decl d = base;
+            d.line = line();
+            d.name = name();
+            parseDims(d);
+            if (accept("=")) {
+                d.init = parseExpr();
+            }
+            res.push_back(d);
+            if (isParam) params.push_back(d);
+        } while (accept(","));
+        expect(";");
+        return res;
+    }
+
+    Port parsePort()
+    {
+        Port port;
+        if (acceptIdent("input")) port.dir = PortDir::Input;
+        else if (acceptIdent("output")) port.dir = PortDir::Output;
+        else if (acceptIdent("inout")) port.dir = PortDir::Inout;
+        else error("port direction expected");
+
+        if (isTypeStart()) {
+            port.decl = parseBaseType();
+        } else {
+            port.decl.line = line();
+            parseType(port.decl);
+        }
+        port.decl.name = name();
+        parseDims(port.decl);
+        return port;
+    }
+
+    //-------------------------------------------------------------------------
+    // Module items
+
+    Module parseModule()
+    {
+        params.clear();
+        Module mod;
+        mod.line = line();
+        expectIdent("module");
+        mod.name = name();
+        if (isPunct("#")) error("module parameters are not supported");
+
+        if (accept("(")) {
+            if (!isPunct(")")) {
+                do {
+                    mod.ports.push_back(parsePort());
+                } while (accept(","));
+            }
+            expect(")");
+        }
+        expect(";");
+
+        unsigned assignNum = 0;
+        while (!acceptIdent("endmodule")) {
+            if (atEnd()) error("endmodule expected");
+
+            if (accept(";")) {
+
+            } else if (isAssertProperty()) {
+                skipAssertProperty();
+
+            } else if (isTypeStart()) {
+                for (auto& d : parseDeclList(false)) mod.vars.push_back(d);
+
+            } else if (acceptIdent("localparam") || acceptIdent("parameter")) {
+                for (auto& d : parseDeclList(true)) mod.vars.push_back(d);
+
+            } else if (isIdent("assign")) {
+                Process proc;
+                proc.kind = Process::Assign;
+                proc.line = line();
+                proc.name = "assign_" + std::to_string(assignNum++);
+                p++;
+                auto st = std::make_shared<Stmt>(StmtKind::Assign, line());
+                st->lhs = parseExpr();
+                st->name = "=";
+                expect("=");
+                st->rhs = parseExpr();
+                expect(";");
+                proc.body = st;
+                mod.procs.push_back(proc);
+
+            } else if (isIdent("always_comb") || isIdent("always_latch")) {
+                Process proc;
+                proc.kind = isIdent("always_comb") ? Process::Comb :
+                                                     Process::Latch;
+                proc.line = line();
+                p++;
+                proc.body = parseStmt();
+                proc.name = proc.body->kind == StmtKind::Block ?
+                            proc.body->name : "";
+                mod.procs.push_back(proc);
+
+            } else if (isIdent("always_ff") || isIdent("always")) {
+                Process proc;
+                proc.kind = Process::Ff;
+                proc.line = line();
+                p++;
+                expect("@");
+                expect("(");
+                do {
+                    Edge edge;
+                    if (acceptIdent("posedge")) edge.posedge = true;
+                    else if (acceptIdent("negedge")) edge.posedge = false;
+                    else error("edge expected");
+                    edge.signal = parsePostfix();
+                    proc.edges.push_back(edge);
+                } while (acceptIdent("or") || accept(","));
+                expect(")");
+                proc.body = parseStmt();
+                proc.name = proc.body->kind == StmtKind::Block ?
+                            proc.body->name : "";
+                mod.procs.push_back(proc);
+
+            } else if (isIdent("function")) {
+                mod.funcs.push_back(parseFunction());
+
+            } else if (cur().kind == TokKind::Ident &&
+                       peek().kind == TokKind::Ident && peek(2).text == "(") {
+                mod.insts.push_back(parseInstance());
+
+            } else {
+                error("unsupported module item");
+            }
+        }
+        return mod;
+    }
+
+    Function parseFunction()
+    {
+        Function f;
+        f.line = line();
+        expectIdent("function");
+        acceptIdent("automatic");
+        acceptIdent("static");
+        if (acceptIdent("void")) {
+            f.isVoid = true;
+        } else {
+            f.isVoid = false;
+            if (isTypeStart()) {
+                f.result = parseBaseType();
+            } else {
+                f.result.line = line();
+                parseType(f.result);
+            }
+        }
+        f.name = name();
+        f.result.name = f.name;
+
+        if (accept("(")) {
+            if (!isPunct(")")) {
+                do {
+                    f.params.push_back(parsePort());
+                } while (accept(","));
+            }
+            expect(")");
+        }
+        expect(";");
+
+        auto block = std::make_shared<Stmt>(StmtKind::Block, line());
+        while (!acceptIdent("endfunction")) {
+            if (atEnd()) error("endfunction expected");
+            parseBlockItem(block->stmts);
+        }
+        if (accept(":")) name();
+        f.body = block;
+        return f;
+    }
+
+    Instance parseInstance()
+    {
+        Instance inst;
+        inst.line = line();
+        inst.moduleName = name();
+        inst.name = name();
+        expect("(");
+        if (!isPunct(")")) {
+            do {
+                expect(".");
+                std::string port = name();
+                expect("(");
+                ExprPtr e = isPunct(")") ? nullptr : parseExpr();
+                expect(")");
+                inst.binds.emplace_back(port, e);
+            } while (accept(","));
+        }
+        expect(")");
+        expect(";");
+        return inst;
+    }
+
+    //-------------------------------------------------------------------------
+    // Statements
+
+    // Parse declaration or statement into block item list
+    void parseBlockItem(std::vector<StmtPtr>& stmts)
+    {
+        if (isTypeStart() || isIdent("localparam") || isIdent("parameter")) {
+            bool isParam = acceptIdent("localparam") ||
+                           acceptIdent("parameter");
+            for (auto& d : parseDeclList(isParam)) {
+                auto st = std::make_shared<Stmt>(StmtKind::Decl, d.line);
+                st->decl = d;
+                stmts.push_back(st);
+            }
+        } else {
+            stmts.push_back(parseStmt());
+        }
+    }
+
+    StmtPtr parseStmt()
+    {
+        unsigned ln = line();
+
+        if (accept(";")) {
+            return std::make_shared<Stmt>(StmtKind::Empty, ln);
+        }
+        if (isAssertProperty()) {
+            skipAssertProperty();
+            return std::make_shared<Stmt>(StmtKind::Empty, ln);
+        }
+        if (acceptIdent("begin")) {
+            auto st = std::make_shared<Stmt>(StmtKind::Block, ln);
+            if (accept(":")) st->name = name();
+            while (!acceptIdent("end")) {
+                if (atEnd()) error("end expected");
+                parseBlockItem(st->stmts);
+            }
+            if (accept(":")) name();
+            return st;
+        }
+        if (acceptIdent("if")) {
+            auto st = std::make_shared<Stmt>(StmtKind::If, ln);
+            expect("(");
+            st->cond = parseExpr();
+            expect(")");
+            st->stmts.push_back(parseStmt());
+            if (acceptIdent("else")) {
+                st->stmts.push_back(parseStmt());
+            }
+            return st;
+        }
+        if (acceptIdent("unique") || acceptIdent("priority")) {
+            if (!isIdent("case") && !isIdent("if")) error("case expected");
+            return parseStmt();
+        }
+        if (acceptIdent("case")) {
+            auto st = std::make_shared<Stmt>(StmtKind::Case, ln);
+            expect("(");
+            st->cond = parseExpr();
+            expect(")");
+            while (!acceptIdent("endcase")) {
+                if (atEnd()) error("endcase expected");
+                CaseItem item;
+                if (acceptIdent("default")) {
+                    accept(":");
+                } else {
+                    do {
+                        item.labels.push_back(parseExpr());
+                    } while (accept(","));
+                    expect(":");
+                }
+                item.body = parseStmt();
+                st->items.push_back(item);
+            }
+            return st;
+        }
+        if (acceptIdent("for")) {
+            auto st = std::make_shared<Stmt>(StmtKind::For, ln);
+            expect("(");
+            if (!isPunct(";")) {
+                do {
+                    if (isTypeStart()) {
+                        auto init = std::make_shared<Stmt>(StmtKind::Decl,
+                                                           line());
+                        init->decl = parseBaseType();
+                        init->decl.name = name();
+                        expect("=");
+                        init->decl.init = parseExpr();
+                        st->stmts.push_back(init);
+                    } else {
+                        st->stmts.push_back(parseSimpleStmt());
+                    }
+                } while (accept(","));
+            }
+            expect(";");
+            if (!isPunct(";")) st->cond = parseExpr();
+            expect(";");
+            if (!isPunct(")")) st->step = parseSimpleStmt();
+            expect(")");
+            st->body = parseStmt();
+            return st;
+        }
+        if (acceptIdent("while")) {
+            auto st = std::make_shared<Stmt>(StmtKind::While, ln);
+            expect("(");
+            st->cond = parseExpr();
+            expect(")");
+            st->body = parseStmt();
+            return st;
+        }
+        if (acceptIdent("do")) {
+            auto st = std::make_shared<Stmt>(StmtKind::DoWhile, ln);
+            st->body = parseStmt();
+            expectIdent("while");
+            expect("(");
+            st->cond = parseExpr();
+            expect(")");
+            expect(";");
+            return st;
+        }
+        if (acceptIdent("forever")) {
+            auto st = std::make_shared<Stmt>(StmtKind::While, ln);
+            auto one = std::make_shared<Expr>(ExprKind::Number, ln);
+            one->value.push_back(1);
+            one->isSigned = true;
+            st->cond = one;
+            st->body = parseStmt();
+            return st;
+        }
+        if (acceptIdent("break")) {
+            expect(";");
+            return std::make_shared<Stmt>(StmtKind::Break, ln);
+        }
+        if (acceptIdent("continue")) {
+            expect(";");
+            return std::make_shared<Stmt>(StmtKind::Continue, ln);
+        }
+        if (acceptIdent("return")) {
+            auto st = std::make_shared<Stmt>(StmtKind::Return, ln);
+            if (!isPunct(";")) st->rhs = parseExpr();
+            expect(";");
+            return st;
+        }
+        if (acceptIdent("assert")) {
+            auto st = std::make_shared<Stmt>(StmtKind::Assert, ln);
+            expect("(");
+            st->cond = parseExpr();
+            expect(")");
+            if (acceptIdent("else")) {
+                if (cur().kind != TokKind::Ident || cur().text[0] != '$') {
+                    error("system task expected");
+                }
+                p++;
+                if (accept("(")) {
+                    if (cur().kind == TokKind::String) {
+                        st->name = cur().text;
+                    }
+                    p--;
+                    skipBalanced();
+                }
+            }
+            expect(";");
+            return st;
+        }
+        if (cur().kind == TokKind::Ident && cur().text[0] == '$') {
+            // System task like $display, ignored
+            p++;
+            if (isPunct("(")) skipBalanced();
+            expect(";");
+            return std::make_shared<Stmt>(StmtKind::Empty, ln);
+        }
+        if (acceptIdent("disable")) {
+            error("disable statement is not supported");
+        }
+
+        auto st = parseSimpleStmt();
+        expect(";");
+        return st;
+    }
+
+    // Assignment, increment/decrement or function call without semicolon
+    StmtPtr parseSimpleStmt()
+    {
+        unsigned ln = line();
+
+        // Function call without arguments or with arguments
+        if (cur().kind == TokKind::Ident &&
+            (peek().text == ";" || peek().text == "(")) {
+            auto st = std::make_shared<Stmt>(StmtKind::Call, ln);
+            st->name = name();
+            if (accept("(")) {
+                if (!isPunct(")")) {
+                    do {
+                        st->args.push_back(parseExpr());
+                    } while (accept(","));
+                }
+                expect(")");
+            }
+            return st;
+        }
+        if (isPunct("++") || isPunct("--")) {
+            auto st = std::make_shared<Stmt>(StmtKind::ExprStmt, ln);
+            st->rhs = parseUnary();
+            return st;
+        }
+
+        ExprPtr lhs = parsePostfix();
+        if (isPunct("++") || isPunct("--")) {
+            auto e = std::make_shared<Expr>(ExprKind::IncDec, ln);
+            e->op = t[p++].text;
+            e->args.push_back(lhs);
+            auto st = std::make_shared<Stmt>(StmtKind::ExprStmt, ln);
+            st->rhs = e;
+            return st;
+        }
+
+        static const char* const ASSIGN_OPS[] = {
+            "=", "<=", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=",
+            "<<=", ">>=", "<<<=", ">>>="
+        };
+        for (const char* op : ASSIGN_OPS) {
+            if (accept(op)) {
+                auto st = std::make_shared<Stmt>(StmtKind::Assign, ln);
+                st->name = op;
+                st->lhs = lhs;
+                st->rhs = parseExpr();
+                return st;
+            }
+        }
+        error("statement expected");
+    }
+
+    //-------------------------------------------------------------------------
+    // Expressions
+
+    ExprPtr parseExpr()
+    {
+        return parseTernary();
+    }
+
+    ExprPtr parseTernary()
+    {
+        ExprPtr c = parseBinary(0);
+        if (isPunct("?")) {
+            unsigned ln = line();
+            p++;
+            auto e = std::make_shared<Expr>(ExprKind::Ternary, ln);
+            e->args.push_back(c);
+            e->args.push_back(parseTernary());
+            expect(":");
+            e->args.push_back(parseTernary());
+            return e;
+        }
+        return c;
+    }
+
+    // Binary operator precedence, higher binds tighter, 0 if not binary
+    static unsigned precedence(const Token& tok)
+    {
+        if (tok.kind != TokKind::Punct) return 0;
+        static const std::unordered_map<std::string, unsigned> prec = {
+            {"||", 1}, {"&&", 2}, {"|", 3}, {"^", 4}, {"~^", 4}, {"^~", 4},
+            {"&", 5}, {"==", 6}, {"!=", 6}, {"===", 6}, {"!==", 6},
+            {"<", 7}, {"<=", 7}, {">", 7}, {">=", 7},
+            {"<<", 8}, {">>", 8}, {"<<<", 8}, {">>>", 8},
+            {"+", 9}, {"-", 9}, {"*", 10}, {"/", 10}, {"%", 10}, {"**", 11}
+        };
+        auto i = prec.find(tok.text);
+        return i == prec.end() ? 0 : i->second;
+    }
+
+    ExprPtr parseBinary(unsigned minPrec)
+    {
+        ExprPtr lhs = parseUnary();
+        while (true) {
+            unsigned prec = precedence(cur());
+            if (prec == 0 || prec <= minPrec) break;
+            unsigned ln = line();
+            std::string op = t[p++].text;
+            ExprPtr rhs = parseBinary(prec);
+            auto e = std::make_shared<Expr>(ExprKind::Binary, ln);
+            e->op = op == "===" ? "==" : op == "!==" ? "!=" :
+                    op == "^~" ? "~^" : op;
+            e->args.push_back(lhs);
+            e->args.push_back(rhs);
+            lhs = e;
+        }
+        return lhs;
+    }
+
+    ExprPtr parseUnary()
+    {
+        unsigned ln = line();
+        static const char* const UNARY_OPS[] = {
+            "+", "-", "!", "~", "&", "|", "^", "~&", "~|", "~^", "^~"
+        };
+        for (const char* op : UNARY_OPS) {
+            if (accept(op)) {
+                auto e = std::make_shared<Expr>(ExprKind::Unary, ln);
+                e->op = std::string(op) == "^~" ? "~^" : op;
+                e->args.push_back(parseUnary());
+                return e;
+            }
+        }
+        if (isPunct("++") || isPunct("--")) {
+            auto e = std::make_shared<Expr>(ExprKind::IncDec, ln);
+            e->op = t[p++].text;
+            e->prefix = true;
+            e->args.push_back(parseUnary());
+            return e;
+        }
+        ExprPtr e = parsePostfix();
+        if (isPunct("++") || isPunct("--")) {
+            auto ie = std::make_shared<Expr>(ExprKind::IncDec, ln);
+            ie->op = t[p++].text;
+            ie->args.push_back(e);
+            return ie;
+        }
+        return e;
+    }
+
+    ExprPtr parsePostfix()
+    {
+        ExprPtr e = parsePrimary();
+        while (isPunct("[")) {
+            unsigned ln = line();
+            p++;
+            ExprPtr i = parseExpr();
+            if (accept(":")) {
+                auto r = std::make_shared<Expr>(ExprKind::Range, ln);
+                r->args = {e, i, parseExpr()};
+                e = r;
+            } else if (isPunct("+:") || isPunct("-:")) {
+                auto r = std::make_shared<Expr>(ExprKind::PartSel, ln);
+                r->op = t[p++].text;
+                r->args = {e, i, parseExpr()};
+                e = r;
+            } else {
+                auto r = std::make_shared<Expr>(ExprKind::Index, ln);
+                r->args = {e, i};
+                e = r;
+            }
+            expect("]");
+        }
+        return e;
+    }
+
+    ExprPtr parsePrimary()
+    {
+        unsigned ln = line();
+        const Token& tok = cur();
+
+        if (tok.kind == TokKind::Number) {
+            p++;
+            // Size cast N'(x)
+            if (!tok.based && !tok.fill && isPunct("'(")) {
+                p++;
+                auto e = std::make_shared<Expr>(ExprKind::Cast, ln);
+                e->width = (unsigned)tok.value[0];
+                e->args.push_back(parseExpr());
+                expect(")");
+                if (e->width == 0) error("zero width cast");
+                return e;
+            }
+            auto e = std::make_shared<Expr>(tok.fill ? ExprKind::Fill :
+                                            ExprKind::Number, ln);
+            e->value = tok.value;
+            e->width = tok.width;
+            e->isSigned = tok.isSigned;
+            e->based = tok.based;
+            return e;
+        }
+        if (accept("(")) {
+            ExprPtr e = parseExpr();
+            expect(")");
+            return e;
+        }
+        if (accept("'{")) {
+            auto e = std::make_shared<Expr>(ExprKind::Pattern, ln);
+            if (acceptIdent("default")) {
+                // '{default:x} stored with operator name
+                expect(":");
+                e->op = "default";
+                e->args.push_back(parseExpr());
+                expect("}");
+                return e;
+            }
+            do {
+                e->args.push_back(parseExpr());
+            } while (accept(","));
+            expect("}");
+            return e;
+        }
+        if (accept("{")) {
+            ExprPtr first = parseExpr();
+            if (accept("{")) {
+                // Replication
+                auto e = std::make_shared<Expr>(ExprKind::Repl, ln);
+                auto c = std::make_shared<Expr>(ExprKind::Concat, ln);
+                do {
+                    c->args.push_back(parseExpr());
+                } while (accept(","));
+                expect("}");
+                expect("}");
+                e->args = {first, c};
+                return e;
+            }
+            auto e = std::make_shared<Expr>(ExprKind::Concat, ln);
+            e->args.push_back(first);
+            while (accept(",")) {
+                e->args.push_back(parseExpr());
+            }
+            expect("}");
+            return e;
+        }
+        if (tok.kind == TokKind::Ident) {
+            // Sign cast
+            if ((tok.text == "signed" || tok.text == "unsigned") &&
+                peek().text == "'(") {
+                p += 2;
+                auto e = std::make_shared<Expr>(ExprKind::Cast, ln);
+                e->op = tok.text;
+                e->isSigned = tok.text == "signed";
+                e->args.push_back(parseExpr());
+                expect(")");
+                return e;
+            }
+            if (tok.text == "$signed" || tok.text == "$unsigned") {
+                p++;
+                auto e = std::make_shared<Expr>(ExprKind::Cast, ln);
+                e->op = tok.text.substr(1);
+                e->isSigned = tok.text == "$signed";
+                expect("(");
+                e->args.push_back(parseExpr());
+                expect(")");
+                return e;
+            }
+            std::string id = tok.text;
+            p++;
+            if (id[0] == '$' || isPunct("(")) {
+                auto e = std::make_shared<Expr>(ExprKind::Call, ln);
+                e->op = id;
+                if (accept("(")) {
+                    if (!isPunct(")")) {
+                        do {
+                            e->args.push_back(parseExpr());
+                        } while (accept(","));
+                    }
+                    expect(")");
+                }
+                return e;
+            }
+            auto e = std::make_shared<Expr>(ExprKind::Ident, ln);
+            e->op = id;
+            return e;
+        }
+        error("expression expected");
+    }
+
+    std::vector<Token> t;
+    unsigned p = 0;
+    /// Local parameters of current module to evaluate widths
+    std::vector<Decl> params;
+};
+
+}  // namespace
+
+//=============================================================================
+
+std::vector<Module> parseSv(const std::string& text)
+{
+    Lexer lexer(text);
+    Parser parser(lexer.run());
+    return parser.run();
+}
+
+bool evalConst(const ExprPtr& e, const std::vector<Decl>& params,
+               int64_t& res)
+{
+    if (!e) return false;
+
+    switch (e->kind) {
+    case ExprKind::Number: {
+        for (size_t i = 1; i < e->value.size(); i++) {
+            if (e->value[i]) return false;
+        }
+        uint64_t v = e->value[0];
+        if (e->width && e->width < 64) {
+            v &= (1ULL << e->width) - 1;
+            if (e->isSigned && (v >> (e->width-1))) {
+                v |= ~((1ULL << e->width) - 1);
+            }
+        }
+        res = (int64_t)v;
+        return true;
+    }
+    case ExprKind::Ident: {
+        for (auto i = params.rbegin(); i != params.rend(); ++i) {
+            if (i->name == e->op) {
+                return i->dims.empty() && evalConst(i->init, params, res);
+            }
+        }
+        return false;
+    }
+    case ExprKind::Unary: {
+        int64_t a;
+        if (!evalConst(e->args[0], params, a)) return false;
+        if (e->op == "-") res = -a;
+        else if (e->op == "+") res = a;
+        else if (e->op == "!") res = !a;
+        else if (e->op == "~") res = ~a;
+        else return false;
+        return true;
+    }
+    case ExprKind::Binary: {
+        int64_t a, b;
+        if (!evalConst(e->args[0], params, a) ||
+            !evalConst(e->args[1], params, b)) return false;
+        const std::string& op = e->op;
+        if (op == "+") res = a + b;
+        else if (op == "-") res = a - b;
+        else if (op == "*") res = a * b;
+        else if (op == "/" && b) res = a / b;
+        else if (op == "%" && b) res = a % b;
+        else if (op == "<<" || op == "<<<") res = b < 64 ? a << b : 0;
+        else if (op == ">>" || op == ">>>") res = b < 64 ? a >> b : 0;
+        else if (op == "&") res = a & b;
+        else if (op == "|") res = a | b;
+        else if (op == "^") res = a ^ b;
+        else if (op == "==") res = a == b;
+        else if (op == "!=") res = a != b;
+        else if (op == "<") res = a < b;
+        else if (op == "<=") res = a <= b;
+        else if (op == ">") res = a > b;
+        else if (op == ">=") res = a >= b;
+        else if (op == "&&") res = a && b;
+        else if (op == "||") res = a || b;
+        else return false;
+        return true;
+    }
+    case ExprKind::Ternary: {
+        int64_t c;
+        if (!evalConst(e->args[0], params, c)) return false;
+        return evalConst(e->args[c ? 1 : 2], params, res);
+    }
+    case ExprKind::Call: {
+        if (e->op == "$clog2" && e->args.size() == 1) {
+            int64_t a;
+            if (!evalConst(e->args[0], params, a)) return false;
+            res = 0;
+            while ((1LL << res) < a) res++;
+            return true;
+        }
+        return false;
+    }
+    default:
+        return false;
+    }
+}
+
+}  // namespace sv
+}  // namespace sc
@@ -0,0 +1,221 @@
+/******************************************************************************
+ * Copyright (c) 2020, Intel Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ *
+ *****************************************************************************/
+
+/**
+ * Parser of generated SystemVerilog used by C++ model generator.
+ *
+ * Accepts the subset of SystemVerilog produced by the tool: ANSI module
+ * headers, logic/integer variables and local parameters, always_comb,
+ * always_latch, always_ff, continuous assignments, void functions and
+ * module instances. Concurrent assertions (assert property) are skipped.
+ */
+
+#ifndef SCSVPARSER_H
+#define SCSVPARSER_H
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sc {
+namespace sv {
+
+/// Parser error, contains line in the parsed text
+class SvParseError : public std::runtime_error
+{
+public:
+    SvParseError(unsigned line, const std::string& msg) :
+        std::runtime_error("line " + std::to_string(line) + ": " + msg),
+        line(line)
+    {}
+
+    unsigned line;
+};
+
+//=============================================================================
+
+enum class ExprKind {
+    Ident,          // variable, port or parameter
+    Number,         // literal, sized or unsized
+    Fill,           // '0 or '1
+    Unary,          // unary operator including reduction, @op
+    Binary,         // binary operator, @op
+    Ternary,        // args: condition, then, else
+    Index,          // args: base, index
+    Range,          // args: base, high, low
+    PartSel,        // args: base, low index, width, @op is "+:" or "-:"
+    Concat,         // args: concatenated expressions
+    Repl,           // args: count, concatenation
+    Cast,           // N'(x), signed'(x), unsigned'(x), $signed(x), $unsigned(x)
+    Call,           // function call, @op is function name
+    IncDec,         // ++/-- in @op, @prefix
+    Pattern         // '{...} assignment pattern
+};
+
+struct Expr;
+typedef std::shared_ptr<Expr> ExprPtr;
+
+struct Expr
+{
+    explicit Expr(ExprKind kind, unsigned line) : kind(kind), line(line)
+    {}
+
+    ExprKind kind;
+    unsigned line;
+    /// Identifier/function name or operator
+    std::string op;
+    std::vector<ExprPtr> args;
+
+    /// Number: value words, least significant first
+    std::vector<uint64_t> value;
+    /// Number: width, 0 for unsized; Cast: target width, 0 for sign cast
+    unsigned width = 0;
+    /// Number: signed literal; Cast: signed target
+    bool isSigned = false;
+    /// Number: based literal like 'h1F or 4'b0101
+    bool based = false;
+    /// IncDec: prefix form
+    bool prefix = false;
+
+    /// Self-determined width and signedness, filled by model writer
+    int selfWidth = -1;
+    bool selfSigned = false;
+};
+
+//=============================================================================
+
+/// Variable, parameter, port or function argument declaration
+struct Decl
+{
+    std::string name;
+    unsigned line = 0;
+    /// SV integer type
+    bool isInteger = false;
+    bool isSigned = false;
+    unsigned width = 1;
+    /// Unpacked array dimensions, outer first
+    std::vector<unsigned> dims;
+    ExprPtr init;
+    bool isParam = false;
+};
+
+enum class StmtKind {
+    Block, If, Case, For, While, DoWhile, Break, Continue, Return,
+    Assign, ExprStmt, Call, Assert, Decl, Empty
+};
+
+struct Stmt;
+typedef std::shared_ptr<Stmt> StmtPtr;
+
+struct CaseItem
+{
+    /// Empty for default item
+    std::vector<ExprPtr> labels;
+    StmtPtr body;
+};
+
+struct Stmt
+{
+    explicit Stmt(StmtKind kind, unsigned line) : kind(kind), line(line)
+    {}
+
+    StmtKind kind;
+    unsigned line;
+    /// Block label, called function name, assignment operator
+    /// ("=", "<=", "+=", ...) or assertion message
+    std::string name;
+    /// Block, For: init statements; If: then/else branches; For: step
+    std::vector<StmtPtr> stmts;
+    /// If/Case/loop condition, assigned value, called function arguments
+    ExprPtr cond;
+    ExprPtr lhs;
+    ExprPtr rhs;
+    std::vector<ExprPtr> args;
+    std::vector<CaseItem> items;
+    /// Declaration statement
+    Decl decl;
+    /// For loop: step statement and body, While: body
+    StmtPtr step;
+    StmtPtr body;
+};
+
+//=============================================================================
+
+enum class PortDir { Input, Output, Inout };
+
+struct Port
+{
+    PortDir dir;
+    Decl decl;
+};
+
+struct Edge
+{
+    bool posedge;
+    /// Clock or reset, variable or array element
+    ExprPtr signal;
+};
+
+struct Process
+{
+    enum Kind { Comb, Latch, Assign, Ff };
+
+    Kind kind;
+    std::string name;
+    unsigned line;
+    /// Process body, Assign statement for continuous assignment
+    StmtPtr body;
+    /// Sensitivity of always_ff
+    std::vector<Edge> edges;
+};
+
+struct Function
+{
+    std::string name;
+    unsigned line;
+    bool isVoid = true;
+    Decl result;
+    std::vector<Port> params;
+    /// Local declarations and statements
+    StmtPtr body;
+};
+
+struct Instance
+{
+    std::string moduleName;
+    std::string name;
+    unsigned line;
+    /// Port name and bound expression
+    std::vector<std::pair<std::string, ExprPtr>> binds;
+};
+
+struct Module
+{
+    std::string name;
+    unsigned line;
+    std::vector<Port> ports;
+    /// Variables and local parameters in declaration order
+    std::vector<Decl> vars;
+    std::vector<Function> funcs;
+    std::vector<Process> procs;
+    std::vector<Instance> insts;
+};
+
+/// Parse generated SystemVerilog text, throws SvParseError
+std::vector<Module> parseSv(const std::string& text);
+
+/// Evaluate constant expression with given local parameters,
+/// return false if expression is not constant or does not fit 64bit
+bool evalConst(const ExprPtr& expr, const std::vector<Decl>& params,
+               int64_t& res);
+
+}  // namespace sv
+}  // namespace sc
+
+#endif /* SCSVPARSER_H */
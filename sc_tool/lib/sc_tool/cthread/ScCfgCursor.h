@@ -66,6 +66,16 @@ public:
         return block;
     }
 
+    /// Statement of the element, nullptr if the element is not a statement
+    const clang::Stmt *getStmt() const
+    {
+        auto elm = block->operator [](elementID);
+        if (auto cfgstmt = elm.getAs<clang::CFGStmt>()) {
+            return cfgstmt->getStmt();
+        }
+        return nullptr;
+    }
+
     bool isValid() const
     {
         return (funcDecl != nullptr) && (block != nullptr);
@@ -208,7 +208,8 @@ sc_elab::VerilogProcCode ThreadBuilder::run()
 //            cout << "   functions evaluated as constant :" << endl;
 //        }
 //
-//        auto callExpr = dyn_cast<const CallExpr>(entry.first.back());
+//        auto callExpr = dyn_cast<const CallExpr>(
+//                    travConst->getCallContexts()->getStmt(entry.first));
 //        cout << "    " << callExpr->getDirectCallee()->getNameAsString() 
 //             << " " << entry.second << endl;
 //    }
@@ -323,11 +324,13 @@ sc_elab::VerilogProcCode ThreadBuilder::run()
 
     travProc->setHasReset(!procView.resets().empty());
     travProc->setMainLoopStmt(travConst->getMainLoopStmt());
-    travProc->setTermConds(travConst->getTermConds());
-    travProc->setLiveStmts(travConst->getLiveStmts());
-    travProc->setLiveTerms(travConst->getLiveTerms());
+    travProc->setCallContexts(travConst->getCallContexts());
+    travProc->setTermConds(travConst->takeTermConds());
+    travProc->setLiveStmts(travConst->takeLiveStmts());
+    travProc->setLiveTerms(travConst->takeLiveTerms());
     travProc->setWaitFuncs(travConst->getWaitFuncs());
-    travProc->setConstEvalFuncs(travConst->getConstEvalFuncs());
+    travProc->setConstEvalFuncs(travConst->takeConstEvalFuncs());
+    travProc->setVerilogModule(verMod);
     
     // Traverse context stack, used to run TraverseProc
     traverseContextMap[RESET_ID] = ScProcContext();
@@ -27,7 +27,9 @@ operator () (const std::pair<unsigned, unsigned>& obj) const
 namespace sc {
 
 /// All reported issues to filter duplicates
-std::unordered_set<std::pair<unsigned, unsigned>> ScDiag::diagIssues;
+std::unordered_set<uint64_t> ScDiag::diagIssues;
+thread_local std::unordered_set<uint64_t> ScDiag::threadDiagIssues;
+std::recursive_mutex ScDiag::engineMutex;
 
     
 class ScDiagBuilder {
@@ -37,8 +39,11 @@ public:
         scDiag.engine = diagEngine;
         scDiag.initialize();
 
+        // Map is ordered, so last element has maximal ID
+        scDiag.sc2clangIds.assign(scDiag.idFormatMap.rbegin()->first+1, 0);
+        
         for (const auto &scid : scDiag.idFormatMap) {
-            scDiag.sc2clangMap[scid.first] =
+            scDiag.sc2clangIds[scid.first] =
                 scDiag.engine->getDiagnosticIDs()->getCustomDiagID(
                                     scid.second.first, scid.second.second);
         }
@@ -62,6 +67,19 @@ public:
         }
         return 0;
     }
+    
+    static void resetDiagnosticStatus() {
+        std::lock_guard<std::recursive_mutex> lock(ScDiag::engineMutex);
+        auto &scDiag = ScDiag::instance();
+        scDiag.hasException = false;
+        resetDiagnosticIssues();
+    }
+    
+    static void resetDiagnosticIssues() {
+        std::lock_guard<std::recursive_mutex> lock(ScDiag::engineMutex);
+        ScDiag::diagIssues.clear();
+        ScDiag::threadDiagIssues.clear();
+    }
 };
 
 void initDiagnosticEngine(clang::DiagnosticsEngine *diagEngine) {
@@ -76,6 +94,14 @@ int getDiagnosticStatus() {
     return ScDiagBuilder::getDiagnosticStatus();
 }
 
+void resetDiagnosticStatus() {
+    ScDiagBuilder::resetDiagnosticStatus();
+}
+
+void resetDiagnosticIssues() {
+    ScDiagBuilder::resetDiagnosticIssues();
+}
+
 ScDiag &sc::ScDiag::instance() {
     static ScDiag s;
     return s;
@@ -84,8 +110,8 @@ ScDiag &sc::ScDiag::instance() {
 void ScDiag::reportErrAndDie(clang::SourceLocation loc,
                              llvm::StringRef message) 
 {
+    std::lock_guard<std::recursive_mutex> lock(engineMutex);
     auto &engine = *(instance().engine);
-    engine.setSuppressAllDiagnostics(false);
     auto id = engine.getDiagnosticIDs()->getCustomDiagID(
                                 clang::DiagnosticIDs::Fatal, message);
     engine.Report(loc, id);
@@ -100,8 +126,8 @@ clang::DiagnosticBuilder ScDiag::reportCustom(clang::SourceLocation loc,
                                               clang::DiagnosticIDs::Level level,
                                               llvm::StringRef formatString) 
 {
+    std::lock_guard<std::recursive_mutex> lock(engineMutex);
     auto &engine = *instance().engine;
-    engine.setSuppressAllDiagnostics(false);
     auto id = engine.getDiagnosticIDs()->getCustomDiagID(level, formatString);
     return engine.Report(loc, id);
 }
@@ -111,26 +137,33 @@ clang::DiagnosticBuilder ScDiag::reportCustom(clang::DiagnosticIDs::Level level,
     return ScDiag::reportCustom(clang::SourceLocation(), level, formatString);
 }
 
-clang::DiagnosticBuilder ScDiag::reportScDiag(clang::SourceLocation loc,
-                                              ScDiag::ScDiagID id, 
-                                              bool checkDuplicate) 
+ScDiagStream ScDiag::reportScDiag(clang::SourceLocation loc,
+                                  ScDiag::ScDiagID id, 
+                                  bool checkDuplicate) 
 {
-    auto &engine = *instance().engine;
-    engine.setSuppressAllDiagnostics(false);
-    auto issue = std::make_pair(loc.getRawEncoding(), unsigned(id));
+    uint64_t issue = (uint64_t(loc.getRawEncoding()) << 32) | unsigned(id);
 
-    // Avoid duplicates
+    // Avoid duplicates, issue reported in this thread checked without lock
+    if (checkDuplicate && threadDiagIssues.count(issue) != 0) {
+        return ScDiagStream();
+    }
+    
+    std::unique_lock<std::recursive_mutex> lock(engineMutex);
     if (checkDuplicate) {
-        if (diagIssues.count(issue) != 0) engine.setSuppressAllDiagnostics(true);
-        diagIssues.insert(issue);
+        threadDiagIssues.insert(issue);
+        if (!diagIssues.insert(issue).second) {
+            return ScDiagStream();
+        }
     }
     
-    auto clangId = instance().sc2clangMap.at(id);
-    return engine.Report(loc, clangId);
+    auto &engine = *instance().engine;
+    auto clangId = instance().sc2clangIds[id];
+    auto builder = engine.Report(loc, clangId);
+    return ScDiagStream(std::move(lock), std::move(builder));
 }
 
-clang::DiagnosticBuilder ScDiag::reportScDiag(ScDiag::ScDiagID id,
-                                              bool checkDuplicate) {
+ScDiagStream ScDiag::reportScDiag(ScDiag::ScDiagID id,
+                                  bool checkDuplicate) {
     return ScDiag::reportScDiag(clang::SourceLocation(), id, checkDuplicate);
 }
 
@@ -16,8 +16,12 @@
 #include <clang/Basic/Diagnostic.h>
 #include <clang/Basic/DiagnosticIDs.h>
 
+#include <llvm/ADT/Optional.h>
+
 #include <unordered_set>
 #include <map>
+#include <vector>
+#include <mutex>
 #include <utility>
 
 namespace std {
@@ -60,6 +64,39 @@ void reportErrorException();
 /// Return -1 for error and -2 for fatal error
 int getDiagnosticStatus();
 
+/// Clear exception flag and reported issues before next design processing
+void resetDiagnosticStatus();
+
+/// Clear reported issues before next top processing in parameter sweep,
+/// exception flag is kept
+void resetDiagnosticIssues();
+
+/// Diagnostic report returned by ScDiag::reportScDiag(), forwards arguments
+/// to Clang diagnostic builder. Duplicate report has no builder, so it does
+/// not go to Clang diagnostic engine at all. Diagnostic engine is locked 
+/// until the report is emitted, that allows to report from several threads
+class ScDiagStream {
+public:
+    /// Duplicate report, all arguments ignored
+    ScDiagStream() = default;
+    
+    ScDiagStream(std::unique_lock<std::recursive_mutex> lock_, 
+                 clang::DiagnosticBuilder builder_) : 
+        lock(std::move(lock_)), builder(std::move(builder_))
+    {}
+    
+    template <class T>
+    const ScDiagStream& operator << (const T& val) const {
+        if (builder) *builder << val;
+        return *this;
+    }
+    
+private:
+    /// Lock is released after diagnostic emitted in builder destructor
+    std::unique_lock<std::recursive_mutex> lock;
+    llvm::Optional<clang::DiagnosticBuilder> builder;
+};
+
 /// Permanent Diagnostic IDs for issues in input source code.
 /// Use reportScDiag() to report a diagnostic message with permanent IDs.
 /// Please do not use for internal tool assertions, instead use assert()
@@ -878,11 +915,13 @@ public:
 
     /// Reporting using permanent IDs from ScDiag
     /// Usage example: reportScDiag(SC_FATAL_ELAB_TYPES_NS) << "param";
-    static clang::DiagnosticBuilder reportScDiag(clang::SourceLocation loc,
-                                                 ScDiag::ScDiagID id,
-                                                 bool checkDuplicate = true);
-    static clang::DiagnosticBuilder reportScDiag(ScDiag::ScDiagID id,
-                                                 bool checkDuplicate = true);
+    /// Duplicate report (the same location and ID) is filtered before
+    /// Clang diagnostic engine if @checkDuplicate is true
+    static ScDiagStream reportScDiag(clang::SourceLocation loc,
+                                     ScDiag::ScDiagID id,
+                                     bool checkDuplicate = true);
+    static ScDiagStream reportScDiag(ScDiag::ScDiagID id,
+                                     bool checkDuplicate = true);
     
     /// Reporting internal warning/error
     #define SCT_INTERNAL_WARNING(loc, msg) \
@@ -934,10 +973,16 @@ private:
     std::map<ScDiag::ScDiagID,
              std::pair<clang::DiagnosticIDs::Level, std::string>> idFormatMap;
 
-    /// ID -> Clang diag ID
-    std::map<ScDiag::ScDiagID, unsigned> sc2clangMap;
-    /// All reported issues to filter duplicates
-    static std::unordered_set<std::pair<unsigned, unsigned>> diagIssues;
+    /// ID -> Clang diag ID, indexed by ScDiagID
+    std::vector<unsigned> sc2clangIds;
+    
+    /// Protects diagnostic engine and @diagIssues
+    static std::recursive_mutex engineMutex;
+    /// All reported issues to filter duplicates, 
+    /// issue is source location raw encoding in high bits and ID in low bits
+    static std::unordered_set<uint64_t> diagIssues;
+    /// Issues seen in this thread, checked without lock
+    static thread_local std::unordered_set<uint64_t> threadDiagIssues;
 };
 
 } // end namespace sc
@@ -136,10 +136,28 @@ ObjectMap::resolvePointer(PtrOrRefObject ptrObj)
     // (if pointer is dangling) typed object
     TypedObject possiblePointee = ptrObj.dereference().getUnqualified();
 
+    auto i = resolvedPtrs.find(possiblePointee);
+    if (i != resolvedPtrs.end()) {
+        resolvedPtrHits++;
+        return i->second;
+    }
+
+    // Pointee is the first matching object in @allTOs, new objects are 
+    // added to the end, so only unresolved pointer can change its result
+    auto res = findPointee(possiblePointee);
+    if (res) {
+        resolvedPtrs.emplace(possiblePointee, res);
+    }
+    return res;
+}
+
+llvm::Optional<std::pair<Object *, size_t>>
+ObjectMap::findPointee(TypedObject possiblePointee) const
+{
     // Find all objects that overlap with given address in memory
     std::vector<TypedObject> typedObjsAtAddr;
     uintptr_t thisPtr = (uintptr_t)possiblePointee.getPtr();
-    for (TypedObject & to : allTOs) {
+    for (const TypedObject & to : allTOs) {
         uintptr_t startPtr = (uintptr_t)to.getPtr();
         uintptr_t endPtr = startPtr + to.getSizeInBytes();
 
@@ -290,6 +308,9 @@ void sc_elab::DesignDbGenerator::run(clang::CXXRecordDecl* modRecordDecl,
             }
 
             std::cout << "designDB.n_procs " << n_procs << "\n";
+            std::cout << "resolved pointers reused " 
+                      << memMap.getResolvedPtrHits() << "\n";
+            std::cout << "port bind chains reused " << bindedSignalHits << "\n";
         }
     } else {
         std::cerr << "Invalid Design DB, partial content: "
@@ -677,13 +698,26 @@ void DesignDbGenerator::resolvePointers()
 
 
 TypedObject DesignDbGenerator::getBindedSignal(PtrOrRefObject portPtr,
-                                               Object* ptrEO) const
+                                               Object* ptrEO)
 {
+    // Ports passed in the chain, all of them bound to the same signal
+    std::vector<const void*> chainPorts;
+    
     while (1) {
         auto pointeeTO = portPtr.dereference().getAs<RecordObject>()
             ->getDynamicTypeObject();
 
+        auto i = bindedSignals.find(pointeeTO.getPtr());
+        if (i != bindedSignals.end()) {
+            bindedSignalHits++;
+            for (auto port : chainPorts) {
+                bindedSignals.emplace(port, i->second);
+            }
+            return i->second;
+        }
+
         if (isScBasePort(pointeeTO.getType())) {
+            chainPorts.push_back(pointeeTO.getPtr());
             portPtr = getPortBindPtr(pointeeTO);
             if (portPtr.isNullPtr()) {
                 ScDiag::reportScDiag(ScDiag::ELAB_PORT_BOUND_PORT_ERROR)
@@ -694,6 +728,9 @@ TypedObject DesignDbGenerator::getBindedSignal(PtrOrRefObject portPtr,
                 ScDiag::reportScDiag(ScDiag::ELAB_PORT_BOUND_SIGNAL_ERROR) 
                             << ptrEO->sc_name();
             }
+            for (auto port : chainPorts) {
+                bindedSignals.emplace(port, pointeeTO);
+            }
             return pointeeTO;
         }
     }
@@ -56,11 +56,25 @@ public:
     /// returns object + offset (index in array)
     llvm::Optional<std::pair<Object *, size_t>> resolvePointer (PtrOrRefObject ptrObj);
 
+    /// Number of pointer resolutions taken from cache
+    size_t getResolvedPtrHits() const { return resolvedPtrHits; }
+
 private:
 
+    /// Find object at pointee address, linear in number of objects
+    llvm::Optional<std::pair<Object *, size_t>> findPointee(
+                                            TypedObject possiblePointee) const;
+
     std::unordered_map<TypedObject, Object *> rfl2ElabMap;
     std::unordered_map<const Object *, TypedObject> elab2RflMap;
     std::vector<TypedObject> allTOs;
+
+    /// Resolved pointers cache, the same process or port pointer is resolved
+    /// for each sensitivity and reset it participates in.
+    /// Unresolved pointers are not stored as added object can be its pointee
+    std::unordered_map<TypedObject, 
+                       llvm::Optional<std::pair<Object *, size_t>>> resolvedPtrs;
+    size_t resolvedPtrHits = 0;
 };
 
 class DesignDbGenerator
@@ -69,6 +83,10 @@ class DesignDbGenerator
     ElabTypeManager &typeManager;
     ObjectMap memMap;
     MangledTypeDB &typeDB = *getMangledTypeDB();
+    /// Port to final bound signal, filled in @getBindedSignal
+    std::unordered_map<const void*, TypedObject> bindedSignals;
+    /// Number of port bind chain walks taken from @bindedSignals
+    size_t bindedSignalHits = 0;
 
 public:
     typedef uint32_t ID;
@@ -130,7 +148,9 @@ private:
     /// Fill pointees for pointer and pointer-like objects
     void resolvePointers();
 
-    TypedObject getBindedSignal(PtrOrRefObject portPtr, Object* ptrEO) const;
+    /// Get signal at the end of port bind chain, the result is stored
+    /// for all ports in the chain
+    TypedObject getBindedSignal(PtrOrRefObject portPtr, Object* ptrEO);
 
     /// Create a "virtual" signal outside of module hierarchy
     Object* createVirtualSignal(TypedObject signalTO);
@@ -18,9 +18,11 @@
 #include <sc_tool/elab/ScVerilogModule.h>
 #include <sc_tool/utils/ScTypeTraits.h>
 #include <sc_tool/utils/DebugOptions.h>
+#include <sc_tool/utils/CfgFabric.h>
 #include <sc_tool/ScCommandLine.h>
 #include <clang/AST/Type.h>
 #include <clang/AST/Expr.h>
+#include <llvm/ADT/ArrayRef.h>
 #include <llvm/Support/Debug.h>
 #include <llvm/Support/raw_ostream.h>
 #include <sc_elab.pb.h>
@@ -129,6 +131,26 @@ private:
     // Ports bound to dynamic allocated signal leaked, used for target/initiator 
     std::unordered_set<PortView> bindedDynamicPorts;
 
+    /// Module hierarchy path from top module to the module inclusive and
+    /// Verilog module for each path element, used in port binding to avoid
+    /// walking up parent objects and Verilog module lookup for each port
+    struct ModulePath {
+        std::vector<ModuleMIFView> mods;
+        std::vector<VerilogModule*> verMods;
+    };
+    /// Part of module path from some root module down to object parent module
+    struct ModulePathRef {
+        llvm::ArrayRef<ModuleMIFView> mods;
+        llvm::ArrayRef<VerilogModule*> verMods;
+
+        size_t size() const { return mods.size(); }
+    };
+    /// Module paths cache, filled on demand, valid until Verilog modules
+    /// uniquified
+    std::unordered_map<ModuleMIFView, ModulePath> modPaths;
+    /// Nearest common parent module cache for pair of module IDs
+    std::unordered_map<uint64_t, ModuleMIFView> commonParentMods;
+
 private:
 
     void traverseModule(ModuleMIFView modView);
@@ -146,7 +168,20 @@ private:
 
     void createPortBindingsKeepArrays(VerilogModule &verMod);
 
-    BindDirection getBindDirection(PortView portView) const;
+    BindDirection getBindDirection(PortView portView);
+
+    /// Get cached path from top module to @modView
+    const ModulePath& getModulePath(const ModuleMIFView& modView);
+
+    /// Get parent modules of @obj starting from @rootMod, the same as
+    /// ObjectView::getParentModulesList() but no copy done
+    ModulePathRef getParentModulesList(const ObjectView& obj,
+                                       const ModuleMIFView& rootMod);
+
+    /// Get nearest common parent module for two objects, the same as
+    /// ObjectView::nearestCommonParentModule() with result cached
+    ModuleMIFView nearestCommonParentModule(const ObjectView& obj,
+                                            const ObjectView& other);
 
 //    void bindPortSame(VerilogModule &verMod,
 //                      PortView port,
@@ -229,6 +264,9 @@ void ScElabModuleBuilder::run()
     {
         createPortBindingsKeepArrays(verMod);
     }
+    // Module paths refer to Verilog modules which are changed in uniquify
+    modPaths.clear();
+    commonParentMods.clear();
 
     // Fill state, run method and thread process analysis in ScProcAnalyzer
     for (auto &verMod : elabDB->getVerilogModules()) {
@@ -269,6 +307,10 @@ void ScElabModuleBuilder::run()
     designStat.print(std::cout);
     std::cout << "------------------------------------------------" << std::endl; 
     
+    if (DebugOptions::isEnabled(DebugComponent::doConstProfile)) {
+        CfgFabric::getFabric(*elabDB->getASTContext())->printStat(std::cout);
+    }
+    
     DEBUG_WITH_TYPE(DebugOptions::doModuleBuilder,
                     for (auto &verMod : elabDB->getVerilogModules()) {
                         if (!verMod.isIntrinsic())
@@ -1132,9 +1174,9 @@ void ScElabModuleBuilder::bindPortUpAux(PortView portEl,
         llvm::outs() << "  bindPortUpAux BIND " << portEl << " to " << bindedObj.obj << "\n";
     );
     
-    auto parentModsList = portEl.getParentModulesList(topParentMod);
+    auto parentModsList = getParentModulesList(portEl, topParentMod);
     SCT_TOOL_ASSERT (parentModsList.size() > 1, "");
-    SCT_TOOL_ASSERT (parentModsList.back() == portHostMod, "");
+    SCT_TOOL_ASSERT (parentModsList.mods.back() == portHostMod, "");
 
     VerilogVarsVec hostVars;
     VerilogVarsVec instanceVars = verPortVars;
@@ -1144,10 +1186,9 @@ void ScElabModuleBuilder::bindPortUpAux(PortView portEl,
     for (size_t i = parentModsList.size() - 1; i > 0; --i) {
         bool last = i == 1;
 
-        ModuleMIFView instanceModObj = parentModsList.at(i);
+        ModuleMIFView instanceModObj = parentModsList.mods[i];
 
-        VerilogModule* hostVerMod = elabDB->getVerilogModule(
-                                                parentModsList.at(i - 1));
+        VerilogModule* hostVerMod = parentModsList.verMods[i - 1];
         VerilogModuleInstance *instance = hostVerMod->getInstance(
                                                 instanceModObj);
         
@@ -1189,8 +1230,8 @@ void ScElabModuleBuilder::bindPortDownAux(PortView portEl,
                                           bool isUniformArrayBind)
 {
     auto bindedObj = portEl.getDirectBind().getAsArrayElementWithIndicies(portEl);
-    auto bindedParentMods = bindedObj.obj.getParentModulesList(
-                                            portEl.getParentModule());
+    auto bindedParentMods = getParentModulesList(bindedObj.obj,
+                                                 portEl.getParentModule());
 
     DEBUG_WITH_TYPE(DebugOptions::doPortBind,
         llvm::outs() << "  bindPortDownAux BIND " << portEl << " to " << bindedObj.obj << "\n";
@@ -1208,9 +1249,9 @@ void ScElabModuleBuilder::bindPortDownAux(PortView portEl,
     for (size_t i = 1; i < bindedParentMods.size(); i++) {
         bool last = i == (bindedParentMods.size() - 1);
 
-        ModuleMIFView instModView = bindedParentMods[i];
-        VerilogModule *instVerMod = elabDB->getVerilogModule(instModView);
-        VerilogModule *hostVerMod = elabDB->getVerilogModule(bindedParentMods[i-1]);
+        ModuleMIFView instModView = bindedParentMods.mods[i];
+        VerilogModule *instVerMod = bindedParentMods.verMods[i];
+        VerilogModule *hostVerMod = bindedParentMods.verMods[i-1];
         VerilogModuleInstance *instance = hostVerMod->getInstance(instModView);
         //llvm::outs() << "   Module " << instVerMod->getName() << "\n";
         
@@ -1333,7 +1374,8 @@ void ScElabModuleBuilder::bindPortCrossAux(PortView portEl,
 {
     // First bind up to common Parent, then bind down to bindedObj
     auto bindedObj = portEl.getDirectBind().getAsArrayElementWithIndicies(portEl);
-    ModuleMIFView commonParentMod = portEl.nearestCommonParentModule(bindedObj.obj);
+    ModuleMIFView commonParentMod = nearestCommonParentModule(portEl, 
+                                                              bindedObj.obj);
 
     DEBUG_WITH_TYPE(DebugOptions::doPortBind,
         llvm::outs() << "  bindPortCrossAux BIND " << portEl << " to " << bindedObj.obj << "\n";
@@ -1357,18 +1399,18 @@ void ScElabModuleBuilder::bindPortCrossAux(PortView portEl,
         
     {
         // 1. Bind  UP
-        auto bindUpParentMods = portEl.getParentModulesList(commonParentMod);
+        auto bindUpParentMods = getParentModulesList(portEl, commonParentMod);
         SCT_TOOL_ASSERT (bindUpParentMods.size() > 1, "");
-        SCT_TOOL_ASSERT (bindUpParentMods[0] == commonParentMod, "");
+        SCT_TOOL_ASSERT (bindUpParentMods.mods[0] == commonParentMod, "");
 
         for (size_t i = bindUpParentMods.size() - 1; i > 0; --i) {
             bool last = i == 1;
 
             hostVars.clear();
 
-            ModuleMIFView instanceModObj = bindUpParentMods.at(i);
+            ModuleMIFView instanceModObj = bindUpParentMods.mods[i];
             
-            auto hostVerMod = elabDB->getVerilogModule(bindUpParentMods.at(i-1));
+            auto hostVerMod = bindUpParentMods.verMods[i-1];
             auto instance = hostVerMod->getInstance(instanceModObj);
 
             // We need to create auxiliary ports in all host modules,
@@ -1453,8 +1495,8 @@ void ScElabModuleBuilder::bindPortCrossAux(PortView portEl,
 
     // Bind DOWN
     if (bindSigVar) {
-        auto bindDownParentMods = bindedObj.obj.
-                                  getParentModulesList(commonParentMod);
+        auto bindDownParentMods = getParentModulesList(bindedObj.obj,
+                                                       commonParentMod);
 
         PortDirection bottomDirection;
         if (portEl.getDirection() == PortDirection::IN)
@@ -1465,10 +1507,9 @@ void ScElabModuleBuilder::bindPortCrossAux(PortView portEl,
         for (size_t i = 1; i < bindDownParentMods.size(); i++) {
             bool last = i == (bindDownParentMods.size() - 1);
 
-            ModuleMIFView instModView = bindDownParentMods.at(i);
-            VerilogModule *instVerMod = elabDB->getVerilogModule(instModView);
-            VerilogModule *hostVerMod = elabDB->getVerilogModule(
-                                        bindDownParentMods.at(i - 1));
+            ModuleMIFView instModView = bindDownParentMods.mods[i];
+            VerilogModule *instVerMod = bindDownParentMods.verMods[i];
+            VerilogModule *hostVerMod = bindDownParentMods.verMods[i - 1];
             VerilogModuleInstance *instance = hostVerMod->getInstance(instModView);
             //cout << "bindPortCrossAux DOWN hostVerMod " << hostVerMod->getName() 
             //     << " instVerMod " << instVerMod->getName() << endl;
@@ -1569,13 +1610,13 @@ void ScElabModuleBuilder::bindPortExternalAux(PortView portEl,
     if (!(topModView == portEl.getParentModule())) {
         // promote inner module port to top-level
 
-        auto parentModsList = portEl.getParentModulesList(topModView);
+        auto parentModsList = getParentModulesList(portEl, topModView);
 
         for (size_t i = parentModsList.size() - 1; i > 0; --i) {
 
-            ModuleMIFView instanceModObj = parentModsList.at(i);
+            ModuleMIFView instanceModObj = parentModsList.mods[i];
 
-            VerilogModule *hostVerMod = elabDB->getVerilogModule(parentModsList.at(i - 1));
+            VerilogModule *hostVerMod = parentModsList.verMods[i - 1];
             VerilogModuleInstance *instance = hostVerMod->getInstance(instanceModObj);
 
             // create auxiliary port in host module
@@ -1658,8 +1699,63 @@ bool ScElabModuleBuilder::isFlattenArrayBind (
     return flattenArrayBind;
 }
 
-ScElabModuleBuilder::BindDirection 
-ScElabModuleBuilder::getBindDirection (PortView port) const
+const ScElabModuleBuilder::ModulePath&
+ScElabModuleBuilder::getModulePath(const ModuleMIFView& modView)
+{
+    auto i = modPaths.find(modView);
+    if (i != modPaths.end()) return i->second;
+
+    ModulePath path;
+    if (!modView.isTopMod()) {
+        // Copy parent module path and add this module to it
+        path = getModulePath(modView.getParentModule());
+    }
+    path.mods.push_back(modView);
+    path.verMods.push_back(elabDB->getVerilogModule(modView));
+
+    return modPaths.emplace(modView, std::move(path)).first->second;
+}
+
+ScElabModuleBuilder::ModulePathRef
+ScElabModuleBuilder::getParentModulesList(const ObjectView& obj,
+                                          const ModuleMIFView& rootMod)
+{
+    const auto& path = getModulePath(obj.getParentModule());
+    size_t rootIndx = getModulePath(rootMod).mods.size()-1;
+    SCT_TOOL_ASSERT (rootIndx < path.mods.size() &&
+                     path.mods[rootIndx] == rootMod,
+                     "Root module is not parent of the object");
+
+    ModulePathRef res;
+    res.mods = llvm::makeArrayRef(path.mods).drop_front(rootIndx);
+    res.verMods = llvm::makeArrayRef(path.verMods).drop_front(rootIndx);
+    return res;
+}
+
+ModuleMIFView ScElabModuleBuilder::nearestCommonParentModule(
+                                    const ObjectView& obj,
+                                    const ObjectView& other)
+{
+    auto objMod = obj.getParentModule();
+    auto otherMod = other.getParentModule();
+    uint64_t key = (uint64_t(objMod.getID()) << 32) | otherMod.getID();
+
+    auto i = commonParentMods.find(key);
+    if (i != commonParentMods.end()) return i->second;
+
+    const auto& objPath = getModulePath(objMod).mods;
+    const auto& otherPath = getModulePath(otherMod).mods;
+    const size_t minSize = std::min(objPath.size(), otherPath.size());
+
+    size_t indx = 0;
+    while (indx+1 < minSize && objPath[indx+1] == otherPath[indx+1]) indx++;
+
+    commonParentMods.emplace(key, objPath[indx]);
+    return objPath[indx];
+}
+
+ScElabModuleBuilder::BindDirection
+ScElabModuleBuilder::getBindDirection (PortView port)
 {
     auto bindedObj = port.getDirectBind();
 
@@ -1679,7 +1775,7 @@ ScElabModuleBuilder::getBindDirection (PortView port) const
     auto thisParentMod = port.getParentModule();
     auto bindedParentMod = bindedObj.getParentModule();
     // Find common parent
-    auto commonParentMod = port.nearestCommonParentModule(bindedObj);
+    auto commonParentMod = nearestCommonParentModule(port, bindedObj);
     
     if (bindedParentMod == thisParentMod)
         return BindDirection::BIND_SAME;
@@ -108,8 +108,10 @@ class RecordValues {
 public:
     RecordValues() = delete;
 
+    /// Set database of the design, clear values of previous design 
     static void setElabDB(ElabDatabase* elabDB_) {
         elabDB = elabDB_;
+        recordMap.clear();
     }
     /// Add modules/MIFs with NO_VALUE
     static void addRecordView(const RecordView& recView);
@@ -422,6 +422,13 @@ void VerilogModule::serializeToStream(llvm::raw_ostream &os) const
         }
         if (!first) os << "\n";
     }
+    
+    if (!svFunctions.empty()) {
+        os << "// Functions generated for pure C++ functions\n";
+        for (const auto& func : svFunctions) {
+            os << func << "\n";
+        }
+    }
 
     if (!assignments.empty()) {
         // Filtering assignment to remove intermediate signals
@@ -1221,6 +1228,23 @@ void VerilogModule::addProcessBody(ProcessView proc, VerilogProcCode code)
     procBodies[proc] = std::move(code);
 }
 
+llvm::Optional<std::string> VerilogModule::getSvFunctionName(
+                                const clang::FunctionDecl* funcDecl) const
+{
+    auto i = svFuncNames.find(funcDecl);
+    if (i != svFuncNames.end()) {
+        return i->second;
+    }
+    return llvm::None;
+}
+
+void VerilogModule::addSvFunction(const clang::FunctionDecl* funcDecl, 
+                                  const std::string& name, std::string code)
+{
+    svFuncNames.emplace(funcDecl, name);
+    svFunctions.push_back(std::move(code));
+}
+
 static void serializeVerilogBool(llvm::raw_ostream &os, llvm::APSInt val)
 {
     os << (val.isNullValue() ? '0' : '1');
@@ -589,6 +589,15 @@ public:
         svaPropCode = code; 
     }
     
+    /// Get name of SV function generated for pure C++ function
+    llvm::Optional<std::string> getSvFunctionName(
+                                const clang::FunctionDecl* funcDecl) const;
+    
+    /// Add SV function generated for pure C++ function, 
+    /// the function declared before module processes
+    void addSvFunction(const clang::FunctionDecl* funcDecl, 
+                       const std::string& name, std::string code);
+    
     UniqueNamesGenerator& getNameGen() { return nameGen; }
 
     bool isIntrinsic() const
@@ -778,6 +787,10 @@ public:
     /// Field declarations for SVA properties
     std::vector<const clang::FieldDecl*> svaProperties;
     std::string svaPropCode;
+    
+    /// SV function names and code generated for pure C++ functions
+    std::unordered_map<const clang::FunctionDecl*, std::string> svFuncNames;
+    std::vector<std::string> svFunctions;
 
 };
 
@@ -3041,6 +3041,32 @@ void ScVerilogWriter::putEmptyFCallParam(const clang::Stmt* stmt)
     addString(stmt, "");
 }
 
+// Put call of SV function generated for pure C++ function
+void ScVerilogWriter::putFuncCall(const Stmt* stmt, const string& funcName,
+                                  const vector<const Expr*>& args)
+{
+    if (skipTerm) return;
+    
+    string s = funcName + "(";
+    bool first = true;
+    for (auto arg : args) {
+        if (!terms.count(arg)) {
+            cout << "putFuncCall : arg " << hex << (size_t)arg << dec << endl;
+            SCT_INTERNAL_FATAL(stmt->getBeginLoc(),
+                               "putFuncCall : No term for argument ");
+        }
+        s += (first ? "" : ", ") + getTermAsRValue(arg).first;
+        first = false;
+    }
+    s += ")";
+    
+    putString(stmt, s, getExprTypeWidth(cast<Expr>(stmt)));
+    
+    if (DebugOptions::isEnabled(DebugComponent::doVerWriter)) {
+        cout << "putFuncCall for stmt " << hex << stmt << dec << ", " << s << endl;
+    }
+}
+
 // Put wait(int n) counter assignment
 void ScVerilogWriter::putWaitNAssign(const clang::Stmt* stmt, 
                                      const clang::Expr* waitn) 
@@ -3257,6 +3283,29 @@ string ScVerilogWriter::getContinueString() {
     return ("continue");
 }
 
+// Get SV function declaration for pure C++ function
+string ScVerilogWriter::getFuncDeclVerilog(const string& funcName,
+                                           const FunctionDecl* funcDecl,
+                                           const SValue& modval,
+                                           const Expr* retExpr)
+{
+    string s = "function automatic " + 
+               getVarDeclVerilog(funcDecl->getReturnType(), funcName) + " (\n";
+    
+    bool first = true;
+    for (auto parDecl : funcDecl->parameters()) {
+        // Parameter names are the same as used in parsed return expression
+        string parName = getVarName(SValue(parDecl, modval)).first;
+        s += string(first ? "" : ",\n") + TAB_SYM + "input " + 
+             getVarDeclVerilog(parDecl->getType(), parName);
+        first = false;
+    }
+    
+    s += "\n);\n" + TAB_SYM + "return " + getTermAsRValue(retExpr).first + 
+         ";\nendfunction\n";
+    return s;
+}
+
 //=========================================================================
 
 // Print local variable declaration and current to next register variable assignment
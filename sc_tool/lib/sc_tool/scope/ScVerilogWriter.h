@@ -588,6 +588,11 @@ public:
     /// in right part of && / || expression
     void putEmptyFCallParam(const clang::Stmt* stmt);
     
+    /// Put call of SV function generated for pure C++ function
+    /// \param stmt is function call expression 
+    void putFuncCall(const clang::Stmt* stmt, const std::string& funcName,
+                     const std::vector<const clang::Expr*>& args);
+    
     /// Put wait(int n) counter assignment
     void putWaitNAssign(const clang::Stmt* stmt, const clang::Expr* waitn);
     
@@ -651,6 +656,13 @@ public:
     /// Store continue statement
     std::string getContinueString();
     
+    /// Get SV function declaration for pure C++ function, 
+    /// function return expression should be already parsed with this writer
+    std::string getFuncDeclVerilog(const std::string& funcName,
+                                   const clang::FunctionDecl* funcDecl,
+                                   const SValue& modval,
+                                   const clang::Expr* retExpr);
+    
     std::string getTabSymbol() {
         return TAB_SYM;
     }
@@ -10,40 +10,134 @@
  */
 
 #include "sc_tool/utils/CfgFabric.h"
+#include "sc_tool/cfg/ScStmtInfo.h"
+#include "sc_tool/cfg/ScTraverseCommon.h"
 #include "CfgFabric.h"
+#include <chrono>
 
 using namespace sc;
 using namespace clang;
 
 // Get fabric singleton
 CfgFabric* CfgFabric::getFabric(const clang::ASTContext&  context_) {
-    if (fabric == nullptr) {
+    if (CfgFabric* res = fabricPtr.load(std::memory_order_acquire)) {
+        return res;
+    }
+    std::lock_guard<std::mutex> lock(fabricMutex);
+    if (!fabric) {
         fabric = std::unique_ptr<CfgFabric>(new CfgFabric(context_));
+        fabricPtr.store(fabric.get(), std::memory_order_release);
     }
     return fabric.get();
 }
 
+// Destroy fabric singleton
+void CfgFabric::reset() {
+    std::lock_guard<std::mutex> lock(fabricMutex);
+    fabricPtr.store(nullptr, std::memory_order_release);
+    fabric = nullptr;
+}
+
 // Get CFG for function declaration, build and store CFG if it not exist
 clang::CFG* CfgFabric::get(const clang::FunctionDecl* funcDecl)
 {
     return getFabric(funcDecl->getASTContext())->get_impl(funcDecl);
 }
 
+// Get counter information for FOR loop
+ForLoopInfo CfgFabric::getForLoopInfo(const clang::ForStmt* stmt)
+{
+    if (CfgFabric* res = fabricPtr.load(std::memory_order_acquire)) {
+        return res->getForLoopInfo_impl(stmt);
+    }
+    return ForLoopVisitor().getLoopInfo(const_cast<ForStmt*>(stmt));
+}
+
 std::unique_ptr<CfgFabric> CfgFabric::fabric = nullptr;
+std::atomic<CfgFabric*> CfgFabric::fabricPtr{nullptr};
+std::mutex CfgFabric::fabricMutex;
+
+CfgFabric::~CfgFabric() = default;
+
 clang::CFG *CfgFabric::get_impl(const clang::FunctionDecl *funcDecl)
 {
-    auto i = entries.find(funcDecl);
-
-    if (i != entries.end()) {
-        return i->second.get();
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        auto i = entries.find(funcDecl);
+        if (i != entries.end() && i->second.cfg) {
+            return i->second.cfg.get();
+        }
+    }
+    
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    auto& entry = entries[funcDecl];
+    
+    // Could be built by another thread while lock released
+    if (!entry.cfg) {
+        auto start = std::chrono::steady_clock::now();
+        entry.cfg.reset( CFG::buildCFG(funcDecl, funcDecl->getBody(),
+                                       const_cast<ASTContext*>(&context),
+                                       CFG::BuildOptions()) );
+        std::chrono::duration<double> diff = 
+                                    std::chrono::steady_clock::now() - start;
+        cfgBuildTime += diff.count();
+        cfgBuildNum++;
+    }
+    return entry.cfg.get();
+}
 
-    } else {
-        std::unique_ptr<CFG> cfg( CFG::buildCFG(funcDecl, funcDecl->getBody(),
-                                                const_cast<ASTContext*>(&context),
-                                                CFG::BuildOptions()) );
+const FuncStmtInfo* CfgFabric::getStmtInfo(const clang::FunctionDecl* funcDecl)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        auto i = entries.find(funcDecl);
+        if (i != entries.end() && i->second.stmtInfo) {
+            return i->second.stmtInfo.get();
+        }
+    }
+    
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    auto& entry = entries[funcDecl];
+    
+    if (!entry.stmtInfo) {
+        auto start = std::chrono::steady_clock::now();
+        entry.stmtInfo.reset(new FuncStmtInfo(funcDecl));
+        
+        // Register loops of this function to share them with code generation
+        for (const auto& i : entry.stmtInfo->getForLoops()) {
+            forLoops.emplace(i.first, i.second);
+        }
+        std::chrono::duration<double> diff = 
+                                    std::chrono::steady_clock::now() - start;
+        stmtInfoBuildTime += diff.count();
+        stmtInfoBuildNum++;
+    }
+    return entry.stmtInfo.get();
+}
 
-        auto result = cfg.get();
-        entries.emplace(funcDecl, std::move(cfg));
-        return result;
+ForLoopInfo CfgFabric::getForLoopInfo_impl(const clang::ForStmt* stmt)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        auto i = forLoops.find(stmt);
+        if (i != forLoops.end()) {
+            return i->second;
+        }
     }
+    
+    // Loop in function without statement information built
+    ForLoopInfo info = ForLoopVisitor().getLoopInfo(
+                                        const_cast<ForStmt*>(stmt));
+    
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    forLoops.emplace(stmt, info);
+    return info;
+}
+
+void CfgFabric::printStat(std::ostream& os) const
+{
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    os << "CFG built " << cfgBuildNum << ", time " << cfgBuildTime << std::endl;
+    os << "Statement info built " << stmtInfoBuildNum << ", time " 
+       << stmtInfoBuildTime << std::endl;
 }
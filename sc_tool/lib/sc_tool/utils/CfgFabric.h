@@ -14,11 +14,30 @@
 
 #include "clang/Analysis/CFG.h"
 #include "clang/AST/Decl.h"
+#include "clang/AST/Stmt.h"
 #include <unordered_map>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <iostream>
 
 namespace sc {
-    
+
+class FuncStmtInfo;
+
+/// FOR loop counter information
+struct ForLoopInfo 
+{
+    /// Counter variable declared in loop initialization or nullptr
+    clang::VarDecl* cntrDecl = nullptr;
+    /// Loop uses internally declared counter or has no increment
+    bool internalCntr = false;
+};
+
+/// Storage of CFG, statement information and loop information for functions,
+/// built once and shared between all process analyses. 
+/// Safe for concurrent readers, build of an entry is done under exclusive lock
 class CfgFabric final
 {
 public:
@@ -27,20 +46,57 @@ public:
     
     /// Get CFG for function declaration, build and store CFG if it not exist
     static clang::CFG* get(const clang::FunctionDecl* funcDecl);
+    
+    /// Get statement levels, sub-statements and declaration groups for 
+    /// function declaration, build and store them if not exist
+    const FuncStmtInfo* getStmtInfo(const clang::FunctionDecl* funcDecl);
+    
+    /// Get counter information for FOR loop, computed directly if there 
+    /// is no fabric created yet
+    static ForLoopInfo getForLoopInfo(const clang::ForStmt* stmt);
+    
+    /// Print number of entries built and time spent
+    void printStat(std::ostream& os) const;
+    
+    /// Destroy fabric singleton, called when AST is not used anymore and 
+    /// no analysis is running, next getFabric() creates new fabric
+    static void reset();
+
+    ~CfgFabric();
 
 private:
     clang::CFG* get_impl(const clang::FunctionDecl* funcDecl);
+    ForLoopInfo getForLoopInfo_impl(const clang::ForStmt* stmt);
 
     CfgFabric(const clang::ASTContext&  context_) : context(context_)
     {}
     
     static std::unique_ptr<CfgFabric> fabric;
+    /// Fabric pointer checked without lock, @fabric created under lock
+    static std::atomic<CfgFabric*> fabricPtr;
+    static std::mutex fabricMutex;
+
+    /// Function information
+    struct FuncEntry {
+        std::unique_ptr<clang::CFG>     cfg;
+        std::unique_ptr<FuncStmtInfo>   stmtInfo;
+    };
 
     /// AST context
     const clang::ASTContext&  context;
-    /// CFG of all called functions
-    std::unordered_map<const clang::FunctionDecl*, 
-                       std::unique_ptr<clang::CFG> >    entries;
+    /// Protects @entries, @forLoops and statistic
+    mutable std::shared_mutex mtx;
+    /// CFG and statement information of all called functions
+    std::unordered_map<const clang::FunctionDecl*, FuncEntry>   entries;
+    /// Loop information for all FOR loops in analyzed functions
+    std::unordered_map<const clang::ForStmt*, ForLoopInfo>      forLoops;
+    
+    /// Number of CFG and statement information built
+    size_t cfgBuildNum = 0;
+    size_t stmtInfoBuildNum = 0;
+    /// Time spent in build, seconds
+    double cfgBuildTime = 0;
+    double stmtInfoBuildTime = 0;
 };
 
 }
@@ -15,17 +15,21 @@ std::string UniqueNamesGenerator::getUniqueName(const std::string &suggestedName
         genName += "_v";
     }
 
-    int postfix = 0;
-
     // Avoid register name conflict with local name
-    while (takenNames.count(genName) || 
-           (checkLocalNames && localNames.count(genName))) 
-    {
-        genName = suggestedName + /*"_" +*/ std::to_string(postfix);
-        ++postfix;
-    }
-
-    if (isKeyword || postfix) {
+    if (isTaken(genName, checkLocalNames)) {
+        // Continue from the last postfix tried for this name, taken and 
+        // local names are never removed, so skipped names are still taken
+        unsigned& postfix = checkLocalNames ? nextLocalPostfix[suggestedName] :
+                                              nextPostfix[suggestedName];
+        do {
+            genName = suggestedName + /*"_" +*/ std::to_string(postfix);
+            ++postfix;
+        } while (isTaken(genName, checkLocalNames));
+        
+        changedNames.insert(suggestedName);
+        
+    } else 
+    if (isKeyword) {
         changedNames.insert(suggestedName);
     }
     
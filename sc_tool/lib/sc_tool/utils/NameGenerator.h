@@ -14,6 +14,7 @@
 
 #include <string>
 #include <unordered_set>
+#include <unordered_map>
 
 /// Generates unique names inside module body
 class UniqueNamesGenerator {
@@ -21,6 +22,8 @@ public:
     void reset() { 
         takenNames.clear(); 
         changedNames.clear(); 
+        nextPostfix.clear();
+        nextLocalPostfix.clear();
     }
     std::string getUniqueName (const std::string & suggestedName,
                                bool checkLocalNames = false);
@@ -60,6 +63,10 @@ private:
     std::unordered_set<std::string> changedNames;
     // Local names in processes 
     std::unordered_set<std::string> localNames;
+    // Next postfix to try for suggested name, all names with smaller postfix 
+    // are taken, separate for names checked with local names
+    std::unordered_map<std::string, unsigned> nextPostfix;
+    std::unordered_map<std::string, unsigned> nextLocalPostfix;
 };
 
 #endif /* NAMEGENERATOR_H */
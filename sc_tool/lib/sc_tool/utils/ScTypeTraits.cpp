@@ -265,6 +265,11 @@ void initTypeTraits(const clang::ASTContext& astCtx)
     DeclDB::initDB(astCtx);
 }
 
+void resetTypeTraits()
+{
+    db = nullptr;
+}
+
 bool isStdFuncDecl(const clang::FunctionDecl* funcDecl)
 {
     auto contexts = getDeclContexts(funcDecl);
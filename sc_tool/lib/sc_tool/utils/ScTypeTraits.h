@@ -34,6 +34,10 @@ struct IntTraits {
 /// type traits query
 void initTypeTraits(const clang::ASTContext& astCtx);
 
+/// Clear database of built-in types, should be called before next AST 
+/// processing in the same process
+void resetTypeTraits();
+
 /// Returns true if funcDecl is inside std, sc_core or sc_dt namespaces
 bool isStdFuncDecl(const clang::FunctionDecl *funcDecl);
 
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright (c) 2020, Intel Corporation. All rights reserved.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception.
+ * 
+ *****************************************************************************/
+
+/**
+ * SVC batch driver, runs elaboration and SV generation for several designs
+ * built as shared libraries (svc_target with BATCH option) in one process.
+ *
+ * Usage: sctool_batch [-sctool <option>]... <design library>...
+ */
+
+#include <sc_tool/SCTool.h>
+#include <sc_elab/sc_tool_opts.h>
+#include <sysc/kernel/sc_externs.h>
+#include <iostream>
+
+// SystemC library refers to sc_main, sc_main of each design is taken from 
+// its library, so this one should never be called
+int sc_main(int argc, char* argv[])
+{
+    std::cerr << "sctool_batch: sc_main is called outside of design library\n";
+    return 1;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> designLibs;
+    
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        
+        // Arguments prefixed with -sctool go to SVC as in design sctool 
+        // executable, used for debug output options
+        if (arg == "-sctool") {
+            if (i == argc - 1) {
+                std::cerr << "-sctool specified without passing an option\n";
+                std::cerr << "Usage: -sctool -some_option\n";
+                return 1;
+            }
+            if (sctool_extra_opts == nullptr)
+                sctool_extra_opts = new std::string();
+            
+            *sctool_extra_opts = *sctool_extra_opts + " " + argv[++i];
+            
+        } else {
+            designLibs.push_back(arg);
+        }
+    }
+    
+    if (designLibs.empty()) {
+        std::cerr << "Usage: sctool_batch [-sctool <option>]... "
+                     "<design library>...\n";
+        return 1;
+    }
+    
+    return sc::runScBatch(designLibs);
+}
@@ -0,0 +1,88 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- This example traces signals of different types into VCD and
+              binary trace files. The test converts the binary trace file
+              with sc_bin2vcd and compares the result with golden VCD.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+SC_MODULE(counter)
+{
+    sc_in<bool>           clk;
+    sc_signal<bool>       flag;
+    sc_signal<sc_uint<8> > cnt;
+    sc_signal<int>        value;
+    sc_signal<sc_bv<12> > vec;
+    sc_signal<sc_logic>   lg;
+    sc_signal<double>     real;
+    sc_event              ev;
+
+    SC_CTOR(counter)
+    {
+        SC_METHOD(proc);
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    void proc()
+    {
+        cnt = cnt.read() + 1;
+        flag = cnt.read()[0];
+        value = value.read() * 3 - 7;
+        vec = vec.read() ^ (cnt.read() << 2);
+        lg = (cnt.read() % 3 == 0) ? SC_LOGIC_Z : SC_LOGIC_1;
+        real = real.read() + 0.5;
+        if (cnt.read() % 4 == 0) ev.notify(SC_ZERO_TIME);
+    }
+};
+
+int sc_main(int, char*[])
+{
+    sc_clock clk("clk", 10, SC_NS);
+    counter c("c");
+    c.clk(clk);
+
+    sc_trace_file* vcd = sc_create_vcd_trace_file("trace");
+    sc_trace_file* bin = sc_create_bin_trace_file("trace");
+    sc_trace_file* files[] = { vcd, bin };
+
+    for (sc_trace_file* tf : files) {
+        sc_trace(tf, clk, "clk");
+        sc_trace(tf, c.flag, "flag");
+        sc_trace(tf, c.cnt, "cnt");
+        sc_trace(tf, c.value, "value");
+        sc_trace(tf, c.vec, "vec");
+        sc_trace(tf, c.lg, "lg");
+        sc_trace(tf, c.real, "real");
+        sc_trace(tf, c.ev, "ev");
+    }
+
+    sc_start(300, SC_NS);
+
+    sc_close_vcd_trace_file(vcd);
+    sc_close_bin_trace_file(bin);
+
+    cout << "Binary trace written at " << sc_time_stamp() << endl;
+    return 0;
+}
@@ -0,0 +1,79 @@
+###############################################################################
+#
+# Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+# more contributor license agreements.  See the NOTICE file distributed
+# with this work for additional information regarding copyright ownership.
+# Accellera licenses this file to you under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with the
+# License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied.  See the License for the specific language governing
+# permissions and limitations under the License.
+#
+###############################################################################
+
+###############################################################################
+#
+# examples/sysc/2.3/sc_bin_trace/run_bin_trace_test.cmake --
+# Run the example, convert its binary trace file with sc_bin2vcd and compare
+# value changes with the VCD trace file written in the same run.
+#
+# Usage: cmake -DTEST_EXE=<executable> -DBIN2VCD=<sc_bin2vcd>
+#              -DTEST_DIR=<directory> -P run_bin_trace_test.cmake
+#
+###############################################################################
+
+cmake_minimum_required (VERSION 2.8.11)
+
+execute_process (COMMAND ${TEST_EXE}
+                 WORKING_DIRECTORY ${TEST_DIR}
+                 RESULT_VARIABLE TEST_EXIT_CODE
+                 OUTPUT_FILE run.log
+                 ERROR_VARIABLE TEST_ERROR)
+if (NOT TEST_EXIT_CODE EQUAL 0)
+  message (FATAL_ERROR "***ERROR:\n${TEST_ERROR}")
+endif ()
+
+execute_process (COMMAND ${BIN2VCD} trace.scbt trace_bin.vcd
+                 WORKING_DIRECTORY ${TEST_DIR}
+                 RESULT_VARIABLE TEST_EXIT_CODE
+                 ERROR_VARIABLE TEST_ERROR)
+if (NOT TEST_EXIT_CODE EQUAL 0)
+  message (FATAL_ERROR "***ERROR: sc_bin2vcd failed:\n${TEST_ERROR}")
+endif ()
+
+# Value changes as "<time> <variable name> <value>" list, identifiers of
+# variables differ in VCD and converted files
+function (read_changes VCD_FILE CHANGES)
+  file (STRINGS ${VCD_FILE} lines)
+  set (time 0)
+  set (result)
+  foreach (line IN LISTS lines)
+    if (line MATCHES "^\\$var +[a-z]+ +[0-9]+ +([^ ]+) +([^ ]+)")
+      set (name_${CMAKE_MATCH_1} ${CMAKE_MATCH_2})
+    elseif (line MATCHES "^#([0-9]+)$")
+      set (time ${CMAKE_MATCH_1})
+    elseif (line MATCHES "^([br][^ ]*) (.+)$" OR
+            line MATCHES "^([01xzXZ])([^ ]+)$")
+      list (APPEND result "${time} ${name_${CMAKE_MATCH_2}} ${CMAKE_MATCH_1}")
+    endif ()
+  endforeach ()
+  set (${CHANGES} "${result}" PARENT_SCOPE)
+endfunction ()
+
+read_changes (${TEST_DIR}/trace.vcd VCD_CHANGES)
+read_changes (${TEST_DIR}/trace_bin.vcd BIN_CHANGES)
+
+list (LENGTH VCD_CHANGES VCD_COUNT)
+if (VCD_COUNT EQUAL 0)
+  message (FATAL_ERROR "***ERROR: no value changes in trace.vcd")
+endif ()
+if (NOT "${VCD_CHANGES}" STREQUAL "${BIN_CHANGES}")
+  message (FATAL_ERROR "***ERROR: converted trace_bin.vcd differs from trace.vcd")
+endif ()
+message ("OK, ${VCD_COUNT} value changes")
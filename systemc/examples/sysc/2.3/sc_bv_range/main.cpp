@@ -0,0 +1,214 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Randomized test of sc_bv/sc_lv reductions and part selections.
+              Vectors of random length and value, with X and Z bits for
+              sc_lv, are checked against bit by bit reference: reductions
+              of the vector and of its ranges, range read, range integer
+              value and range write, with normal and reversed ranges. Number of checks and errors
+              are printed.
+
+  Usage: sc_bv_range [iterations]
+         default is 10000 iterations for each vector type
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <cstdlib>
+
+// Random generator with the same sequence on all platforms
+class random_gen
+{
+public:
+    explicit random_gen(unsigned long long seed) : s(seed) {}
+
+    unsigned next(unsigned n)
+    {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return static_cast<unsigned>(s % n);
+    }
+
+private:
+    unsigned long long s;
+};
+
+// Tests of one vector type, sc_bv_base or sc_lv_base
+template <class T>
+class range_test
+{
+public:
+    range_test(const char* name_, bool xz_) :
+        name(name_), xz(xz_), rnd(xz_ ? 12345 : 54321), checks(0), errors(0)
+    {}
+
+    void run(unsigned iterations)
+    {
+        for (unsigned i = 0; i != iterations; ++i) {
+            int len = 1 + rnd.next(rnd.next(4) == 0 ? 1000 : 130);
+            T v(len);
+            fill(v);
+            check_reduce(v, "vector", len - 1, 0);
+
+            int l = rnd.next(len);
+            int r = rnd.next(len);
+            check_read(v, l, r);
+            check_value(v, l, r);
+            check_reduce(v.range(l, r), "range", l, r);
+            check_write(v, l, r);
+        }
+        cout << name << " checks " << checks << " errors " << errors << endl;
+    }
+
+    unsigned get_errors() const { return errors; }
+
+private:
+    // Bit index in vector for bit @i of range(l, r)
+    static int bit_index(int l, int r, int i)
+    {
+        return l >= r ? r + i : r - i;
+    }
+
+    // Random bit value, X and Z only if allowed
+    sc_dt::sc_logic_value_t random_bit(unsigned mode)
+    {
+        unsigned b = rnd.next(16);
+        if (xz && b == 0) return sc_dt::Log_Z;
+        if (xz && b == 1) return sc_dt::Log_X;
+        // mostly zeros or mostly ones to have words deciding reductions
+        if (mode == 1) return b < 15 ? sc_dt::Log_0 : sc_dt::Log_1;
+        if (mode == 2) return b < 15 ? sc_dt::Log_1 : sc_dt::Log_0;
+        return b < 8 ? sc_dt::Log_0 : sc_dt::Log_1;
+    }
+
+    void fill(T& v)
+    {
+        unsigned mode = rnd.next(4);
+        for (int i = 0; i != v.length(); ++i) {
+            v[i] = sc_logic(random_bit(mode));
+        }
+    }
+
+    void error(const std::string& what)
+    {
+        if (errors < 10) {
+            cout << name << " error: " << what << endl;
+        }
+        errors++;
+    }
+
+    // Reductions of vector or range with bits from @l to @r
+    template <class V>
+    void check_reduce(const V& v, const char* what, int l, int r)
+    {
+        sc_logic ref_and(sc_dt::Log_1);
+        sc_logic ref_or(sc_dt::Log_0);
+        sc_logic ref_xor(sc_dt::Log_0);
+        for (int i = 0; i != v.length(); ++i) {
+            sc_logic b(v[i].value());
+            ref_and &= b;
+            ref_or |= b;
+            ref_xor ^= b;
+        }
+        checks += 3;
+        if (v.and_reduce() != ref_and.value() ||
+            v.or_reduce() != ref_or.value() ||
+            v.xor_reduce() != ref_xor.value())
+        {
+            error(std::string(what) + " reduction (" +
+                  std::to_string(l) + ", " + std::to_string(r) + ")");
+        }
+    }
+
+    void check_read(const T& v, int l, int r)
+    {
+        T res(v.range(l, r));
+        checks++;
+        for (int i = 0; i != res.length(); ++i) {
+            if (res[i].value() != v[bit_index(l, r, i)].value()) {
+                error("range read (" + std::to_string(l) + ", " +
+                      std::to_string(r) + ") bit " + std::to_string(i));
+                return;
+            }
+        }
+    }
+
+    // Integer value of range up to 64 bits without X and Z
+    void check_value(const T& v, int l, int r)
+    {
+        int len = (l >= r ? l - r : r - l) + 1;
+        if (len > 64) return;
+        uint64 ref = 0;
+        for (int i = 0; i != len; ++i) {
+            int b = v[bit_index(l, r, i)].value();
+            if (b != sc_dt::Log_0 && b != sc_dt::Log_1) return;
+            ref |= static_cast<uint64>(b) << i;
+        }
+        checks++;
+        if (v.range(l, r).to_uint64() != ref) {
+            error("range value (" + std::to_string(l) + ", " +
+                  std::to_string(r) + ")");
+        }
+    }
+
+    void check_write(const T& v, int l, int r)
+    {
+        int len = (l >= r ? l - r : r - l) + 1;
+        T src(len);
+        fill(src);
+        T res(v);
+        res.range(l, r) = src;
+
+        T ref(v);
+        for (int i = 0; i != len; ++i) {
+            ref[bit_index(l, r, i)] = sc_logic(src[i].value());
+        }
+        checks++;
+        for (int i = 0; i != res.length(); ++i) {
+            if (res[i].value() != ref[i].value()) {
+                error("range write (" + std::to_string(l) + ", " +
+                      std::to_string(r) + ") bit " + std::to_string(i));
+                return;
+            }
+        }
+    }
+
+private:
+    const char* name;
+    bool        xz;
+    random_gen  rnd;
+    unsigned    checks;
+    unsigned    errors;
+};
+
+int sc_main(int argc, char* argv[])
+{
+    unsigned iterations = argc > 1 ? std::atoi(argv[1]) : 10000;
+
+    range_test<sc_bv_base> bv_test("sc_bv", false);
+    bv_test.run(iterations);
+
+    range_test<sc_lv_base> lv_test("sc_lv", true);
+    lv_test.run(iterations);
+
+    return bv_test.get_errors() + lv_test.get_errors() != 0;
+}
@@ -0,0 +1,87 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- sc_bv/sc_lv part selection and reduction benchmark. Ranges of
+              64, 512 and 2048 bit vectors at different offsets are read,
+              written and reduced, time of each vector type and length is
+              printed along with result checksum.
+
+  Usage: sc_bv_range_perf [iterations]
+         default is 100000 iterations for each vector type and length
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <chrono>
+#include <cstdlib>
+
+// Range read, range write and reductions at all offsets of the vector
+template <class T>
+unsigned run(int len, unsigned iterations)
+{
+    T v(len);
+    for (int i = 0; i != len; ++i) {
+        v[i] = (i * 7 + 3) % 5 < 2;
+    }
+    const int width = len / 2;
+    T r(width);
+    unsigned checksum = 0;
+
+    for (unsigned n = 0; n != iterations; ++n) {
+        int lo = n % (len - width + 1);
+        r = v.range(lo + width - 1, lo);
+        r[n % width] = ~r[n % width];
+        v.range(len - 1 - lo, len - width - lo) = r;
+        checksum = checksum * 3 + (v.range(lo + width - 1, lo).or_reduce() ==
+                                   sc_dt::Log_1);
+        checksum = checksum * 3 + (v.xor_reduce() == sc_dt::Log_1);
+        checksum = checksum * 3 + (v.and_reduce() == sc_dt::Log_1);
+    }
+    return checksum;
+}
+
+template <class T>
+void measure(const char* name, int len, unsigned iterations)
+{
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    unsigned checksum = run<T>(len, iterations);
+    double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count();
+
+    cout << name << " " << len << " bits, " << iterations
+         << " iterations: checksum " << checksum << ", " << ms << " ms"
+         << endl;
+}
+
+int sc_main(int argc, char* argv[])
+{
+    unsigned iterations = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+    const int lens[] = { 64, 512, 2048 };
+    for (int len : lens) {
+        measure<sc_bv_base>("sc_bv", len, iterations);
+    }
+    for (int len : lens) {
+        measure<sc_lv_base>("sc_lv", len, iterations);
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Race-free method processes benchmark. Chains of FIFOs, each
+              FIFO has combinational method marked with race_free() and
+              clocked method. Received data checksum and simulation time
+              are printed. With ENABLE_PARALLEL_METHODS the race-free methods
+              are run in SC_PARALLEL_METHOD_THREADS threads, 1 thread is the
+              same as serial run, the checksum should not depend on that.
+
+  Usage: sc_parallel_methods [chains] [stages] [cycles] [work]
+         defaults are 64 chains of 4 FIFOs, 2000 cycles, 100 work iterations
+         in combinational method
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <chrono>
+#include <cstdlib>
+
+// Data hash with given number of iterations, emulates combinational logic
+inline unsigned hash(unsigned data, unsigned work)
+{
+    for (unsigned i = 0; i != work; ++i) {
+        data = (data ^ (data >> 13)) * 0x5bd1e995u + i;
+    }
+    return data;
+}
+
+SC_MODULE(fifo)
+{
+    static const unsigned N = 4;
+
+    sc_in<bool>         clk;
+    sc_in<bool>         put_valid;
+    sc_in<unsigned>     put_data;
+    sc_out<bool>        put_ready;
+    sc_out<bool>        get_valid;
+    sc_out<unsigned>    get_data;
+    sc_in<bool>         get_ready;
+
+    sc_signal<unsigned> buf[N];
+    sc_signal<unsigned> rd;
+    sc_signal<unsigned> wr;
+    sc_signal<unsigned> cnt;
+
+    unsigned work;
+
+    SC_HAS_PROCESS(fifo);
+
+    fifo(const sc_module_name& name, unsigned work_)
+      : sc_module(name)
+      , work(work_)
+    {
+        SC_METHOD(comb_proc);
+        sensitive << rd << cnt;
+        for (unsigned i = 0; i != N; ++i) sensitive << buf[i];
+        race_free();
+
+        SC_METHOD(sync_proc);
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    // Writes own outputs only
+    void comb_proc()
+    {
+        put_ready = cnt.read() != N;
+        get_valid = cnt.read() != 0;
+        get_data = hash(buf[rd.read()].read(), work);
+    }
+
+    void sync_proc()
+    {
+        bool put = put_valid.read() && put_ready.read();
+        bool get = get_valid.read() && get_ready.read();
+        if (put) {
+            buf[wr.read()] = put_data.read();
+            wr = (wr.read() + 1) % N;
+        }
+        if (get) {
+            rd = (rd.read() + 1) % N;
+        }
+        cnt = cnt.read() + put - get;
+    }
+};
+
+// FIFO chain with source and sink stalling pseudo-randomly
+SC_MODULE(chain)
+{
+    sc_in<bool>             clk;
+
+    sc_vector<fifo>         fifos;
+    sc_vector<sc_signal<bool> >     valid;
+    sc_vector<sc_signal<unsigned> > data;
+    sc_vector<sc_signal<bool> >     ready;
+
+    unsigned seed;
+    unsigned next_data;
+    unsigned received;
+    unsigned checksum;
+
+    SC_HAS_PROCESS(chain);
+
+    chain(const sc_module_name& name, unsigned index, unsigned stages,
+          unsigned work)
+      : sc_module(name)
+      , fifos("fifos", stages, [work](const char* n, size_t) {
+                                    return new fifo(n, work); })
+      , valid("valid", stages+1)
+      , data("data", stages+1)
+      , ready("ready", stages+1)
+      , seed(index + 1)
+      , next_data(index << 16)
+      , received(0)
+      , checksum(0)
+    {
+        for (unsigned i = 0; i != stages; ++i) {
+            fifos[i].clk(clk);
+            fifos[i].put_valid(valid[i]);
+            fifos[i].put_data(data[i]);
+            fifos[i].put_ready(ready[i]);
+            fifos[i].get_valid(valid[i+1]);
+            fifos[i].get_data(data[i+1]);
+            fifos[i].get_ready(ready[i+1]);
+        }
+
+        SC_METHOD(source_proc);
+        sensitive << clk.pos();
+
+        SC_METHOD(sink_proc);
+        sensitive << clk.pos();
+    }
+
+    bool random()
+    {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) & 1;
+    }
+
+    void source_proc()
+    {
+        if (valid[0].read() && ready[0].read()) next_data++;
+        valid[0] = random();
+        data[0] = next_data;
+    }
+
+    void sink_proc()
+    {
+        size_t last = ready.size()-1;
+        if (valid[last].read() && ready[last].read()) {
+            received++;
+            checksum = hash(checksum ^ data[last].read(), 1);
+        }
+        ready[last] = random();
+    }
+};
+
+int sc_main(int argc, char* argv[])
+{
+    unsigned chains = argc > 1 ? std::atoi(argv[1]) : 64;
+    unsigned stages = argc > 2 ? std::atoi(argv[2]) : 4;
+    unsigned cycles = argc > 3 ? std::atoi(argv[3]) : 2000;
+    unsigned work   = argc > 4 ? std::atoi(argv[4]) : 100;
+
+    sc_clock clk("clk", 10, SC_NS);
+    sc_vector<chain> chs("chs", chains,
+                         [stages, work](const char* n, size_t i) {
+                             return new chain(n, i, stages, work); });
+    for (unsigned i = 0; i != chains; ++i) {
+        chs[i].clk(clk);
+    }
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    sc_start(sc_time(10.0 * cycles, SC_NS));
+    double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count();
+
+    unsigned received = 0;
+    unsigned checksum = 0;
+    for (unsigned i = 0; i != chains; ++i) {
+        received += chs[i].received;
+        checksum = hash(checksum ^ chs[i].checksum, 1);
+    }
+    cout << "received " << received << " checksum " << checksum << endl;
+
+    const char* threads = std::getenv("SC_PARALLEL_METHOD_THREADS");
+    cout << chains << "x" << stages << " FIFOs, " << cycles << " cycles, "
+         << work << " work, threads " << (threads ? threads : "default")
+         << ": " << ms << " ms" << endl;
+    return 0;
+}
@@ -0,0 +1,57 @@
+###############################################################################
+#
+# Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+# more contributor license agreements.  See the NOTICE file distributed
+# with this work for additional information regarding copyright ownership.
+# Accellera licenses this file to you under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with the
+# License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied.  See the License for the specific language governing
+# permissions and limitations under the License.
+#
+###############################################################################
+
+###############################################################################
+#
+# examples/sysc/2.3/sc_parallel_methods/run_parallel_test.cmake --
+# Run the example with one thread (serial run) and with several threads for
+# race-free methods, and compare received data checksums.
+#
+# Usage: cmake -DTEST_EXE=<executable> -DTEST_DIR=<directory>
+#              -P run_parallel_test.cmake
+#
+###############################################################################
+
+cmake_minimum_required (VERSION 2.8.11)
+
+function (run_with_threads THREADS RESULT)
+  execute_process (COMMAND ${CMAKE_COMMAND} -E env
+                           SC_PARALLEL_METHOD_THREADS=${THREADS}
+                           ${TEST_EXE} 64 4 500 10
+                   WORKING_DIRECTORY ${TEST_DIR}
+                   RESULT_VARIABLE TEST_EXIT_CODE
+                   OUTPUT_VARIABLE TEST_OUTPUT
+                   ERROR_VARIABLE TEST_ERROR)
+  if (NOT TEST_EXIT_CODE EQUAL 0)
+    message (FATAL_ERROR "***ERROR: ${THREADS} threads run failed:\n${TEST_ERROR}")
+  endif ()
+  if (NOT TEST_OUTPUT MATCHES "(received [0-9]+ checksum [0-9]+)")
+    message (FATAL_ERROR "***ERROR: no checksum in ${THREADS} threads run")
+  endif ()
+  set (${RESULT} "${CMAKE_MATCH_1}" PARENT_SCOPE)
+endfunction ()
+
+run_with_threads (1 SERIAL_RESULT)
+run_with_threads (4 PARALLEL_RESULT)
+
+if (NOT "${SERIAL_RESULT}" STREQUAL "${PARALLEL_RESULT}")
+  message (FATAL_ERROR "***ERROR: parallel run \"${PARALLEL_RESULT}\" "
+                       "differs from serial run \"${SERIAL_RESULT}\"")
+endif ()
+message ("OK, ${SERIAL_RESULT}")
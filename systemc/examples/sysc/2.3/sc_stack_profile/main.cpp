@@ -0,0 +1,129 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Thread stack size profile. Each module has a thread with deep
+              call stack and a thread with shallow one. Run the example with
+              SC_STACK_PROFILE=<file> to write stack usage of the threads,
+              then with SC_STACK_SIZES=<file> to get stacks of the measured
+              size instead of the default one. Computed result should be the
+              same in both runs, virtual memory size is printed if available.
+
+  Usage: sc_stack_profile [modules] [cycles]
+         defaults are 1000 modules, 100 cycles
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+// Recursive sum with 4KB frame at each level, frame is used after the call
+unsigned deep_sum(unsigned level, unsigned data)
+{
+    volatile unsigned char frame[4096];
+    for (unsigned i = 0; i < sizeof(frame); i += 64) {
+        frame[i] = static_cast<unsigned char>(data + i);
+    }
+    unsigned res = level == 0 ? 0 : deep_sum(level - 1, data * 3 + 1);
+    return res + frame[level * 64] + frame[sizeof(frame) - 64];
+}
+
+SC_MODULE(worker)
+{
+    sc_in<bool>     clk;
+
+    unsigned        deep_result;
+    unsigned        shallow_result;
+
+    SC_HAS_PROCESS(worker);
+
+    worker(const sc_module_name& name, unsigned seed) :
+        sc_module(name), deep_result(seed), shallow_result(seed)
+    {
+        SC_THREAD(deep_thread);
+        sensitive << clk.pos();
+
+        SC_THREAD(shallow_thread);
+        sensitive << clk.pos();
+    }
+
+    // Uses about 40KB of stack
+    void deep_thread()
+    {
+        while (true) {
+            wait();
+            deep_result = deep_sum(9, deep_result);
+        }
+    }
+
+    void shallow_thread()
+    {
+        while (true) {
+            wait();
+            shallow_result = shallow_result * 5 + 3;
+        }
+    }
+};
+
+// Virtual memory size in MB, 0 if not available
+unsigned virtual_memory_mb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "VmSize:") {
+            unsigned long kb = 0;
+            status >> kb;
+            return static_cast<unsigned>(kb >> 10);
+        }
+    }
+    return 0;
+}
+
+int sc_main(int argc, char* argv[])
+{
+    unsigned modules = argc > 1 ? std::atoi(argv[1]) : 1000;
+    unsigned cycles  = argc > 2 ? std::atoi(argv[2]) : 100;
+
+    sc_clock clk("clk", 10, SC_NS);
+    sc_vector<worker> workers("workers", modules,
+                              [](const char* n, size_t i) {
+                                  return new worker(n, i); });
+    for (unsigned i = 0; i != modules; ++i) {
+        workers[i].clk(clk);
+    }
+
+    sc_start(sc_time(10.0 * cycles, SC_NS));
+
+    unsigned result = 0;
+    for (unsigned i = 0; i != modules; ++i) {
+        result = result * 31 + workers[i].deep_result;
+        result = result * 31 + workers[i].shallow_result;
+    }
+    cout << "threads " << 2 * modules << " result " << result << endl;
+
+    unsigned vm = virtual_memory_mb();
+    if (vm) {
+        cout << "virtual memory " << vm << " MB" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+###############################################################################
+#
+# Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+# more contributor license agreements.  See the NOTICE file distributed
+# with this work for additional information regarding copyright ownership.
+# Accellera licenses this file to you under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with the
+# License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied.  See the License for the specific language governing
+# permissions and limitations under the License.
+#
+###############################################################################
+
+###############################################################################
+#
+# examples/sysc/2.3/sc_stack_profile/run_stack_profile_test.cmake --
+# Run the example with SC_STACK_PROFILE to write thread stack profile, then
+# with SC_STACK_SIZES to reload it. Check the profile has all threads, the
+# result is the same in both runs and virtual memory is reduced.
+#
+# Usage: cmake -DTEST_EXE=<executable> -DTEST_DIR=<directory>
+#              -P run_stack_profile_test.cmake
+#
+###############################################################################
+
+cmake_minimum_required (VERSION 2.8.11)
+
+set (MODULES 1000)
+set (PROFILE ${TEST_DIR}/stack_profile.txt)
+set (PROFILE_RELOADED ${TEST_DIR}/stack_profile_reloaded.txt)
+file (REMOVE ${PROFILE} ${PROFILE_RELOADED})
+
+function (run_with_env NAME RESULT MEMORY)
+  execute_process (COMMAND ${CMAKE_COMMAND} -E env ${ARGN}
+                           ${TEST_EXE} ${MODULES} 10
+                   WORKING_DIRECTORY ${TEST_DIR}
+                   RESULT_VARIABLE TEST_EXIT_CODE
+                   OUTPUT_VARIABLE TEST_OUTPUT
+                   ERROR_VARIABLE TEST_ERROR)
+  if (NOT TEST_EXIT_CODE EQUAL 0)
+    message (FATAL_ERROR "***ERROR: ${NAME} run failed:\n${TEST_ERROR}")
+  endif ()
+  if (NOT TEST_OUTPUT MATCHES "(threads [0-9]+ result [0-9]+)")
+    message (FATAL_ERROR "***ERROR: no result in ${NAME} run")
+  endif ()
+  set (${RESULT} "${CMAKE_MATCH_1}" PARENT_SCOPE)
+  set (${MEMORY} 0 PARENT_SCOPE)
+  if (TEST_OUTPUT MATCHES "virtual memory ([0-9]+) MB")
+    set (${MEMORY} ${CMAKE_MATCH_1} PARENT_SCOPE)
+  endif ()
+endfunction ()
+
+run_with_env (profile PROFILE_RESULT PROFILE_MEMORY
+              SC_STACK_PROFILE=${PROFILE})
+
+# Stack usage is measured with QuickThreads coroutine package only
+if (NOT EXISTS ${PROFILE})
+  message ("Stack profile is not written, reload is not checked")
+  return ()
+endif ()
+
+file (STRINGS ${PROFILE} PROFILE_LINES)
+list (LENGTH PROFILE_LINES PROFILE_THREADS)
+math (EXPR THREADS "2 * ${MODULES}")
+if (NOT PROFILE_THREADS EQUAL THREADS)
+  message (FATAL_ERROR "***ERROR: ${PROFILE_THREADS} threads in profile, "
+                       "${THREADS} expected")
+endif ()
+file (STRINGS ${PROFILE} DEEP_LINE REGEX "^workers_0[.]deep_thread ")
+file (STRINGS ${PROFILE} SHALLOW_LINE REGEX "^workers_0[.]shallow_thread ")
+string (REGEX REPLACE ".* " "" DEEP_SIZE "${DEEP_LINE}")
+string (REGEX REPLACE ".* " "" SHALLOW_SIZE "${SHALLOW_LINE}")
+if (NOT DEEP_SIZE GREATER SHALLOW_SIZE)
+  message (FATAL_ERROR "***ERROR: deep thread stack usage \"${DEEP_SIZE}\" "
+                       "is not greater than shallow one \"${SHALLOW_SIZE}\"")
+endif ()
+
+run_with_env (reload RELOAD_RESULT RELOAD_MEMORY
+              SC_STACK_SIZES=${PROFILE} SC_STACK_PROFILE=${PROFILE_RELOADED})
+
+if (NOT "${PROFILE_RESULT}" STREQUAL "${RELOAD_RESULT}")
+  message (FATAL_ERROR "***ERROR: reloaded profile run \"${RELOAD_RESULT}\" "
+                       "differs from profile run \"${PROFILE_RESULT}\"")
+endif ()
+if (NOT EXISTS ${PROFILE_RELOADED})
+  message (FATAL_ERROR "***ERROR: profile is not written in reload run")
+endif ()
+if (PROFILE_MEMORY AND NOT RELOAD_MEMORY LESS PROFILE_MEMORY)
+  message (FATAL_ERROR "***ERROR: virtual memory ${RELOAD_MEMORY} MB with "
+                       "reloaded profile, ${PROFILE_MEMORY} MB with default "
+                       "stacks")
+endif ()
+message ("OK, ${PROFILE_RESULT}, deep thread stack ${DEEP_SIZE} bytes, "
+         "virtual memory ${PROFILE_MEMORY} -> ${RELOAD_MEMORY} MB")
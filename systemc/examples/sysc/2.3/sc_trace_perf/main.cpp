@@ -0,0 +1,109 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Tracing performance benchmark. Clocked thread writes some of
+              traced sc_uint<16> signals each cycle, simulation time with
+              VCD, binary or no trace file is printed.
+
+  Usage: sc_trace_perf <vcd|bin|none> [signals] [written] [cycles]
+         defaults are 2000 signals, 200 written per cycle, 20000 cycles
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+SC_MODULE(writer)
+{
+    sc_in<bool>                         clk;
+    sc_vector<sc_signal<sc_uint<16> > > sigs;
+
+    unsigned written;
+    unsigned cycles;
+
+    SC_HAS_PROCESS(writer);
+
+    writer(const sc_module_name& name, unsigned signals, unsigned written_,
+           unsigned cycles_)
+      : sc_module(name)
+      , sigs("sigs", signals)
+      , written(written_)
+      , cycles(cycles_)
+    {
+        SC_CTHREAD(proc, clk.pos());
+    }
+
+    // Different signals are written in each cycle
+    void proc()
+    {
+        unsigned first = 0;
+        for (unsigned c = 1; c <= cycles; ++c) {
+            wait();
+            for (unsigned i = 0; i != written; ++i) {
+                sc_signal<sc_uint<16> >& s = sigs[(first + i) % sigs.size()];
+                s = s.read() + 1;
+            }
+            first = (first + written) % sigs.size();
+        }
+        sc_stop();
+    }
+};
+
+int sc_main(int argc, char* argv[])
+{
+    const char* format = argc > 1 ? argv[1] : "vcd";
+    unsigned signals = argc > 2 ? std::atoi(argv[2]) : 2000;
+    unsigned written = argc > 3 ? std::atoi(argv[3]) : 200;
+    unsigned cycles  = argc > 4 ? std::atoi(argv[4]) : 20000;
+    if (written > signals) written = signals;
+
+    sc_clock clk("clk", 10, SC_NS);
+    writer w("w", signals, written, cycles);
+    w.clk(clk);
+
+    sc_trace_file* tf = 0;
+    if (std::strcmp(format, "vcd") == 0) {
+        tf = sc_create_vcd_trace_file("trace_perf");
+    } else if (std::strcmp(format, "bin") == 0) {
+        tf = sc_create_bin_trace_file("trace_perf");
+    }
+    if (tf) {
+        for (unsigned i = 0; i != signals; ++i) {
+            sc_trace(tf, w.sigs[i], w.sigs[i].name());
+        }
+    }
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    sc_start();
+    if (tf) {
+        if (std::strcmp(format, "vcd") == 0) sc_close_vcd_trace_file(tf);
+        else sc_close_bin_trace_file(tf);
+    }
+    double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count();
+
+    cout << format << " " << signals << " signals, " << written
+         << " written, " << cycles << " cycles: " << ms << " ms" << endl;
+    return 0;
+}
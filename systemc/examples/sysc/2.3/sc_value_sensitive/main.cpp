@@ -0,0 +1,108 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Value sensitivity test. Clocked thread writes two sc_buffers
+              every cycle, their values change every 4th and 8th cycle.
+              Method with value_sensitive is run only if any of the values
+              is changed, its output is compared with the same method with
+              normal sensitivity.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+SC_MODULE(dut)
+{
+    sc_in<bool>     clk;
+    sc_buffer<int>  a;
+    sc_buffer<int>  b;
+    sc_signal<int>  plain_sum;
+    sc_signal<int>  value_sum;
+
+    unsigned plain_runs;
+    unsigned value_runs;
+    unsigned errors;
+
+    SC_HAS_PROCESS(dut);
+
+    explicit dut(const sc_module_name& name)
+      : sc_module(name)
+      , a("a"), b("b"), plain_sum("plain_sum"), value_sum("value_sum")
+      , plain_runs(0), value_runs(0), errors(0)
+    {
+        SC_CTHREAD(write_proc, clk.pos());
+
+        SC_METHOD(plain_proc);
+        sensitive << a << b;
+
+        SC_METHOD(value_proc);
+        value_sensitive << a << b;
+
+        SC_METHOD(check_proc);
+        sensitive << clk.neg();
+        dont_initialize();
+    }
+
+    // Same value is written in most cycles
+    void write_proc()
+    {
+        for (unsigned c = 0; c < 32; ++c) {
+            a.write(c / 4);
+            b.write(c / 8);
+            wait();
+        }
+    }
+
+    void plain_proc()
+    {
+        plain_runs++;
+        plain_sum = a.read() + b.read();
+    }
+
+    void value_proc()
+    {
+        value_runs++;
+        value_sum = a.read() + b.read();
+    }
+
+    void check_proc()
+    {
+        if (plain_sum.read() != value_sum.read()) {
+            cout << sc_time_stamp() << " plain_sum " << plain_sum.read()
+                 << " value_sum " << value_sum.read() << endl;
+            errors++;
+        }
+    }
+};
+
+int sc_main(int argc, char* argv[])
+{
+    sc_clock clk("clk", 10, SC_NS);
+    dut d("d");
+    d.clk(clk);
+
+    sc_start(320, SC_NS);
+
+    cout << "plain method runs " << d.plain_runs << endl;
+    cout << "value method runs " << d.value_runs << endl;
+    cout << "errors " << d.errors << endl;
+    return d.errors != 0;
+}
@@ -36,6 +36,10 @@ void finalize_elaboration();
 /// Generate mangled names for sc_objects, allocated using raw new or new[]
 void finalize_module_allocations();
 
+/// Clear traced dynamic allocations and start new simulation context, 
+/// used to elaborate next design in the same process
+void reset_elaboration();
+
 }
 
 #endif //SCTOOL_ALLOCATED_NODE_H
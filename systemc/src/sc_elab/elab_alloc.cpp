@@ -132,4 +132,14 @@ void finalize_module_allocations()
     }
 }
 
+void reset_elaboration()
+{
+    get_alloc_node_map()->clear();
+
+    // Previous context is not deleted, as design objects allocated with new 
+    // in sc_main are still registered there
+    sc_core::sc_curr_simcontext = nullptr;
+    sc_core::sc_default_global_context = nullptr;
+}
+
 }
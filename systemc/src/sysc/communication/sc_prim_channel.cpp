@@ -351,6 +351,29 @@ sc_prim_channel_registry::async_detach_suspending(sc_prim_channel& p)
 #endif
 }
 
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+thread_local sc_prim_channel** sc_parallel_update_list_p = 0;
+
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::merge_update_list"
+// |
+// | This method adds the update requests listed by a parallel evaluation
+// | worker thread to the simulator's list.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::merge_update_list( sc_prim_channel* list_p )
+{
+    if( list_p == (sc_prim_channel*)sc_prim_channel::list_end )
+        return;
+
+    sc_prim_channel* last_p = list_p;
+    while( last_p->m_update_next_p != (sc_prim_channel*)sc_prim_channel::list_end )
+        last_p = last_p->m_update_next_p;
+    last_p->m_update_next_p = m_update_list_p;
+    m_update_list_p = list_p;
+}
+#endif // SC_ENABLE_PARALLEL_METHODS
+
 // +----------------------------------------------------------------------------
 // |"sc_prim_channel_registry::perform_update"
 // |
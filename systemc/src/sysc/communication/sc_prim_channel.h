@@ -236,6 +236,7 @@ private:
 class sc_prim_channel_registry
 {
     friend class sc_simcontext;
+    friend class sc_method_pool;
 
 public:
 
@@ -282,6 +283,11 @@ private:
     // called during the update phase of a delta cycle
     void perform_update();
 
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    // add update requests done by parallel evaluation worker
+    void merge_update_list( sc_prim_channel* );
+#endif // SC_ENABLE_PARALLEL_METHODS
+
     // called when construction is done
     bool construction_done();
 
@@ -319,10 +325,22 @@ private:
 //  FOR INTERNAL USE ONLY!
 // ----------------------------------------------------------------------------
 
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+// update request list of parallel evaluation worker thread, null otherwise
+extern SC_API thread_local sc_prim_channel** sc_parallel_update_list_p;
+#endif // SC_ENABLE_PARALLEL_METHODS
+
 inline
 void
 sc_prim_channel_registry::request_update( sc_prim_channel& prim_channel_ )
 {
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    if( sc_parallel_update_list_p ) {
+        prim_channel_.m_update_next_p = *sc_parallel_update_list_p;
+        *sc_parallel_update_list_p = &prim_channel_;
+        return;
+    }
+#endif // SC_ENABLE_PARALLEL_METHODS
     prim_channel_.m_update_next_p = m_update_list_p;
     m_update_list_p = &prim_channel_;
 }
@@ -159,6 +159,7 @@ sc_signal_channel::do_update()
 {
     notify_next_delta( m_change_event_p );
     m_change_stamp = simcontext()->change_stamp();
+    if( m_trace_subscribers ) notify_trace_subscribers();
 }
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
@@ -82,6 +82,7 @@ sc_writer_policy_check_write::update()
 
 class SC_API sc_signal_channel
   : public sc_prim_channel
+  , public sc_trace_source
 {
 protected:
 
@@ -304,7 +304,7 @@ sc_in<T>::end_of_elaboration()
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
 	    in_if_type* iface = dynamic_cast<in_if_type*>( this->get_interface() );
-	    sc_trace( p->tf, iface->read(), p->name );
+	    sc_trace( p->tf, *iface, p->name );
 	}
 	remove_traces();
     }
@@ -1141,7 +1141,7 @@ sc_inout<T>::end_of_elaboration()
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
 	    in_if_type* iface = dynamic_cast<in_if_type*>( this->get_interface() );
-	    sc_trace( p->tf, iface->read(), p->name );
+	    sc_trace( p->tf, *iface, p->name );
 	}
 	remove_traces();
     }
@@ -2575,10 +2575,17 @@ sc_subref_r<X>::get_word( int i ) const
 	    result |= (m_obj[n].value() & SC_DIGIT_ONE) << k ++;
 	}
     } else {
+	// read up to two words of the object instead of single bits
 	n1 = m_lo + i * SC_DIGIT_SIZE;
-	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    result |= (m_obj[n].value() & SC_DIGIT_ONE) << k ++;
+	n2 = sc_min( SC_DIGIT_SIZE, m_hi + 1 - n1 );
+	int wi = n1 / SC_DIGIT_SIZE;
+	int bi = n1 % SC_DIGIT_SIZE;
+	result = m_obj.get_word( wi ) >> bi;
+	if( bi != 0 && bi + n2 > SC_DIGIT_SIZE ) {
+	    result |= m_obj.get_word( wi + 1 ) << (SC_DIGIT_SIZE - bi);
+	}
+	if( n2 < SC_DIGIT_SIZE ) {
+	    result &= ~(~SC_DIGIT_ZERO << n2);
 	}
     }
     return result;
@@ -2601,12 +2608,19 @@ sc_subref_r<X>::set_word( int i, sc_digit w )
 				      ( m_obj[n].value() & SC_DIGIT_TWO ) ) );
 	}
     } else {
+	// update up to two words of the object instead of single bits
 	n1 = m_lo + i * SC_DIGIT_SIZE;
-	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    m_obj.set_bit( n, value_type(
-	                                ( (w >> k ++) & SC_DIGIT_ONE ) |
-					( m_obj[n].value() & SC_DIGIT_TWO ) ) );
+	n2 = sc_min( SC_DIGIT_SIZE, m_hi + 1 - n1 );
+	int wi = n1 / SC_DIGIT_SIZE;
+	int bi = n1 % SC_DIGIT_SIZE;
+	sc_digit mask = ( n2 < SC_DIGIT_SIZE ) ?
+	                ~(~SC_DIGIT_ZERO << n2) : ~SC_DIGIT_ZERO;
+	w &= mask;
+	m_obj.set_word( wi, (m_obj.get_word( wi ) & ~(mask << bi)) | (w << bi) );
+	if( bi != 0 && bi + n2 > SC_DIGIT_SIZE ) {
+	    int nbi = SC_DIGIT_SIZE - bi;
+	    m_obj.set_word( wi + 1, (m_obj.get_word( wi + 1 ) & ~(mask >> nbi)) |
+	                          (w >> nbi) );
 	}
     }
 }
@@ -2628,10 +2642,17 @@ sc_subref_r<X>::get_cword( int i ) const
 	    result |= ((m_obj[n].value() & SC_DIGIT_TWO) >> 1) << k ++;
 	}
     } else {
+	// read up to two words of the object instead of single bits
 	n1 = m_lo + i * SC_DIGIT_SIZE;
-	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    result |= ((m_obj[n].value() & SC_DIGIT_TWO) >> 1) << k ++;
+	n2 = sc_min( SC_DIGIT_SIZE, m_hi + 1 - n1 );
+	int wi = n1 / SC_DIGIT_SIZE;
+	int bi = n1 % SC_DIGIT_SIZE;
+	result = m_obj.get_cword( wi ) >> bi;
+	if( bi != 0 && bi + n2 > SC_DIGIT_SIZE ) {
+	    result |= m_obj.get_cword( wi + 1 ) << (SC_DIGIT_SIZE - bi);
+	}
+	if( n2 < SC_DIGIT_SIZE ) {
+	    result &= ~(~SC_DIGIT_ZERO << n2);
 	}
     }
     return result;
@@ -2654,12 +2675,19 @@ sc_subref_r<X>::set_cword( int i, sc_digit w )
 				     ( m_obj[n].value() & SC_DIGIT_ONE ) ) );
 	}
     } else {
+	// update up to two words of the object instead of single bits
 	n1 = m_lo + i * SC_DIGIT_SIZE;
-	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    m_obj.set_bit( n, value_type(
-	                                ( ((w >> k ++) & SC_DIGIT_ONE) << 1 ) |
-					( m_obj[n].value() & SC_DIGIT_ONE ) ) );
+	n2 = sc_min( SC_DIGIT_SIZE, m_hi + 1 - n1 );
+	int wi = n1 / SC_DIGIT_SIZE;
+	int bi = n1 % SC_DIGIT_SIZE;
+	sc_digit mask = ( n2 < SC_DIGIT_SIZE ) ?
+	                ~(~SC_DIGIT_ZERO << n2) : ~SC_DIGIT_ZERO;
+	w &= mask;
+	m_obj.set_cword( wi, (m_obj.get_cword( wi ) & ~(mask << bi)) | (w << bi) );
+	if( bi != 0 && bi + n2 > SC_DIGIT_SIZE ) {
+	    int nbi = SC_DIGIT_SIZE - bi;
+	    m_obj.set_cword( wi + 1, (m_obj.get_cword( wi + 1 ) & ~(mask >> nbi)) |
+	                          (w >> nbi) );
 	}
     }
 }
@@ -1279,18 +1279,31 @@ reverse( const sc_proxy<X>& a );
 
 // reduce functions
 
+// Reductions are done on words: a bit is 0 if both data and control
+// bits are 0, 1 if only data bit is 1, and X or Z if control bit is 1.
+// The tail of the last word is masked as proxies do not clean it.
+
 template <class X>
 inline
 typename sc_proxy<X>::value_type
 sc_proxy<X>::and_reduce() const
 {
     const X& x = back_cast();
-    value_type result = value_type( 1 );
     int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::and_table[result][x.get_bit( i )];
+    int sz = x.size();
+    sc_digit unknown = SC_DIGIT_ZERO;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit mask = ( i < sz - 1 || len % SC_DIGIT_SIZE == 0 ) ?
+	                ~SC_DIGIT_ZERO :
+	                ~(~SC_DIGIT_ZERO << (len % SC_DIGIT_SIZE));
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	if( ~(x_dw | x_cw) & mask ) {
+	    return value_type( 0 );
+	}
+	unknown |= x_cw & mask;
     }
-    return result;
+    return ( unknown ? value_type( Log_X ) : value_type( 1 ) );
 }
 
 template <class X>
@@ -1299,12 +1312,21 @@ typename sc_proxy<X>::value_type
 sc_proxy<X>::or_reduce() const
 {
     const X& x = back_cast();
-    value_type result = value_type( 0 );
     int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::or_table[result][x.get_bit( i )];
+    int sz = x.size();
+    sc_digit unknown = SC_DIGIT_ZERO;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit mask = ( i < sz - 1 || len % SC_DIGIT_SIZE == 0 ) ?
+	                ~SC_DIGIT_ZERO :
+	                ~(~SC_DIGIT_ZERO << (len % SC_DIGIT_SIZE));
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	if( x_dw & ~x_cw & mask ) {
+	    return value_type( 1 );
+	}
+	unknown |= x_cw & mask;
     }
-    return result;
+    return ( unknown ? value_type( Log_X ) : value_type( 0 ) );
 }
 
 template <class X>
@@ -1313,12 +1335,25 @@ typename sc_proxy<X>::value_type
 sc_proxy<X>::xor_reduce() const
 {
     const X& x = back_cast();
-    value_type result = value_type( 0 );
     int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::xor_table[result][x.get_bit( i )];
+    int sz = x.size();
+    sc_digit parity = SC_DIGIT_ZERO;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit mask = ( i < sz - 1 || len % SC_DIGIT_SIZE == 0 ) ?
+	                ~SC_DIGIT_ZERO :
+	                ~(~SC_DIGIT_ZERO << (len % SC_DIGIT_SIZE));
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	if( x_cw & mask ) {
+	    return value_type( Log_X );
+	}
+	parity ^= x_dw & mask;
+    }
+    // fold word parity into one bit
+    for( int n = SC_DIGIT_SIZE / 2; n > 0; n /= 2 ) {
+	parity ^= parity >> n;
     }
-    return result;
+    return value_type( parity & SC_DIGIT_ONE );
 }
 
 
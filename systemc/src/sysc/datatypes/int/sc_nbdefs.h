@@ -163,6 +163,13 @@ static const int MAX_NDIGITS = DIV_CEIL(SC_MAX_NBITS) + 2;
 // DIV_CEIL(y) <= DIV_CEIL(SC_MAX_NBITS) + 2. This is the reason for +2
 // above. With this change, MAX_NDIGITS must be enough to hold the
 // result of any operation.
+#else
+// Number of digits stored inside sc_signed/sc_unsigned object and used
+// for temporaries on stack, numbers up to 300 bits (sc_bigint<300>,
+// sc_biguint<299>) and results of operations on them do not use heap.
+#ifndef SC_BASE_VEC_DIGITS
+#define SC_BASE_VEC_DIGITS 10
+#endif
 #endif
 
 // Support for "digit" vectors used to hold the values of sc_signed,
@@ -1167,7 +1167,8 @@ public:
     virtual ~sc_signed()
 	{
 #ifndef SC_MAX_NBITS
-	    delete [] digit;
+	    if ( digit != base_vec )
+	        delete [] digit;
 #endif
 	}
 
@@ -2176,6 +2177,11 @@ private:
   sc_digit digit[DIV_CEIL(SC_MAX_NBITS)];   // Shortened as d.
 #else
   sc_digit *digit;                       // Shortened as d.
+  sc_digit base_vec[SC_BASE_VEC_DIGITS]; // Inline storage for small d.
+
+  // Use inline storage if nd digits fit into it, allocate otherwise.
+  sc_digit* alloc_digits( int nd )
+    { return nd <= SC_BASE_VEC_DIGITS ? base_vec : new sc_digit[nd]; }
 #endif
 
   // Private constructors:
@@ -2359,7 +2365,7 @@ sc_signed::sc_signed( const sc_generic_base<T>& v )
 #   ifdef SC_MAX_NBITS
         test_bound(nb);
 #    else
-        digit = new sc_digit[ndigits];
+        digit = alloc_digits(ndigits);
 #    endif
     makezero();
     v->to_sc_signed(*this);
@@ -69,6 +69,10 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool /* enable */ ) {}
 
+    // stack high-water mark in bytes, 0 if not measured
+    virtual std::size_t stack_usage() const
+        { return 0; }
+
 private:
 
     // disabled
@@ -31,9 +31,18 @@
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
 
 #include "sysc/kernel/sc_cor_qt.h"
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_stack_profile.h"
+
+#ifndef MAP_NORESERVE
+#   define MAP_NORESERVE 0
+#endif
 
 namespace sc_core {
 
@@ -49,6 +58,115 @@ static sc_cor_qt main_cor;
 
 static sc_cor_qt* curr_cor = 0;
 
+static std::size_t
+get_pagesize()
+{
+    static std::size_t pagesize;
+
+    if( pagesize == 0 ) {
+#       if defined(__ppc__)
+	    pagesize = getpagesize();
+#       else
+	    pagesize = sysconf( _SC_PAGESIZE );
+#       endif
+    }
+
+    sc_assert( pagesize != 0 );
+    return pagesize;
+}
+
+
+static bool
+page_resident( const void* page, std::size_t pagesize )
+{
+#if defined(__APPLE__)
+    char vec = 1;
+#else
+    unsigned char vec = 1;
+#endif
+    if( mincore( (void*) page, pagesize, &vec ) != 0 ) {
+	return true;
+    }
+    return ( vec & 1 ) != 0;
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_qt_stack_pool
+//
+//  Pool of coroutine stacks. Each stack is a separate anonymous mapping with
+//  a permanent guard page at the growth end, so stack overflow is caught
+//  without mprotect calls at each thread creation and deletion. Released
+//  stacks are kept in free lists by size, their memory is given back to the
+//  system but the address range is reused by the next stack of the same size.
+// ----------------------------------------------------------------------------
+
+class sc_cor_qt_stack_pool
+{
+public:
+
+    // allocate stack of given size rounded up to page size, return 0
+    // if the mapping failed
+    void* allocate( std::size_t& stack_size );
+
+    // return stack to the pool
+    void release( void* stack, std::size_t stack_size );
+
+private:
+
+    std::map<std::size_t, std::vector<void*> > m_free;  // free stacks by size
+};
+
+void*
+sc_cor_qt_stack_pool::allocate( std::size_t& stack_size )
+{
+    std::size_t pagesize = get_pagesize();
+    stack_size = ( ( stack_size + pagesize - 1 ) / pagesize ) * pagesize;
+
+    std::vector<void*>& free_list = m_free[stack_size];
+    if( !free_list.empty() ) {
+	void* stack = free_list.back();
+	free_list.pop_back();
+	return stack;
+    }
+
+    void* base = mmap( 0, stack_size + pagesize, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+    if( base == MAP_FAILED ) {
+	return 0;
+    }
+
+#ifdef QUICKTHREADS_GROW_DOWN
+    // Stacks grow from high address down to low address
+    char* guard = (char*) base;
+    char* stack = guard + pagesize;
+#else
+    // Stacks grow from low address up to high address
+    char* stack = (char*) base;
+    char* guard = stack + stack_size;
+#endif
+
+    // If the limit of mappings is reached, the stack is used without guard
+    mprotect( guard, pagesize, PROT_NONE );
+    return stack;
+}
+
+void
+sc_cor_qt_stack_pool::release( void* stack, std::size_t stack_size )
+{
+    // drop the pages, next use of the stack gets zero filled pages
+    madvise( stack, stack_size, MADV_DONTNEED );
+    m_free[stack_size].push_back( stack );
+}
+
+static sc_cor_qt_stack_pool&
+stack_pool()
+{
+    // never destroyed, coroutines may be deleted during static destruction
+    static sc_cor_qt_stack_pool* pool = new sc_cor_qt_stack_pool;
+    return *pool;
+}
+
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_qt
@@ -56,25 +174,32 @@ static sc_cor_qt* curr_cor = 0;
 //  Coroutine class implemented with QuickThreads.
 // ----------------------------------------------------------------------------
 
+// destructor
+
+sc_cor_qt::~sc_cor_qt()
+{
+    if( m_pooled ) {
+	stack_pool().release( m_stack, m_stack_size );
+    } else {
+	delete[] (char*) m_stack;
+    }
+}
+
+
 // switch stack protection on/off
 
 void
 sc_cor_qt::stack_protect( bool enable )
 {
+    // Pooled stack has permanent guard page
+    if( m_pooled ) {
+	return;
+    }
+
     // Code needs to be tested on HP-UX and disabled if it doesn't work there
     // Code still needs to be ported to WIN32
 
-    static std::size_t pagesize;
-
-    if( pagesize == 0 ) {
-#       if defined(__ppc__)
-	    pagesize = getpagesize();
-#       else
-	    pagesize = sysconf( _SC_PAGESIZE );
-#       endif
-    }
-
-    sc_assert( pagesize != 0 );
+    std::size_t pagesize = get_pagesize();
     sc_assert( m_stack_size > ( 2 * pagesize ) );
 
 #ifdef QUICKTHREADS_GROW_DOWN
@@ -110,6 +235,47 @@ sc_cor_qt::stack_protect( bool enable )
 }
 
 
+// stack high-water mark, the stack is zero filled when created, so unused
+// part is the zero bytes at the growth end; pages not resident are skipped
+
+std::size_t
+sc_cor_qt::stack_usage() const
+{
+    if( !m_measured ) {
+	return 0;
+    }
+
+    const std::size_t pagesize = get_pagesize();
+    const unsigned char* stack = (const unsigned char*) m_stack;
+    std::size_t unused = 0;
+
+    while( unused < m_stack_size ) {
+	std::size_t size = std::min( pagesize, m_stack_size - unused );
+#ifdef QUICKTHREADS_GROW_DOWN
+	const unsigned char* chunk = stack + unused;
+#else
+	const unsigned char* chunk = stack + m_stack_size - unused - size;
+#endif
+	// pooled stack is page aligned
+	if( m_pooled && !page_resident( chunk, pagesize ) ) {
+	    unused += size;
+	    continue;
+	}
+	std::size_t i = 0;
+#ifdef QUICKTHREADS_GROW_DOWN
+	while( i < size && chunk[i] == 0 ) ++i;
+#else
+	while( i < size && chunk[size - 1 - i] == 0 ) ++i;
+#endif
+	unused += i;
+	if( i < size ) {
+	    break;
+	}
+    }
+    return m_stack_size - unused;
+}
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_pkg_qt
 //
@@ -173,7 +339,22 @@ sc_cor_pkg_qt::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
     sc_cor_qt* cor = new sc_cor_qt();
     cor->m_pkg = this;
     cor->m_stack_size = stack_size;
-    cor->m_stack = new char[cor->m_stack_size];
+    cor->m_stack = stack_pool().allocate( cor->m_stack_size );
+    cor->m_pooled = ( cor->m_stack != 0 );
+    if( !cor->m_pooled ) {
+	cor->m_stack_size = stack_size;
+	cor->m_stack = new char[cor->m_stack_size];
+    }
+
+    // pooled stack is zero filled, which is required to measure its usage
+    sc_stack_profile* profile = simcontext()->stack_profile();
+    if( profile && profile->measuring() ) {
+	if( !cor->m_pooled ) {
+	    std::memset( cor->m_stack, 0, cor->m_stack_size );
+	}
+	cor->m_measured = true;
+    }
+
     void* sto = stack_align( cor->m_stack, QUICKTHREADS_STKALIGN,
                              &cor->m_stack_size );
     cor->m_sp = QUICKTHREADS_SP(sto, cor->m_stack_size - QUICKTHREADS_STKALIGN);
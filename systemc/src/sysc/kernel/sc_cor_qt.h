@@ -54,21 +54,26 @@ public:
 
     // constructor
     sc_cor_qt()
-	: m_stack_size( 0 ), m_stack( 0 ), m_sp( 0 ), m_pkg( 0 )
+	: m_stack_size( 0 ), m_stack( 0 ), m_sp( 0 ), m_pooled( false ),
+	  m_measured( false ), m_pkg( 0 )
 	{}
 
     // destructor
-    virtual ~sc_cor_qt()
-        { delete[] (char*) m_stack; }
+    virtual ~sc_cor_qt();
 
     // switch stack protection on/off
     virtual void stack_protect( bool enable );
 
+    // stack high-water mark in bytes, 0 if not measured
+    virtual std::size_t stack_usage() const;
+
 public:
 
     std::size_t    m_stack_size;  // stack size
     void*          m_stack;       // stack
     qt_t*          m_sp;          // stack pointer
+    bool           m_pooled;      // stack from pool with guard page
+    bool           m_measured;    // stack usage is measured
 
     sc_cor_pkg_qt* m_pkg;         // the creating coroutine package
 
@@ -359,13 +359,14 @@ class SC_API sc_event_timed
 {
     friend class sc_event;
     friend class sc_simcontext;
+    friend class sc_timed_event_queue;
 
     friend SC_API int sc_notify_time_compare( const void*, const void* );
 
 private:
 
     sc_event_timed( sc_event* e, const sc_time& t )
-        : m_event( e ), m_notify_time( t )
+        : m_event( e ), m_notify_time( t ), m_next( 0 )
         {}
 
     ~sc_event_timed()
@@ -391,8 +392,9 @@ private:
 
 private:
 
-    sc_event* m_event;
-    sc_time   m_notify_time;
+    sc_event*       m_event;
+    sc_time         m_notify_time;
+    sc_event_timed* m_next;        // used by calendar timed event queue
 
 private:
 
@@ -42,6 +42,7 @@ namespace sc_core {
 
 class sc_simcontext;
 class sc_process_b;
+class sc_method_pool;
 class sc_method_process;
 class sc_thread_process;
 void sc_thread_cor_fn( void* arg );
@@ -77,6 +78,7 @@ class SC_API sc_unwind_exception : public std::exception
 {
     friend class sc_simcontext;
     friend class sc_process_b;
+    friend class sc_method_pool;
     friend class sc_method_process;
     friend class sc_thread_process;
     friend void sc_thread_cor_fn( void* arg );
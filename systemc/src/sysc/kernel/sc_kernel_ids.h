@@ -163,7 +163,8 @@ SC_DEFINE_MESSAGE(SC_ID_PHASE_CALLBACK_FORBIDDEN_,       553,
        "forbidden action in simulation phase callback" )
 SC_DEFINE_MESSAGE( SC_ID_SIMULATION_START_UNEXPECTED_, 554,
         "sc_start called unexpectedly" )
-// available message number 555
+SC_DEFINE_MESSAGE(SC_ID_STACK_PROFILE_FILE_  , 555,
+        "cannot open thread stack profile file" )
 SC_DEFINE_MESSAGE(SC_ID_THROW_IT_IGNORED_  , 556,
         "throw_it on method/non-running process is being ignored " )
 SC_DEFINE_MESSAGE(SC_ID_NOT_EXPECTING_DYNAMIC_EVENT_NOTIFY_ , 557,
@@ -186,7 +187,8 @@ SC_DEFINE_MESSAGE(SC_ID_UNKNOWN_PROCESS_TYPE_,       566,
 	"Unknown process type" )
 SC_DEFINE_MESSAGE(SC_ID_TIME_CONVERSION_FAILED_, 567,
         "sc_time conversion failed")
-// available number 568
+SC_DEFINE_MESSAGE(SC_ID_RACE_FREE_NOT_METHOD_, 568,
+        "race_free() is supported for method processes only, ignored" )
 SC_DEFINE_MESSAGE(SC_ID_BAD_SC_MODULE_CONSTRUCTOR_  , 569,
         "sc_module(const char*), sc_module(const std::string&) "
         "have been deprecated, use sc_module(const sc_module_name&)" )
@@ -200,6 +202,9 @@ SC_DEFINE_MESSAGE(SC_ID_RESET_PROCESS_WHILE_NOT_RUNNING_  , 573,
         "a process may not be asynchronously reset while the simulation is not running" )
 SC_DEFINE_MESSAGE(SC_ID_THROW_IT_WHILE_NOT_RUNNING_  , 574,
         "throw_it not allowed unless simulation is running " )
+SC_DEFINE_MESSAGE(SC_ID_STACK_PROFILE_UNSUPPORTED_  , 575,
+        "thread stack usage is not measured by coroutine package, "
+        "stack profile is not written" )
 
 
 /*****************************************************************************
@@ -0,0 +1,183 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_method_pool.cpp -- Worker threads for parallel evaluation of race-free
+                        method processes.
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_method_pool.h"
+
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+
+#include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/communication/sc_prim_channel.h"
+
+namespace sc_core {
+
+// worker spins that long before it sleeps waiting for next run
+static const unsigned SC_METHOD_POOL_SPIN = 1000;
+
+sc_method_pool::sc_method_pool( unsigned threads )
+  : m_parts( threads ? threads : 1 )
+  , m_workers()
+  , m_update_lists( m_parts, (sc_prim_channel*)sc_prim_channel::list_end )
+  , m_methods( 0 )
+  , m_failed( false )
+  , m_mutex()
+  , m_start_cond()
+  , m_generation( 0 )
+  , m_done( 0 )
+  , m_stop( false )
+{
+    // part 0 is executed by the simulator thread
+    for ( unsigned i = 1; i < m_parts; i++ ) {
+        m_workers.push_back( std::thread( &sc_method_pool::worker_fn,
+                                          this, i ) );
+    }
+}
+
+sc_method_pool::~sc_method_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_stop = true;
+    }
+    m_start_cond.notify_all();
+    for ( std::size_t i = 0; i != m_workers.size(); i++ ) {
+        m_workers[i].join();
+    }
+}
+
+bool
+sc_method_pool::run( const std::vector<sc_method_handle>& methods,
+                     sc_prim_channel_registry& registry )
+{
+    m_methods = &methods;
+    m_failed = false;
+    m_done = 0;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_generation++;
+    }
+    m_start_cond.notify_all();
+
+    run_part( 0 );
+
+    while ( m_done.load( std::memory_order_acquire ) != m_parts - 1 ) {
+        std::this_thread::yield();
+    }
+
+    // update requests in part order, the order does not matter for
+    // channels written by one process only
+    for ( unsigned i = 0; i < m_parts; i++ ) {
+        registry.merge_update_list( m_update_lists[i] );
+        m_update_lists[i] = (sc_prim_channel*)sc_prim_channel::list_end;
+    }
+    m_methods = 0;
+
+    return !m_failed;
+}
+
+void
+sc_method_pool::run_part( unsigned index )
+{
+    const std::vector<sc_method_handle>& methods = *m_methods;
+    std::size_t begin = methods.size() * index / m_parts;
+    std::size_t end = methods.size() * (index + 1) / m_parts;
+
+    sc_curr_proc_info proc_info;
+    sc_prim_channel* update_list = (sc_prim_channel*)sc_prim_channel::list_end;
+    sc_parallel_proc_info_p = &proc_info;
+    sc_parallel_update_list_p = &update_list;
+
+    for ( std::size_t i = begin; i != end && !m_failed; i++ ) {
+        sc_method_handle method_h = methods[i];
+        if ( !method_h->m_value_guards.empty() &&
+             !method_h->value_guards_changed() ) {
+            continue;
+        }
+        proc_info.process_handle = method_h;
+        proc_info.kind = method_h->proc_kind();
+
+        // same as sc_method_process::run_process(), the error is stored
+        // by the first failed thread only
+        bool restart = false;
+        do {
+            try {
+                method_h->semantics();
+                restart = false;
+            }
+            catch( sc_unwind_exception& ex ) {
+                ex.clear();
+                restart = ex.is_reset();
+            }
+            catch( ... ) {
+                sc_report* err_p = sc_handle_exception();
+                std::lock_guard<std::mutex> lock( m_mutex );
+                if ( !m_failed ) {
+                    method_h->simcontext()->set_error( err_p );
+                    m_failed = true;
+                } else {
+                    delete err_p;
+                }
+                restart = false;
+            }
+        } while( restart );
+    }
+
+    sc_parallel_proc_info_p = 0;
+    sc_parallel_update_list_p = 0;
+    m_update_lists[index] = update_list;
+}
+
+void
+sc_method_pool::worker_fn( unsigned index )
+{
+    unsigned generation = 0;
+    for (;;) {
+        for ( unsigned i = 0; i < SC_METHOD_POOL_SPIN &&
+              m_generation.load( std::memory_order_acquire ) == generation;
+              i++ ) {
+            std::this_thread::yield();
+        }
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            while ( !m_stop && m_generation == generation ) {
+                m_start_cond.wait( lock );
+            }
+            if ( m_stop ) return;
+            generation = m_generation;
+        }
+
+        run_part( index );
+        m_done.fetch_add( 1, std::memory_order_release );
+    }
+}
+
+} // namespace sc_core
+
+#endif // SC_ENABLE_PARALLEL_METHODS
+
+// Taf!
@@ -0,0 +1,107 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_method_pool.h -- Worker threads for parallel evaluation of race-free
+                      method processes.
+
+  Available if the library is built with SC_ENABLE_PARALLEL_METHODS.
+  Race-free methods runnable in a delta cycle are split into equal parts,
+  the first part is executed by the simulator thread, the others by the
+  workers. Each thread has its own process information and update request
+  list, the lists are merged into the primitive channel registry after all
+  the parts are done.
+
+  Internal header, included by the kernel only.
+
+ *****************************************************************************/
+
+#ifndef SC_METHOD_POOL_H
+#define SC_METHOD_POOL_H
+
+#include "sysc/kernel/sc_process.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sc_core {
+
+class sc_prim_channel;
+class sc_prim_channel_registry;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_method_pool
+//
+//  Worker threads executing race-free method processes in parallel.
+// ----------------------------------------------------------------------------
+
+class sc_method_pool
+{
+public:
+
+    // threads -- number of threads including the simulator thread
+    explicit sc_method_pool( unsigned threads );
+    ~sc_method_pool();
+
+    unsigned threads() const
+        { return m_parts; }
+
+    // execute methods and pass update requests to the registry,
+    // return false if a method failed
+    bool run( const std::vector<sc_method_handle>& methods,
+              sc_prim_channel_registry& registry );
+
+private:
+
+    // execute one part of the methods in current thread
+    void run_part( unsigned index );
+
+    void worker_fn( unsigned index );
+
+private:
+
+    unsigned                                 m_parts;
+    std::vector<std::thread>                 m_workers;
+    std::vector<sc_prim_channel*>            m_update_lists;
+
+    const std::vector<sc_method_handle>*     m_methods;
+    std::atomic<bool>                        m_failed;
+
+    std::mutex                               m_mutex;
+    std::condition_variable                  m_start_cond;
+    std::atomic<unsigned>                    m_generation; // run counter
+    std::atomic<unsigned>                    m_done;       // parts done
+    bool                                     m_stop;
+
+private:
+
+    // disabled
+    sc_method_pool( const sc_method_pool& );
+    sc_method_pool& operator = ( const sc_method_pool& );
+};
+
+} // namespace sc_core
+
+#endif // SC_METHOD_POOL_H
+
+// Taf!
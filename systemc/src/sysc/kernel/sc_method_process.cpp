@@ -29,6 +29,7 @@
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_sensitive.h"
 #include "sysc/kernel/sc_spawn_options.h"
 
 // DEBUGGING MACROS:
@@ -307,7 +308,9 @@ sc_method_process::sc_method_process( const char* name_p,
     sc_process_b(
         name_p ? name_p : sc_gen_unique_name("method_p"),
         false, free_host, method_p, host_p, opt_p),
-	m_cor(0), m_stack_size(0), m_monitor_q()
+	m_cor(0), m_stack_size(0), m_monitor_q(), m_value_guards(),
+	m_value_guards_reset(false), m_value_guards_valid(false),
+	m_static_trigger(false), m_race_free(false)
 {
 
     // CHECK IF THIS IS AN sc_module-BASED PROCESS AND SIMUALTION HAS STARTED:
@@ -376,6 +379,53 @@ sc_method_process::~sc_method_process()
     if( m_dynamic_proc != SPAWN_SIM ) {
         simcontext()->remove_process(this);
     }
+
+    for ( std::size_t i = 0; i < m_value_guards.size(); i++ )
+        delete m_value_guards[i];
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_method_process::add_value_guard"
+//
+// This method adds a value read by this object instance, the method takes
+// ownership of the guard. See value_guards_changed().
+//------------------------------------------------------------------------------
+void sc_method_process::add_value_guard( sc_value_guard* guard_p )
+{
+    m_value_guards.push_back( guard_p );
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_method_process::value_guards_changed"
+//
+// This method is called by the scheduler before this object instance with
+// value guards is executed. It stores the current guarded values and returns
+// false if the execution may be skipped. That is the case if the method was
+// triggered by its static sensitivity and all the guarded values and the
+// reset status are equal to those seen by the previous execution.
+//
+// Notes:
+//   (1) A method executed out of the scheduler loop, e.g. by an asynchronous
+//       reset, clears m_value_guards_valid, so its next run is not skipped.
+//------------------------------------------------------------------------------
+bool sc_method_process::value_guards_changed()
+{
+    bool in_reset = m_active_areset_n != 0 || m_active_reset_n != 0;
+    bool changed = !m_value_guards_valid || !m_static_trigger ||
+                   in_reset != m_value_guards_reset;
+
+    // All the guards are updated to store values for this execution
+    for ( std::size_t i = 0; i < m_value_guards.size(); i++ )
+    {
+        if ( m_value_guards[i]->update() ) changed = true;
+    }
+
+    m_value_guards_reset = in_reset;
+    m_value_guards_valid = true;
+    m_static_trigger = false;
+    return changed;
 }
 
 
@@ -800,6 +850,7 @@ bool sc_method_process::trigger_dynamic( sc_event* e )
     // suspended mark its state as ready to run. If its not suspended then push
     // it onto the runnable queue.
 
+    m_static_trigger = false;
     if ( (m_state & ps_bit_suspended) )
     {
 	m_state = m_state | ps_bit_ready_to_run;
@@ -85,6 +85,9 @@ class sc_process_table;
 class sc_process_handle;
 class sc_simcontext;
 class sc_runnable;
+class sc_value_guard;
+class sc_value_sensitive;
+class sc_method_pool;
 
 SC_API void next_trigger( sc_simcontext* );
 SC_API void next_trigger( const sc_event&, sc_simcontext* );
@@ -111,6 +114,8 @@ class sc_method_process : public sc_process_b {
     friend class sc_process_handle;
     friend class sc_simcontext;
     friend class sc_runnable;
+    friend class sc_value_sensitive;
+    friend class sc_method_pool;
 
     friend void next_trigger( sc_simcontext* );
     friend void next_trigger( const sc_event&,
@@ -137,6 +142,7 @@ class sc_method_process : public sc_process_b {
         { return "sc_method_process"; }
 
   protected:
+    void add_value_guard( sc_value_guard* );
     void check_for_throws();
     virtual void disable_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
@@ -167,11 +173,17 @@ class sc_method_process : public sc_process_b {
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     bool trigger_dynamic( sc_event* );
     inline void trigger_static();
+    bool value_guards_changed();
 
   protected:
     sc_cor*                          m_cor;        // Thread's coroutine.
     std::size_t                      m_stack_size; // Thread stack size.
     std::vector<sc_process_monitor*> m_monitor_q;  // Thread monitors.
+    std::vector<sc_value_guard*>     m_value_guards; // Values method reads.
+    bool                             m_value_guards_reset; // Reset at check.
+    bool                             m_value_guards_valid; // Values checked.
+    bool                             m_static_trigger; // Static trigger run.
+    bool                             m_race_free;  // Parallel run allowed.
 
   private:
     // may not be deleted manually (called from sc_process_b)
@@ -354,8 +366,10 @@ sc_method_process::trigger_static()
 
     // If we get here then the method is has satisfied its wait, if its 
     // suspended mark its state as ready to run. If its not suspended then 
-    // push it onto the runnable queue.
+    // push it onto the runnable queue. Method with value guards may skip
+    // this run, see value_guards_changed().
 
+    m_static_trigger = true;
     if ( m_state & ps_bit_suspended )
     {
         m_state = m_state | ps_bit_ready_to_run;
@@ -36,6 +36,7 @@
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_kernel_ids.h"
 #include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_module_registry.h"
 #include "sysc/kernel/sc_name_gen.h"
 #include "sysc/kernel/sc_object_manager.h"
@@ -182,6 +183,7 @@ sc_module::sc_module()
   sensitive(this),
   sensitive_pos(this),
   sensitive_neg(this),
+  value_sensitive(sensitive),
   m_end_module_called(false),
   m_port_vec(),
   m_port_index(0),
@@ -209,6 +211,7 @@ sc_module::sc_module( const sc_module_name& )
   sensitive(this),
   sensitive_pos(this),
   sensitive_neg(this),
+  value_sensitive(sensitive),
   m_end_module_called(false),
   m_port_vec(),
   m_port_index(0),
@@ -242,6 +245,7 @@ sc_module::sc_module( const char* nm )
   sensitive(this),
   sensitive_pos(this),
   sensitive_neg(this),
+  value_sensitive(sensitive),
   m_end_module_called(false),
   m_port_vec(),
   m_port_index(0),
@@ -257,6 +261,7 @@ sc_module::sc_module( const std::string& s )
   sensitive(this),
   sensitive_pos(this),
   sensitive_neg(this),
+  value_sensitive(sensitive),
   m_end_module_called(false),
   m_port_vec(),
   m_port_index(0),
@@ -341,6 +346,21 @@ sc_module::dont_initialize()
     last_proc.dont_initialize( true );
 }
 
+// to allow parallel evaluation of SC_METHODs
+
+void
+sc_module::race_free()
+{
+    sc_process_handle last_proc = sc_get_last_created_process_handle();
+    sc_method_handle method_h =
+        dynamic_cast<sc_method_handle>( (sc_process_b*)last_proc );
+    if( method_h ) {
+        method_h->m_race_free = true;
+    } else {
+        SC_REPORT_WARNING( SC_ID_RACE_FREE_NOT_METHOD_, last_proc.name() );
+    }
+}
+
 // set SC_THREAD synchronous reset sensitivity
 
 void
@@ -161,6 +161,11 @@ protected:
     // to prevent initialization for SC_METHODs and SC_THREADs
     void dont_initialize();
 
+    // to allow parallel evaluation of SC_METHOD, which reads channels and
+    // writes channels not written by other processes only, see
+    // SC_ENABLE_PARALLEL_METHODS
+    void race_free();
+
     // positional binding code - used by operator ()
 
     void positional_bind( sc_interface& );
@@ -299,6 +304,9 @@ protected:
     sc_sensitive_pos sensitive_pos;
     sc_sensitive_neg sensitive_neg;
 
+    // Value sensitivity of the current method process, see sc_sensitive.h
+    sc_value_sensitive value_sensitive;
+
     // Function to set the stack size of the current (c)thread process.
     void set_stack_size( std::size_t );
 
@@ -33,6 +33,7 @@
 #include <cctype>
 #include <cstddef>
 #include <cctype>
+#include <cstring>
 #include <algorithm> // pick up std::sort.
 
 #include "sysc/kernel/sc_object.h"
@@ -55,12 +56,86 @@ namespace sc_core {
 //  Manager of objects.
 // ----------------------------------------------------------------------------
 
+// size of name arena block, longer names get their own block
+static const std::size_t SC_NAME_ARENA_BLOCK = 0x10000;
+
+bool
+sc_object_manager::name_key::operator == (const name_key& other) const
+{
+    return m_len == other.m_len && std::memcmp(m_str, other.m_str, m_len) == 0;
+}
+
+// FNV-1a hash of the name
+std::size_t
+sc_object_manager::name_key_hash::operator () (const name_key& key) const
+{
+    std::size_t hash = static_cast<std::size_t>(14695981039346656037ULL);
+    for ( std::size_t i = 0; i < key.m_len; i++ ) {
+        hash ^= static_cast<unsigned char>(key.m_str[i]);
+        hash *= static_cast<std::size_t>(1099511628211ULL);
+    }
+    return hash;
+}
+
+// order of the object walk, it is the same as for names in std::map
+static bool
+object_walk_less( const sc_object_manager::walk_entry& a,
+                  const sc_object_manager::walk_entry& b )
+{
+    return std::strcmp(a.m_name, b.m_name) < 0;
+}
+
+// sort object walk by name with multikey quicksort, that compares names by
+// one character at the depth of their common prefix, so long hierarchical
+// prefixes are not compared again for each pair of names as with strcmp
+static void
+object_walk_sort( sc_object_manager::walk_entry* a, std::size_t n,
+                  std::size_t depth )
+{
+    while ( n > 16 ) {
+        unsigned char pivot =
+            static_cast<unsigned char>( a[n / 2].m_name[depth] );
+        std::size_t lt = 0, i = 0, gt = n;
+        while ( i < gt ) {
+            unsigned char c = static_cast<unsigned char>( a[i].m_name[depth] );
+            if ( c < pivot ) {
+                std::swap( a[lt++], a[i++] );
+            } else if ( c > pivot ) {
+                std::swap( a[i], a[--gt] );
+            } else {
+                ++i;
+            }
+        }
+        object_walk_sort( a, lt, depth );
+        object_walk_sort( a + gt, n - gt, depth );
+        // names are unique, only one can end here
+        if ( pivot == 0 ) return;
+        a += lt;
+        n = gt - lt;
+        ++depth;
+    }
+    // short range, all names have the same prefix of depth length
+    for ( std::size_t i = 1; i < n; ++i ) {
+        sc_object_manager::walk_entry entry = a[i];
+        std::size_t j = i;
+        for ( ; j != 0 && std::strcmp( entry.m_name + depth,
+                                       a[j - 1].m_name + depth ) < 0; --j ) {
+            a[j] = a[j - 1];
+        }
+        a[j] = entry;
+    }
+}
+
 sc_object_manager::sc_object_manager() :
-    m_event_it(),
     m_event_walk_ok(0),
     m_instance_table(),
+    m_name_arena(),
+    m_name_arena_next(0),
+    m_name_arena_free(0),
+    m_instance_list(),
     m_module_name_stack(0),
-    m_object_it(),
+    m_object_walk(),
+    m_object_walk_i(0),
     m_object_stack(),
     m_object_walk_ok()
 {
@@ -84,6 +159,62 @@ sc_object_manager::~sc_object_manager()
             obj_p->m_simc = 0;
         }
     }
+    m_instance_table.clear();
+
+    for ( std::size_t i = 0; i < m_name_arena.size(); i++ ) {
+        delete [] m_name_arena[i];
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::copy_to_arena"
+// | 
+// | This method copies the supplied name with terminating zero into the name
+// | arena. The copy lives as long as this object instance.
+// |
+// | Arguments:
+// |     name = name to be copied.
+// | Result is the address of the copy.
+// +----------------------------------------------------------------------------
+const char*
+sc_object_manager::copy_to_arena(const std::string& name)
+{
+    std::size_t size = name.size() + 1;
+    if ( size > m_name_arena_free ) {
+        std::size_t block_size = std::max(size, SC_NAME_ARENA_BLOCK);
+        m_name_arena.push_back( new char[block_size] );
+        m_name_arena_next = m_name_arena.back();
+        m_name_arena_free = block_size;
+    }
+    char* result_p = m_name_arena_next;
+    std::memcpy(result_p, name.c_str(), size);
+    m_name_arena_next += size;
+    m_name_arena_free -= size;
+    return result_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::find_or_insert"
+// | 
+// | This method returns the instance table entry with the supplied name,
+// | the entry is created if it does not exist. That is done with single
+// | lookup in the table.
+// |
+// | Arguments:
+// |     name = name of the entry.
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry&
+sc_object_manager::find_or_insert(const std::string& name)
+{
+    std::pair<instance_table_t::iterator, bool> result =
+        m_instance_table.insert( instance_table_t::value_type(
+            name_key(name.c_str(), name.size()), table_entry()) );
+    if ( result.second ) {
+        // same name, so the hash and position in the table are not changed
+        result.first->first.m_str = copy_to_arena(name);
+        m_instance_list.push_back( &(*result.first) );
+    }
+    return result.first->second;
 }
 
 // +----------------------------------------------------------------------------
@@ -99,59 +230,50 @@ sc_object_manager::~sc_object_manager()
 // +----------------------------------------------------------------------------
 std::string sc_object_manager::create_name(const char* leaf_name) 
 { 
-    bool        clash;                  // true if path name exists in obj table
     std::string leafname_string;        // string containing the leaf name.
-    std::string parentname_string;      // parent path name 
+    std::size_t parentname_len;         // parent path name length with dot.
     sc_object*  parent_p;               // parent for this instance or NULL.
     std::string result_orig_string;     // save for warning message.
     std::string result_string;          // name to return.
  
     // CONSTRUCT PATHNAME TO THE NAME TO BE RETURNED:
     // 
-    // If there is not a leaf name generate one. 
+    // The parent name is appended in place without copying it to a string
+    // first, most names do not clash, so it is the only string built.
 
     parent_p = sc_get_curr_simcontext()->active_object();
-    parentname_string = parent_p ? parent_p->name() : ""; 
-    leafname_string = leaf_name; 
+    parentname_len = 0;
     if (parent_p) {
-        result_string = parentname_string;
+        const char* parentname_p = parent_p->name();
+        parentname_len = std::strlen(parentname_p) + 1;
+        result_string.reserve(parentname_len + std::strlen(leaf_name));
+        result_string.assign(parentname_p, parentname_len - 1);
 	result_string += SC_HIERARCHY_CHAR;
-	result_string += leafname_string;
-    } else { 
-        result_string = leafname_string;
-    } 
-
-    // SAVE the original path name 
+    }
+    result_string += leaf_name;
 
-    result_orig_string = result_string;
+    if ( !name_exists(result_string) )
+    {
+        return result_string;
+    }
 
     // MAKE SURE THE ENTITY NAME IS UNIQUE:
     // 
     // If not use unique name generator to make it unique. 
 
-    clash = false; 
-    for (;;)
+    result_orig_string = result_string;
+    leafname_string = leaf_name;
+    do
     {
-	    if ( !name_exists(result_string) )
-	    {
-	        break;
-	    }
-        clash = true; 
         leafname_string = sc_gen_unique_name(leafname_string.c_str(), false); 
-	if (parent_p) {
-	    result_string = parentname_string;
-	    result_string += SC_HIERARCHY_CHAR;
-	    result_string += leafname_string;
-	} else { 
-	    result_string = leafname_string;
-	} 
-    } 
-    if (clash) { 
-	std::string message = result_orig_string;
-	message += ". Latter declaration will be renamed to ";
-	message += result_string;
-        SC_REPORT_WARNING( SC_ID_INSTANCE_EXISTS_, message.c_str());
-    } 
+        result_string.resize(parentname_len);
+        result_string += leafname_string;
+    } while ( name_exists(result_string) );
+
+    std::string message = result_orig_string;
+    message += ". Latter declaration will be renamed to ";
+    message += result_string;
+    SC_REPORT_WARNING( SC_ID_INSTANCE_EXISTS_, message.c_str());
 
     return result_string;
 }
@@ -169,7 +291,8 @@ std::string sc_object_manager::create_name(const char* leaf_name)
 bool
 sc_object_manager::name_exists(const std::string& name)
 {
-    instance_table_t::const_iterator it = m_instance_table.find(name);
+    instance_table_t::const_iterator it =
+        m_instance_table.find(name_key(name.c_str(), name.size()));
     return (it != m_instance_table.end()) &&
            (it->second.m_name_origin != SC_NAME_NONE);
 }
@@ -187,10 +310,11 @@ sc_object_manager::name_exists(const std::string& name)
 const char*
 sc_object_manager::get_name(const std::string& name)
 {
-    instance_table_t::iterator it = m_instance_table.find(name);
+    instance_table_t::iterator it =
+        m_instance_table.find(name_key(name.c_str(), name.size()));
     if (it != m_instance_table.end() &&
         it->second.m_name_origin != SC_NAME_NONE) {
-        return it->first.c_str();
+        return it->first.m_str;
     } else {
         return NULL;
     }
@@ -210,7 +334,7 @@ sc_event*
 sc_object_manager::find_event(const char* name)
 {
     instance_table_t::iterator it;
-    it = m_instance_table.find(name);
+    it = m_instance_table.find(name_key(name, std::strlen(name)));
     if(it != m_instance_table.end()
        && it->second.m_name_origin == SC_NAME_EVENT)
     {
@@ -234,7 +358,7 @@ sc_object*
 sc_object_manager::find_object(const char* name)
 {
     instance_table_t::iterator it;
-    it = m_instance_table.find(name);
+    it = m_instance_table.find(name_key(name, std::strlen(name)));
     if(it != m_instance_table.end()
        && it->second.m_name_origin == SC_NAME_OBJECT)
     {
@@ -259,12 +383,14 @@ sc_object_manager::first_object()
 
     m_object_walk_ok = true;
     result_p = NULL;
-    for ( m_object_it = m_instance_table.begin(); 
-          m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    update_object_walk();
+    for ( m_object_walk_i = 0; m_object_walk_i < m_object_walk.size();
+	  m_object_walk_i++ )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        const table_entry& entry =
+            m_object_walk[m_object_walk_i].m_entry_p->second;
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry.m_element_p);
         }
     }
     return result_p;
@@ -344,12 +470,12 @@ sc_object_manager::hierarchy_size()
 bool
 sc_object_manager::insert_external_name(const std::string& name)
 {
-    if(!name_exists(name)) {
-        m_instance_table[name].m_element_p = NULL;
-        m_instance_table[name].m_name_origin = SC_NAME_EXTERNAL;
+    table_entry& element = find_or_insert(name);
+    if(element.m_name_origin == SC_NAME_NONE) {
+        element.m_element_p = NULL;
+        element.m_name_origin = SC_NAME_EXTERNAL;
         return true;
     } else {
-        table_entry element = m_instance_table[name];
         std::stringstream msg;
         msg << name << " ("
             << ((element.m_name_origin == SC_NAME_OBJECT)
@@ -375,8 +501,9 @@ sc_object_manager::insert_external_name(const std::string& name)
 void
 sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(event_p);
-    m_instance_table[name].m_name_origin = SC_NAME_EVENT;
+    table_entry& element = find_or_insert(name);
+    element.m_element_p = static_cast<void*>(event_p);
+    element.m_name_origin = SC_NAME_EVENT;
 }
 
 // +----------------------------------------------------------------------------
@@ -392,8 +519,9 @@ sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 void
 sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(object_p);
-    m_instance_table[name].m_name_origin = SC_NAME_OBJECT;
+    table_entry& element = find_or_insert(name);
+    element.m_element_p = static_cast<void*>(object_p);
+    element.m_name_origin = SC_NAME_OBJECT;
 }
 
 // +----------------------------------------------------------------------------
@@ -408,19 +536,56 @@ sc_object_manager::next_object()
 
     sc_assert( m_object_walk_ok );
 
-    if ( m_object_it == m_instance_table.end() ) return NULL;
-    m_object_it++;
+    if ( m_object_walk_i >= m_object_walk.size() ) return NULL;
 
-    for ( result_p = NULL; m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    // Names were inserted during the walk, continue from current name
+    if ( m_object_walk.size() != m_instance_list.size() )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        walk_entry curr = m_object_walk[m_object_walk_i];
+        update_object_walk();
+        m_object_walk_i = std::lower_bound( m_object_walk.begin(),
+            m_object_walk.end(), curr, object_walk_less ) -
+            m_object_walk.begin();
+    }
+    m_object_walk_i++;
+
+    for ( result_p = NULL; m_object_walk_i < m_object_walk.size();
+	  m_object_walk_i++ )
+    {
+        const table_entry& entry =
+            m_object_walk[m_object_walk_i].m_entry_p->second;
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry.m_element_p);
         }
     }
     return result_p;
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::update_object_walk"
+// | 
+// | This method adds the instance table entries inserted since the last
+// | update to the object walk, which is kept sorted by name. Entries are
+// | never removed from the table, so the walk remains valid if objects are
+// | deleted, and it is sorted once for all walks.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::update_object_walk()
+{
+    std::size_t walk_n = m_object_walk.size();
+    if ( walk_n == m_instance_list.size() ) return;
+
+    m_object_walk.reserve( m_instance_list.size() );
+    for ( std::size_t i = walk_n; i != m_instance_list.size(); ++i ) {
+        walk_entry entry = { m_instance_list[i]->first.m_str,
+                             m_instance_list[i] };
+        m_object_walk.push_back( entry );
+    }
+    object_walk_sort( &m_object_walk[walk_n], m_object_walk.size() - walk_n, 0 );
+    std::inplace_merge( m_object_walk.begin(), m_object_walk.begin() + walk_n,
+                        m_object_walk.end(), object_walk_less );
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::pop_module_name"
 // | 
@@ -478,7 +643,7 @@ void
 sc_object_manager::remove_event(const std::string& name)
 {
     instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
+    it = m_instance_table.find(name_key(name.c_str(), name.size()));
     if(it != m_instance_table.end()
        && it->second.m_name_origin == SC_NAME_EVENT)
     {
@@ -500,7 +665,7 @@ void
 sc_object_manager::remove_object(const std::string& name)
 {
     instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
+    it = m_instance_table.find(name_key(name.c_str(), name.size()));
     if(it != m_instance_table.end()
        && it->second.m_name_origin == SC_NAME_OBJECT)
     {
@@ -522,7 +687,7 @@ bool
 sc_object_manager::remove_external_name(const std::string& name)
 {
     instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
+    it = m_instance_table.find(name_key(name.c_str(), name.size()));
     if(it != m_instance_table.end()
        && it->second.m_name_origin == SC_NAME_EXTERNAL)
     {
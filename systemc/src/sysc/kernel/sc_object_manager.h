@@ -30,7 +30,9 @@
 #ifndef SC_OBJECT_MANAGER_H
 #define SC_OBJECT_MANAGER_H
 
-#include <map>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace sc_core {
@@ -69,10 +71,38 @@ protected:
         sc_name_origin m_name_origin;
     };
 
+    // Name in the instance table. Names are never removed from the table,
+    // so they are stored in the name arena and the key points there. Lookup
+    // keys point to the looked up string instead.
+    struct name_key
+    {
+        name_key(const char* str, std::size_t len) : m_str(str), m_len(len) {}
+
+        mutable const char* m_str; // redirected to arena copy on insert.
+        std::size_t         m_len;
+
+        bool operator == (const name_key& other) const;
+    };
+
+    struct name_key_hash
+    {
+        std::size_t operator () (const name_key& key) const;
+    };
+
 public:
-    typedef std::map<std::string,table_entry> instance_table_t;
+    typedef std::unordered_map<name_key,table_entry,name_key_hash>
+                                              instance_table_t;
     typedef std::vector<sc_object*>           object_vector_t;
 
+    // Object walk element, name is kept here to sort without access to
+    // the table nodes.
+    struct walk_entry
+    {
+        const char*                         m_name;
+        const instance_table_t::value_type* m_entry_p;
+    };
+    typedef std::vector<walk_entry> object_walk_t;
+
     sc_object_manager();
     ~sc_object_manager();
 
@@ -96,6 +126,10 @@ public:
 
 
 private:
+    table_entry& find_or_insert(const std::string& name);
+    const char* copy_to_arena(const std::string& name);
+    void update_object_walk();
+
     std::string create_name( const char* leaf_name );
     void insert_event(const std::string& name, sc_event* obj);
     void insert_object(const std::string& name, sc_object* obj);
@@ -106,11 +140,17 @@ private:
 
 private:
 
-    instance_table_t::iterator m_event_it;          // event instance iterator.
+    typedef std::vector<const instance_table_t::value_type*> walk_vector_t;
+
     bool                       m_event_walk_ok;     // true if can walk events.
     instance_table_t           m_instance_table;    // table of instances.
+    std::vector<char*>         m_name_arena;        // blocks with names.
+    char*                      m_name_arena_next;   // free in last block.
+    std::size_t                m_name_arena_free;   // free bytes there.
+    walk_vector_t              m_instance_list;     // in insertion order.
     sc_module_name*            m_module_name_stack; // sc_module_name stack.
-    instance_table_t::iterator m_object_it;         // object instance iterator.
+    object_walk_t              m_object_walk;       // names sorted for walk.
+    std::size_t                m_object_walk_i;     // current walk index.
     object_vector_t            m_object_stack;      // sc_object stack.
     bool                       m_object_walk_ok;    // true if can walk objects.
 };
@@ -900,6 +900,35 @@ void sc_sensitive_neg::reset()
     m_mode = SC_NONE_;
 }
 
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_value_sensitive
+//
+//  Static sensitivity to values for method processes.
+// ----------------------------------------------------------------------------
+
+// constructor
+
+sc_value_sensitive::sc_value_sensitive( sc_sensitive& sensitive_ )
+: m_sensitive( sensitive_ )
+{}
+
+
+void
+sc_value_sensitive::add_guard( sc_value_guard* guard_ )
+{
+    if( m_sensitive.m_mode == sc_sensitive::SC_METHOD_ ) {
+        as_method_handle( m_sensitive.m_handle )->add_value_guard( guard_ );
+    } else {
+        // threads are resumed by events, the value is not checked
+        delete guard_;
+        if( m_sensitive.m_mode == sc_sensitive::SC_THREAD_ ) {
+            SC_REPORT_WARNING( SC_ID_MAKE_SENSITIVE_,
+                "value sensitivity is ignored for thread process" );
+        }
+    }
+}
+
 } // namespace sc_core
 
 /*****************************************************************************
@@ -34,6 +34,9 @@
 
 #include "sysc/kernel/sc_process.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace sc_dt
 {
     class sc_logic;
@@ -61,6 +64,7 @@ template <class T> class sc_signal_in_if;
 class SC_API sc_sensitive
 {
     friend class sc_module;
+    friend class sc_value_sensitive;
 
 public:
 
@@ -261,6 +265,108 @@ private:
     sc_sensitive_neg& operator = ( const sc_sensitive_neg& );
 };
 
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_value_guard
+//
+//  Value read by a method process, compared with the value read by the
+//  previous execution of the method.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_value_guard
+{
+public:
+
+    virtual ~sc_value_guard() {}
+
+    // store the current value, return true if it differs from the stored
+    // value or no value is stored yet
+    virtual bool update() = 0;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_value_guard_t<C>
+//
+//  Value guard for channel or port with read() method.
+// ----------------------------------------------------------------------------
+
+template< class C >
+class sc_value_guard_t
+  : public sc_value_guard
+{
+public:
+
+    typedef typename std::decay<
+        decltype( std::declval<const C&>().read() ) >::type value_type;
+
+    explicit sc_value_guard_t( const C& object_ )
+      : m_object( object_ ), m_value(), m_valid( false )
+    {}
+
+    virtual bool update()
+    {
+        const value_type& value = m_object.read();
+        if( m_valid && value == m_value ) {
+            return false;
+        }
+        m_value = value;
+        m_valid = true;
+        return true;
+    }
+
+private:
+
+    const C&   m_object;
+    value_type m_value;
+    bool       m_valid;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_value_sensitive
+//
+//  Static sensitivity to values for method processes. An object added to
+//  the value sensitivity is added to the static sensitivity as well. If a
+//  method has value sensitivity, its execution on a static trigger is
+//  skipped when all the values are equal to those read by the previous
+//  execution. Such a method should read no other channels or variables.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_value_sensitive
+{
+    friend class sc_module;
+
+private:
+
+    // constructor
+    explicit sc_value_sensitive( sc_sensitive& );
+
+public:
+
+    template< class C >
+    sc_value_sensitive& operator << ( C& object_ )
+    {
+        m_sensitive << object_;
+        add_guard( new sc_value_guard_t<C>( object_ ) );
+        return *this;
+    }
+
+private:
+
+    // pass guard to the current method process
+    void add_guard( sc_value_guard* );
+
+    sc_sensitive& m_sensitive;
+
+private:
+
+    // disabled
+    sc_value_sensitive();
+    sc_value_sensitive( const sc_value_sensitive& );
+    sc_value_sensitive& operator = ( const sc_value_sensitive& );
+};
+
 } // namespace sc_core 
 
 #endif
@@ -42,7 +42,10 @@
 #include "sysc/kernel/sc_object_manager.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_method_pool.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/kernel/sc_thread_process.h"
+#include "sysc/kernel/sc_timed_event_queue.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_reset.h"
 #include "sysc/kernel/sc_ver.h"
@@ -200,6 +203,12 @@ sc_simcontext::remove_process( sc_thread_handle handle )
     return m_process_table->remove(handle);
 }
 
+void
+sc_simcontext::add_timed_event( sc_event_timed* et )
+{
+    m_timed_events->insert( et );
+}
+
 SC_API int
 sc_notify_time_compare( const void* p1, const void* p2 )
 {
@@ -334,11 +343,26 @@ sc_simcontext::init()
     else
         m_write_check = SC_SIGNAL_WRITE_CHECK_DEFAULT_;
 
+    // Thread stack sizes from previous run and file to write stack usage
+    const char* stack_sizes = std::getenv("SC_STACK_SIZES");
+    const char* stack_profile = std::getenv("SC_STACK_PROFILE");
+    m_stack_profile = ( stack_sizes != NULL || stack_profile != NULL ) ?
+        new sc_stack_profile( stack_sizes, stack_profile ) : 0;
+
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    // Number of threads to evaluate race-free methods, 1 means serial
+    const char* parallel_threads = std::getenv("SC_PARALLEL_METHOD_THREADS");
+    m_parallel_threads = (parallel_threads != NULL) ?
+        static_cast<unsigned>( std::atoi( parallel_threads ) ) :
+        std::thread::hardware_concurrency();
+    m_method_pool = 0;
+#endif // SC_ENABLE_PARALLEL_METHODS
+
     // FINISH INITIALIZATIONS:
 
     reset_curr_proc();
     m_next_proc_id = -1;
-    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
+    m_timed_events = new sc_timed_event_queue;
     m_something_to_trace = false;
     m_runnable = new sc_runnable;
     m_collectable = new sc_process_list;
@@ -370,11 +394,19 @@ sc_simcontext::clean()
     // remove remaining zombie processes
     do_collect_processes();
 
+    write_stack_profile();
+    delete m_stack_profile;
+    m_stack_profile = 0;
+
     delete m_method_invoker_p;
     delete m_error;
     delete m_cor_pkg;
     delete m_time_params;
     delete m_collectable;
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    delete m_method_pool;
+    m_parallel_methods.clear();
+#endif // SC_ENABLE_PARALLEL_METHODS
     delete m_runnable;
     delete m_timed_events;
     delete m_process_table;
@@ -413,7 +445,7 @@ sc_simcontext::sc_simcontext() :
     m_execution_phase(phase_initialize), m_error(0),
     m_in_simulator_control(false), m_end_of_simulation_called(false),
     m_simulation_status(SC_ELABORATION), m_start_of_simulation_called(false),
-    m_cor_pkg(0), m_cor(0), m_reset_finder_q(0)
+    m_cor_pkg(0), m_cor(0), m_reset_finder_q(0), m_stack_profile(0)
 {
     init();
 }
@@ -483,12 +515,33 @@ sc_simcontext::crunch( bool once )
 	    sc_method_handle method_h = pop_runnable_method();
 	    while( method_h != 0 ) {
 		empty_eval_phase = false;
-		if ( !method_h->run_process() )
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+		// race-free methods are executed after others in parallel
+		if ( method_h->m_race_free && m_parallel_threads > 1 &&
+		     !method_h->m_reset_event_p )
 		{
-		    goto out;
+		    m_parallel_methods.push_back( method_h );
+		    method_h = pop_runnable_method();
+		    continue;
+		}
+#endif // SC_ENABLE_PARALLEL_METHODS
+		// skip method if values it reads are not changed
+		if ( method_h->m_value_guards.empty() ||
+		     method_h->value_guards_changed() )
+		{
+		    if ( !method_h->run_process() )
+		    {
+			goto out;
+		    }
 		}
 		method_h = pop_runnable_method();
 	    }
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+	    if ( !m_parallel_methods.empty() && !run_parallel_methods() )
+	    {
+		goto out;
+	    }
+#endif // SC_ENABLE_PARALLEL_METHODS
 
 	    // execute (c)thread processes
 
@@ -1055,6 +1108,26 @@ sc_simcontext::end()
     m_module_registry->simulation_done();
     SC_DO_PHASE_CALLBACK_(simulation_done);
     m_end_of_simulation_called = true;
+    write_stack_profile();
+}
+
+// Record stack usage of existing threads and write the stack profile file,
+// that is done at end of simulation and after sc_main() returned
+void
+sc_simcontext::write_stack_profile()
+{
+    if ( !m_stack_profile || !m_stack_profile->measuring() ) {
+        return;
+    }
+    for ( sc_thread_handle thread_p = m_process_table->thread_q_head();
+          thread_p; thread_p = thread_p->next_exist() )
+    {
+        if ( thread_p->m_cor_p ) {
+            m_stack_profile->record( thread_p->name(),
+                                     thread_p->m_cor_p->stack_usage() );
+        }
+    }
+    m_stack_profile->write();
 }
 
 void
@@ -1414,6 +1487,50 @@ sc_simcontext::remove_delta_event( sc_event* e )
     e->m_delta_event_index = -1;
 }
 
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+thread_local sc_curr_proc_info* sc_parallel_proc_info_p = 0;
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::run_parallel_methods"
+// |
+// | This method executes the race-free methods collected in the current
+// | evaluation phase. A small number of methods is executed serially, as
+// | dispatching them to the worker threads costs more than their execution.
+// |
+// | Result is false if an unfielded exception occurred, true if not.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::run_parallel_methods()
+{
+    static const std::size_t SC_PARALLEL_MIN_METHODS = 16;
+
+    bool result = true;
+    if ( m_parallel_methods.size() < SC_PARALLEL_MIN_METHODS )
+    {
+	for ( std::size_t i = 0; result && i < m_parallel_methods.size(); i++ )
+	{
+	    sc_method_handle method_h = m_parallel_methods[i];
+	    set_curr_proc( (sc_process_b*)method_h );
+	    if ( method_h->m_value_guards.empty() ||
+	         method_h->value_guards_changed() )
+	    {
+		result = method_h->run_process();
+	    }
+	}
+	reset_curr_proc();
+    }
+    else
+    {
+	if ( !m_method_pool )
+	    m_method_pool = new sc_method_pool( m_parallel_threads );
+	result = m_method_pool->run( m_parallel_methods,
+	                             *m_prim_channel_registry );
+    }
+    m_parallel_methods.clear();
+    return result;
+}
+#endif // SC_ENABLE_PARALLEL_METHODS
+
 // +----------------------------------------------------------------------------
 // |"sc_simcontext::preempt_with"
 // |
@@ -1445,6 +1562,11 @@ sc_simcontext::preempt_with( sc_method_handle method_h )
     if ( method_h->next_runnable() != NULL )
 	remove_runnable_method( method_h );
 
+    // Values read by the method are not stored for this execution, so its
+    // next static trigger is not skipped.
+
+    method_h->m_value_guards_valid = false;
+
     // CALLER IS THE METHOD TO BE RUN:
     //
     // Should never get here, ignore it unless we are debugging.
@@ -69,7 +69,10 @@ class sc_process_host;
 class sc_method_process;
 class sc_cthread_process;
 class sc_thread_process;
+class sc_timed_event_queue;
 class sc_reset_finder;
+class sc_method_pool;
+class sc_stack_profile;
 
 
 template< typename > class sc_plist;
@@ -210,6 +213,9 @@ public:
     void hierarchy_push( sc_module* );
     sc_module* hierarchy_pop();
     sc_module* hierarchy_curr() const;
+    // walk of all objects in name order, names added since the previous
+    // walk are sorted by first_object(), so it takes longer after many
+    // objects are created
     sc_object* first_object();
     sc_object* next_object();
     sc_object* find_object( const char* name );
@@ -283,6 +289,10 @@ public:
         { return m_cor_pkg; }
     sc_cor* next_cor();
 
+    sc_stack_profile* stack_profile() const
+        { return m_stack_profile; }
+    void write_stack_profile();
+
     void add_reset_finder( sc_reset_finder* );
 
     const ::std::vector<sc_object*>& get_child_objects() const;
@@ -338,6 +348,10 @@ private:
     sc_method_handle remove_process( sc_method_handle );
     sc_thread_handle remove_process( sc_thread_handle );
 
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    bool run_parallel_methods();
+#endif // SC_ENABLE_PARALLEL_METHODS
+
 private:
 
     enum execution_phases {
@@ -368,7 +382,7 @@ private:
     std::vector<sc_object*>     m_child_objects;
 
     std::vector<sc_event*>      m_delta_events;
-    sc_ppq<sc_event_timed*>*    m_timed_events;
+    sc_timed_event_queue*       m_timed_events;
 
     std::vector<sc_trace_file*> m_trace_files;
     bool                        m_something_to_trace;
@@ -400,6 +414,14 @@ private:
 
     sc_reset_finder*            m_reset_finder_q; // Q of reset finders to reconcile.
 
+    sc_stack_profile*           m_stack_profile; // thread stack sizes/usage.
+
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    unsigned                      m_parallel_threads; // threads to evaluate.
+    sc_method_pool*               m_method_pool;      // created on demand.
+    std::vector<sc_method_handle> m_parallel_methods; // race-free runnable.
+#endif // SC_ENABLE_PARALLEL_METHODS
+
 private:
 
     // disabled
@@ -500,10 +522,20 @@ sc_simcontext::get_prim_channel_registry()
 }
 
 
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+// process information of parallel evaluation worker thread, null otherwise
+extern SC_API thread_local sc_curr_proc_info* sc_parallel_proc_info_p;
+#endif // SC_ENABLE_PARALLEL_METHODS
+
 inline
 sc_curr_proc_handle
 sc_simcontext::get_curr_proc_info()
 {
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    if( sc_parallel_proc_info_p ) {
+        return sc_parallel_proc_info_p;
+    }
+#endif // SC_ENABLE_PARALLEL_METHODS
     return &m_curr_proc_info;
 }
 
@@ -601,18 +633,17 @@ sc_simcontext::add_delta_event( sc_event* e )
     return static_cast<int>( m_delta_events.size() - 1 );
 }
 
-inline
-void
-sc_simcontext::add_timed_event( sc_event_timed* et )
-{
-    m_timed_events->insert( et );
-}
-
 // ----------------------------------------------------------------------------
 
 inline sc_process_b*
 sc_simcontext::get_current_writer() const
 {
+#if defined( SC_ENABLE_PARALLEL_METHODS )
+    if( sc_parallel_proc_info_p ) {
+        return (m_write_check != SC_SIGNAL_WRITE_CHECK_DISABLE_) ?
+               sc_parallel_proc_info_p->process_handle : 0;
+    }
+#endif // SC_ENABLE_PARALLEL_METHODS
     return m_current_writer;
 }
 
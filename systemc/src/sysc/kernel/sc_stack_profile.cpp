@@ -0,0 +1,110 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  sc_stack_profile.cpp -- Thread stack usage profile.
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_stack_profile.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/utils/sc_report.h"
+
+#include <fstream>
+
+namespace sc_core {
+
+// margin added to measured high-water mark: half of it plus this value
+static const std::size_t SC_STACK_PROFILE_MARGIN = 0x4000;
+
+sc_stack_profile::sc_stack_profile( const char* sizes_file,
+                                    const char* profile_file )
+  : m_profile_file( profile_file ? profile_file : "" )
+  , m_sizes()
+  , m_usage()
+{
+    if ( sizes_file && *sizes_file ) {
+        load( sizes_file );
+    }
+}
+
+std::size_t
+sc_stack_profile::stack_size( const char* name, std::size_t size ) const
+{
+    std::map<std::string, std::size_t>::const_iterator i = m_sizes.find( name );
+    if ( i == m_sizes.end() ) {
+        return size;
+    }
+    return i->second + i->second / 2 + SC_STACK_PROFILE_MARGIN;
+}
+
+void
+sc_stack_profile::record( const char* name, std::size_t used )
+{
+    // not measured by coroutine package
+    if ( used == 0 ) {
+        return;
+    }
+    std::size_t& usage = m_usage[name];
+    if ( usage < used ) {
+        usage = used;
+    }
+}
+
+void
+sc_stack_profile::load( const char* sizes_file )
+{
+    std::ifstream ifs( sizes_file );
+    if ( !ifs ) {
+        SC_REPORT_WARNING( SC_ID_STACK_PROFILE_FILE_, sizes_file );
+        return;
+    }
+    std::string name;
+    std::size_t size;
+    while ( ifs >> name >> size ) {
+        if ( size != 0 ) {
+            m_sizes[name] = size;
+        }
+    }
+}
+
+void
+sc_stack_profile::write() const
+{
+    if ( m_usage.empty() ) {
+        SC_REPORT_WARNING( SC_ID_STACK_PROFILE_UNSUPPORTED_,
+                           m_profile_file.c_str() );
+        return;
+    }
+    std::ofstream ofs( m_profile_file.c_str() );
+    if ( !ofs ) {
+        SC_REPORT_WARNING( SC_ID_STACK_PROFILE_FILE_, m_profile_file.c_str() );
+        return;
+    }
+    std::map<std::string, std::size_t>::const_iterator i;
+    for ( i = m_usage.begin(); i != m_usage.end(); ++i ) {
+        ofs << i->first << " " << i->second << "\n";
+    }
+}
+
+} // namespace sc_core
+
+// Taf!
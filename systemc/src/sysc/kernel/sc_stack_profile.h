@@ -0,0 +1,100 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  sc_stack_profile.h -- Thread stack usage profile.
+
+  If SC_STACK_PROFILE=<file> is set, the high-water mark of each thread stack
+  is written to the file at the end of simulation, one "<process name>
+  <bytes>" line per thread. Stacks are zero filled when created, the used
+  part is measured by the first non-zero byte from the stack limit.
+  If SC_STACK_SIZES=<file> is set, such a file is loaded and threads listed
+  there get stack of measured size plus margin instead of the default one.
+
+  Measurement is supported by QuickThreads coroutine package only, with
+  other packages nothing is recorded and the profile file is not written.
+  Zero sizes in the sizes file are ignored.
+
+  Internal header, included by the kernel only.
+
+ *****************************************************************************/
+
+#ifndef SC_STACK_PROFILE_H
+#define SC_STACK_PROFILE_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_stack_profile
+//
+//  Stack sizes loaded from previous run and high-water marks of this run.
+// ----------------------------------------------------------------------------
+
+class sc_stack_profile
+{
+public:
+
+    // sizes_file   -- file to load stack sizes from, or 0
+    // profile_file -- file to write high-water marks to, or 0
+    sc_stack_profile( const char* sizes_file, const char* profile_file );
+
+    ~sc_stack_profile() {}
+
+    // stack usage is measured in this run
+    bool measuring() const
+        { return !m_profile_file.empty(); }
+
+    // stack size for the thread, given size if thread is not in sizes file
+    std::size_t stack_size( const char* name, std::size_t size ) const;
+
+    // record stack usage of the thread, maximum is kept for the same name,
+    // zero usage means not measured and is skipped
+    void record( const char* name, std::size_t used );
+
+    // write recorded stack usage to the profile file
+    void write() const;
+
+private:
+
+    void load( const char* sizes_file );
+
+private:
+
+    std::string                        m_profile_file;
+    std::map<std::string, std::size_t> m_sizes;  // loaded high-water marks
+    std::map<std::string, std::size_t> m_usage;  // high-water marks measured
+
+private:
+
+    // disabled
+    sc_stack_profile( const sc_stack_profile& );
+    sc_stack_profile& operator = ( const sc_stack_profile& );
+};
+
+} // namespace sc_core
+
+#endif // SC_STACK_PROFILE_H
+
+// Taf!
@@ -32,6 +32,7 @@
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/utils/sc_machine.h"
 
 // DEBUGGING MACROS:
@@ -330,6 +331,12 @@ void sc_thread_process::kill_process(sc_descendant_inclusion_info descendants )
 //------------------------------------------------------------------------------
 void sc_thread_process::prepare_for_simulation()
 {
+    // stack size measured in previous run
+    sc_stack_profile* profile = simcontext()->stack_profile();
+    if ( profile ) {
+        m_stack_size = profile->stack_size( name(), m_stack_size );
+    }
+
     m_cor_p = simcontext()->cor_pkg()->create( m_stack_size,
                          sc_thread_cor_fn, this );
     m_cor_p->stack_protect( true );
@@ -475,6 +482,10 @@ sc_thread_process::~sc_thread_process()
     // DESTROY THE COROUTINE FOR THIS THREAD:
 
     if( m_cor_p != 0 ) {
+        sc_stack_profile* profile = simcontext()->stack_profile();
+        if ( profile && profile->measuring() ) {
+            profile->record( name(), m_cor_p->stack_usage() );
+        }
         m_cor_p->stack_protect( false );
         delete m_cor_p;
         m_cor_p = 0;
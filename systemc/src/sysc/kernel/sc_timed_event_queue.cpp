@@ -0,0 +1,266 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_event_queue.cpp -- Queue of timed event notifications.
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_timed_event_queue.h"
+#include "sysc/utils/sc_report.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace sc_core {
+
+#if defined( SC_ENABLE_CALENDAR_QUEUE )
+
+// ----------------------------------------------------------------------------
+//  Calendar queue implementation
+// ----------------------------------------------------------------------------
+
+static const size_t SC_CALENDAR_CHUNK_SIZE = 64;   // buckets per allocation
+static const size_t SC_CALENDAR_TABLE_SIZE = 64;   // initial hash table size
+
+sc_timed_event_queue::sc_timed_event_queue()
+  : m_heap()
+  , m_table( SC_CALENDAR_TABLE_SIZE, static_cast<bucket*>(0) )
+  , m_table_num( 0 )
+  , m_last( 0 )
+  , m_free( 0 )
+  , m_chunks()
+  , m_size( 0 )
+{
+    m_heap.reserve( SC_CALENDAR_CHUNK_SIZE );
+}
+
+sc_timed_event_queue::~sc_timed_event_queue()
+{
+    // notifications are not owned by the queue, same as for sc_ppq
+    for( size_t i = 0; i != m_chunks.size(); ++i ) {
+        std::free( m_chunks[i] );
+    }
+}
+
+void
+sc_timed_event_queue::insert( sc_event_timed* et )
+{
+    time_type t = et->m_notify_time.value();
+
+    // clocked processes notify many events with the same time in a row
+    bucket* b = m_last;
+    if( !b || b->time != t ) {
+        b = find_bucket( t );
+        if( !b ) b = add_bucket( t );
+        m_last = b;
+    }
+
+    et->m_next = 0;
+    if( b->tail ) {
+        b->tail->m_next = et;
+    } else {
+        b->head = et;
+    }
+    b->tail = et;
+    m_size++;
+}
+
+sc_event_timed*
+sc_timed_event_queue::top() const
+{
+    sc_assert( m_size != 0 );
+    return m_heap.front()->head;
+}
+
+sc_event_timed*
+sc_timed_event_queue::extract_top()
+{
+    sc_assert( m_size != 0 );
+    bucket* b = m_heap.front();
+    sc_event_timed* et = b->head;
+
+    b->head = et->m_next;
+    et->m_next = 0;
+    if( !b->head ) {
+        std::pop_heap( m_heap.begin(), m_heap.end(), later );
+        m_heap.pop_back();
+        remove_bucket( b );
+    }
+    m_size--;
+    return et;
+}
+
+int
+sc_timed_event_queue::size() const
+{
+    return m_size;
+}
+
+sc_timed_event_queue::bucket*
+sc_timed_event_queue::find_bucket( time_type t ) const
+{
+    size_t mask = m_table.size() - 1;
+    for( size_t i = hash_index( t ); m_table[i]; i = (i + 1) & mask ) {
+        if( m_table[i]->time == t ) return m_table[i];
+    }
+    return 0;
+}
+
+sc_timed_event_queue::bucket*
+sc_timed_event_queue::add_bucket( time_type t )
+{
+    if( !m_free ) {
+        bucket* chunk = static_cast<bucket*>(
+            std::malloc( SC_CALENDAR_CHUNK_SIZE * sizeof(bucket) ) );
+        if( !chunk ) {
+            SC_REPORT_FATAL( SC_ID_INTERNAL_ERROR_,
+                             "out of memory for timed event queue" );
+        }
+        m_chunks.push_back( chunk );
+        for( size_t i = 0; i != SC_CALENDAR_CHUNK_SIZE; ++i ) {
+            chunk[i].next_free = m_free;
+            m_free = &chunk[i];
+        }
+    }
+    bucket* b = m_free;
+    m_free = b->next_free;
+
+    b->time = t;
+    b->head = 0;
+    b->tail = 0;
+    b->next_free = 0;
+
+    hash_insert( b );
+    m_heap.push_back( b );
+    std::push_heap( m_heap.begin(), m_heap.end(), later );
+    return b;
+}
+
+void
+sc_timed_event_queue::remove_bucket( bucket* b )
+{
+    hash_remove( b );
+    if( m_last == b ) m_last = 0;
+    b->tail = 0;
+    b->next_free = m_free;
+    m_free = b;
+}
+
+size_t
+sc_timed_event_queue::hash_index( time_type t ) const
+{
+    // Fibonacci hashing, notify times are often multiples of clock period
+    return static_cast<size_t>( (t * 0x9E3779B97F4A7C15ULL) >> 32 ) &
+           (m_table.size() - 1);
+}
+
+void
+sc_timed_event_queue::hash_insert( bucket* b )
+{
+    if( 2 * (m_table_num + 1) > m_table.size() ) hash_grow();
+
+    size_t mask = m_table.size() - 1;
+    size_t i = hash_index( b->time );
+    while( m_table[i] ) i = (i + 1) & mask;
+    m_table[i] = b;
+    m_table_num++;
+}
+
+void
+sc_timed_event_queue::hash_remove( bucket* b )
+{
+    size_t mask = m_table.size() - 1;
+    size_t i = hash_index( b->time );
+    while( m_table[i] != b ) i = (i + 1) & mask;
+    m_table[i] = 0;
+    m_table_num--;
+
+    // shift following entries of the probe sequence back to the free slot
+    for( size_t j = (i + 1) & mask; m_table[j]; j = (j + 1) & mask ) {
+        size_t k = hash_index( m_table[j]->time );
+        // entry stays if its home slot is cyclically in (i, j]
+        bool stays = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+        if( !stays ) {
+            m_table[i] = m_table[j];
+            m_table[j] = 0;
+            i = j;
+        }
+    }
+}
+
+void
+sc_timed_event_queue::hash_grow()
+{
+    std::vector<bucket*> old_table( 2 * m_table.size(),
+                                    static_cast<bucket*>(0) );
+    old_table.swap( m_table );
+
+    size_t mask = m_table.size() - 1;
+    for( size_t j = 0; j != old_table.size(); ++j ) {
+        if( !old_table[j] ) continue;
+        size_t i = hash_index( old_table[j]->time );
+        while( m_table[i] ) i = (i + 1) & mask;
+        m_table[i] = old_table[j];
+    }
+}
+
+#else
+
+// ----------------------------------------------------------------------------
+//  Binary heap implementation
+// ----------------------------------------------------------------------------
+
+sc_timed_event_queue::sc_timed_event_queue()
+  : m_ppq( 128, sc_notify_time_compare )
+{}
+
+sc_timed_event_queue::~sc_timed_event_queue()
+{}
+
+void
+sc_timed_event_queue::insert( sc_event_timed* et )
+{
+    m_ppq.insert( et );
+}
+
+sc_event_timed*
+sc_timed_event_queue::top() const
+{
+    return m_ppq.top();
+}
+
+sc_event_timed*
+sc_timed_event_queue::extract_top()
+{
+    return m_ppq.extract_top();
+}
+
+int
+sc_timed_event_queue::size() const
+{
+    return m_ppq.size();
+}
+
+#endif // SC_ENABLE_CALENDAR_QUEUE
+
+} // namespace sc_core
+
+// Taf!
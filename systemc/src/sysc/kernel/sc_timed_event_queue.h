@@ -0,0 +1,125 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_event_queue.h -- Queue of timed event notifications.
+
+  The implementation is selected at library build time:
+    - default: binary heap of notifications (sc_ppq),
+    - SC_ENABLE_CALENDAR_QUEUE: calendar of notification times, each
+      day of the calendar is a FIFO bucket of notifications at the same
+      time. Clocks and clocked channels schedule most of notifications one
+      period ahead, so they are appended to an existing bucket in O(1).
+      Buckets are kept in a heap by time and found by time in a hash table.
+
+  Internal header, included by the kernel only.
+
+ *****************************************************************************/
+
+#ifndef SC_TIMED_EVENT_QUEUE_H
+#define SC_TIMED_EVENT_QUEUE_H
+
+#include "sysc/kernel/sc_event.h"
+#include "sysc/utils/sc_pq.h"
+
+#include <vector>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_event_queue
+//
+//  Timed event notifications ordered by notify time.
+// ----------------------------------------------------------------------------
+
+class sc_timed_event_queue
+{
+public:
+
+    sc_timed_event_queue();
+    ~sc_timed_event_queue();
+
+    // add notification
+    void insert( sc_event_timed* et );
+
+    // notification with minimal time, queue must not be empty
+    sc_event_timed* top() const;
+
+    // remove and return notification with minimal time
+    sc_event_timed* extract_top();
+
+    int size() const;
+
+    bool empty() const
+        { return size() == 0; }
+
+private:
+
+#if defined( SC_ENABLE_CALENDAR_QUEUE )
+
+    typedef sc_time::value_type time_type;
+
+    // notifications at the same time in insertion order
+    struct bucket
+    {
+        time_type       time;
+        sc_event_timed* head;
+        sc_event_timed* tail;
+        bucket*         next_free;
+    };
+
+    static bool later( const bucket* b1, const bucket* b2 )
+        { return b1->time > b2->time; }
+
+    bucket* find_bucket( time_type t ) const;
+    bucket* add_bucket( time_type t );
+    void    remove_bucket( bucket* b );
+
+    size_t hash_index( time_type t ) const;
+    void   hash_insert( bucket* b );
+    void   hash_remove( bucket* b );
+    void   hash_grow();
+
+    std::vector<bucket*> m_heap;      // buckets, earliest time on top
+    std::vector<bucket*> m_table;     // open addressing hash of buckets
+    size_t               m_table_num; // buckets in hash table
+    bucket*              m_last;      // bucket of last insertion
+    bucket*              m_free;      // pool of unused buckets
+    std::vector<bucket*> m_chunks;    // memory allocated for buckets
+    int                  m_size;      // number of notifications
+
+#else
+
+    sc_ppq<sc_event_timed*> m_ppq;
+
+#endif // SC_ENABLE_CALENDAR_QUEUE
+
+private:
+
+    // disabled
+    sc_timed_event_queue( const sc_timed_event_queue& );
+    sc_timed_event_queue& operator = ( const sc_timed_event_queue& );
+};
+
+} // namespace sc_core
+
+#endif // SC_TIMED_EVENT_QUEUE_H
+
+// Taf!
@@ -0,0 +1,378 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_bin2vcd.cpp - Convert binary trace file created with
+                   sc_create_bin_trace_file() into VCD.
+
+  Usage: sc_bin2vcd <input.scbt> [<output.vcd>], standard output is used
+         if no output file specified.
+
+ *****************************************************************************/
+
+#include "sysc/tracing/sc_bin_trace_codec.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace sc_core::sc_bin_trace_codec;
+
+namespace {
+
+// Buffered reader of input file
+class bin_reader
+{
+public:
+    explicit bin_reader(FILE* f) : fp(f), pos(0) {}
+
+    bool get_byte(unsigned char& c)
+    {
+        if (pos == buf.size() && !fill()) return false;
+        c = buf[pos++];
+        return true;
+    }
+
+    bool get_varint(uint64_t& v)
+    {
+        v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            unsigned char c;
+            if (!get_byte(c)) return false;
+            v |= static_cast<uint64_t>(c & 0x7F) << shift;
+            if (!(c & 0x80)) return true;
+        }
+        return false;
+    }
+
+    bool get_bytes(unsigned char* dst, size_t n)
+    {
+        while (n != 0) {
+            if (pos == buf.size() && !fill()) return false;
+            size_t m = buf.size() - pos < n ? buf.size() - pos : n;
+            std::memcpy(dst, &buf[pos], m);
+            pos += m; dst += m; n -= m;
+        }
+        return true;
+    }
+
+    bool get_string(std::string& s)
+    {
+        uint64_t n;
+        if (!get_varint(n)) return false;
+        s.resize(n);
+        return n == 0 || get_bytes(reinterpret_cast<unsigned char*>(&s[0]), n);
+    }
+
+private:
+    bool fill()
+    {
+        buf.resize(1 << 20);
+        size_t n = std::fread(&buf[0], 1, buf.size(), fp);
+        buf.resize(n);
+        pos = 0;
+        return n != 0;
+    }
+
+    FILE*                      fp;
+    std::vector<unsigned char> buf;
+    size_t                     pos;
+};
+
+struct bin_var
+{
+    std::string name;
+    unsigned    kind;
+    unsigned    width;
+    size_t      vsize;
+    std::string id;
+};
+
+// VCD identifier from printable characters
+std::string make_id(size_t index)
+{
+    std::string id;
+    do {
+        id += static_cast<char>('!' + index % 94);
+        index /= 94;
+    } while (index != 0);
+    return id;
+}
+
+// Hierarchical scopes, similar to VCD trace file
+struct vcd_scope
+{
+    std::vector<std::pair<std::string, const bin_var*> > vars;
+    std::map<std::string, vcd_scope> scopes;
+
+    void add(const std::string& name, const bin_var* var)
+    {
+        std::string::size_type i = name.find('.');
+        if (i == std::string::npos) {
+            vars.push_back(std::make_pair(name, var));
+        } else {
+            scopes[name.substr(0, i)].add(name.substr(i+1), var);
+        }
+    }
+
+    void print(FILE* out, const std::string& scope_name) const
+    {
+        std::fprintf(out, "$scope module %s $end\n", scope_name.c_str());
+        for (size_t i = 0; i != vars.size(); ++i) {
+            const bin_var* v = vars[i].second;
+            const char* type = v->kind == BIN_REAL ? "real" :
+                               v->kind == BIN_EVENT ? "event" :
+                               v->kind == BIN_TIME ? "time" : "wire";
+            if (v->width == 1 || v->kind == BIN_REAL) {
+                std::fprintf(out, "$var %s  % 3d  %s  %s       $end\n",
+                             type, v->width, v->id.c_str(),
+                             vars[i].first.c_str());
+            } else {
+                std::fprintf(out, "$var %s  % 3d  %s  %s [%d:0]  $end\n",
+                             type, v->width, v->id.c_str(),
+                             vars[i].first.c_str(), v->width-1);
+            }
+        }
+        for (std::map<std::string, vcd_scope>::const_iterator i =
+             scopes.begin(); i != scopes.end(); ++i) {
+            i->second.print(out, i->first);
+        }
+        std::fprintf(out, "$upscope $end\n");
+    }
+};
+
+// Remove multiple leading 0,z,x, same as VCD trace file does
+const char* strip_leading_bits(const char* s)
+{
+    if (std::strlen(s) < 2 || (s[0] != 'z' && s[0] != 'x' && s[0] != '0')) {
+        return s;
+    }
+    const char* p = s;
+    char first = *p;
+    while (*p == first) p++;
+    return (first == '0' && *p == '1') ? p : p-1;
+}
+
+// Print value change of variable
+void print_value(FILE* out, const bin_var& v, const unsigned char* data,
+                 std::string& bits)
+{
+    if (v.kind == BIN_EVENT) {
+        std::fprintf(out, "1%s\n", v.id.c_str());
+        return;
+    }
+    if (v.kind == BIN_REAL) {
+        uint64_t u = 0;
+        for (size_t i = 0; i != 8; ++i) u |= uint64_t(data[i]) << (8*i);
+        double d;
+        std::memcpy(&d, &u, sizeof(d));
+        std::fprintf(out, "r%.16g %s\n", d, v.id.c_str());
+        return;
+    }
+
+    static const char logic_chars[] = {'0', '1', 'z', 'x'};
+    bits.resize(v.width);
+    for (unsigned i = 0; i != v.width; ++i) {
+        char c;
+        if (v.kind == BIN_LOGIC) {
+            c = logic_chars[(data[i/4] >> (2*(i%4))) & 3];
+        } else {
+            c = (data[i/8] >> (i%8)) & 1 ? '1' : '0';
+        }
+        bits[v.width-1-i] = c;
+    }
+
+    if (v.width == 1) {
+        std::fprintf(out, "%c%s\n", bits[0], v.id.c_str());
+    } else {
+        std::fprintf(out, "b%s %s\n", strip_leading_bits(bits.c_str()),
+                     v.id.c_str());
+    }
+}
+
+int error(const char* msg)
+{
+    std::fprintf(stderr, "sc_bin2vcd: %s\n", msg);
+    return 1;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3) {
+        std::fprintf(stderr, "Usage: sc_bin2vcd <input.scbt> [<output.vcd>]\n");
+        return 1;
+    }
+
+    FILE* in = std::fopen(argv[1], "rb");
+    if (!in) return error("cannot open input file");
+    FILE* out = argc == 3 ? std::fopen(argv[2], "w") : stdout;
+    if (!out) return error("cannot open output file");
+
+    bin_reader rd(in);
+
+    // Header
+    unsigned char magic[sizeof(MAGIC)];
+    unsigned char version;
+    if (!rd.get_bytes(magic, sizeof(MAGIC)) ||
+        std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !rd.get_byte(version) || version != VERSION) {
+        return error("not a binary trace file or unsupported version");
+    }
+
+    std::string date, sc_ver, timescale;
+    uint64_t var_num;
+    if (!rd.get_string(date) || !rd.get_string(sc_ver) ||
+        !rd.get_string(timescale) || !rd.get_varint(var_num)) {
+        return error("corrupted header");
+    }
+
+    std::vector<bin_var> vars(var_num);
+    vcd_scope top;
+    for (size_t i = 0; i != vars.size(); ++i) {
+        bin_var& v = vars[i];
+        unsigned char kind;
+        uint64_t width;
+        if (!rd.get_string(v.name) || !rd.get_byte(kind) ||
+            !rd.get_varint(width) || kind >= BIN_LAST) {
+            return error("corrupted variable table");
+        }
+        v.kind = kind;
+        v.width = static_cast<unsigned>(width);
+        v.vsize = value_size(kind, v.width);
+        v.id = make_id(i);
+
+        std::string name = v.name;
+        for (size_t j = 0; j != name.size(); ++j) {
+            if (name[j] == '[') name[j] = '(';
+            else if (name[j] == ']') name[j] = ')';
+        }
+        top.add(name, &v);
+    }
+
+    std::fprintf(out, "$date\n     %s\n$end\n\n", date.c_str());
+    std::fprintf(out, "$version\n %s\n$end\n\n", sc_ver.c_str());
+    std::fprintf(out, "$timescale\n     %s\n$end\n\n", timescale.c_str());
+    top.print(out, "SystemC");
+    std::fputs("$enddefinitions  $end\n\n", out);
+
+    // Blocks
+    uint64_t time = 0;
+    std::vector<uint64_t> times;
+    std::vector<std::pair<uint64_t, std::string> > comments;
+    std::vector<std::vector<unsigned char> > chunks;
+    std::vector<unsigned char> packed;
+    // Value changes for each time index: variable and chunk data pointer
+    std::vector<std::vector<std::pair<size_t, const unsigned char*> > > changes;
+    std::string bits;
+
+    while (true) {
+        unsigned char tag;
+        if (!rd.get_byte(tag)) return error("unexpected end of file");
+        if (tag == END_TAG) break;
+        if (tag != BLOCK_TAG) return error("corrupted block");
+
+        uint64_t n;
+        if (!rd.get_varint(n)) return error("corrupted block");
+        times.resize(n);
+        for (size_t i = 0; i != times.size(); ++i) {
+            uint64_t delta;
+            if (!rd.get_varint(delta)) return error("corrupted block");
+            time += delta;
+            times[i] = time;
+        }
+
+        if (!rd.get_varint(n)) return error("corrupted block");
+        comments.resize(n);
+        for (size_t i = 0; i != comments.size(); ++i) {
+            if (!rd.get_varint(comments[i].first) ||
+                !rd.get_string(comments[i].second)) {
+                return error("corrupted block");
+            }
+        }
+
+        if (!rd.get_varint(n)) return error("corrupted block");
+        chunks.resize(n);
+        changes.assign(times.size(),
+                       std::vector<std::pair<size_t, const unsigned char*> >());
+        for (size_t i = 0; i != chunks.size(); ++i) {
+            uint64_t id, raw_size, packed_size;
+            if (!rd.get_varint(id) || !rd.get_varint(raw_size) ||
+                !rd.get_varint(packed_size) || id >= vars.size()) {
+                return error("corrupted chunk");
+            }
+            std::vector<unsigned char>& raw = chunks[i];
+            if (packed_size != 0) {
+                packed.resize(packed_size);
+                if (!rd.get_bytes(&packed[0], packed_size) ||
+                    !decompress(&packed[0], packed_size, raw) ||
+                    raw.size() != raw_size) {
+                    return error("corrupted chunk data");
+                }
+            } else {
+                raw.resize(raw_size);
+                if (raw_size && !rd.get_bytes(&raw[0], raw_size)) {
+                    return error("corrupted chunk data");
+                }
+            }
+
+            const unsigned char* p = raw.empty() ? 0 : &raw[0];
+            const unsigned char* end = p + raw.size();
+            size_t vsize = vars[id].vsize;
+            uint64_t index = 0;
+            while (p != end) {
+                uint64_t delta;
+                if (!get_varint(p, end, delta) || size_t(end - p) < vsize ||
+                    (index += delta) >= times.size()) {
+                    return error("corrupted chunk data");
+                }
+                changes[index].push_back(std::make_pair(id, p));
+                p += vsize;
+            }
+        }
+
+        size_t ci = 0;
+        for (size_t i = 0; i != times.size(); ++i) {
+            for (; ci != comments.size() && comments[ci].first <= i; ++ci) {
+                std::fprintf(out, "$comment\n%s\n$end\n\n",
+                             comments[ci].second.c_str());
+            }
+            std::fprintf(out, "#%llu\n",
+                         static_cast<unsigned long long>(times[i]));
+            for (size_t j = 0; j != changes[i].size(); ++j) {
+                print_value(out, vars[changes[i][j].first],
+                            changes[i][j].second, bits);
+            }
+            std::fputc('\n', out);
+        }
+        for (; ci != comments.size(); ++ci) {
+            std::fprintf(out, "$comment\n%s\n$end\n\n",
+                         comments[ci].second.c_str());
+        }
+    }
+
+    std::fclose(in);
+    if (out != stdout) std::fclose(out);
+    return 0;
+}
@@ -0,0 +1,702 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_bin_trace.cpp - Implementation of compressed binary tracing.
+
+ *****************************************************************************/
+
+#include <cstring>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_ver.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/datatypes/bit/sc_bit.h"
+#include "sysc/datatypes/bit/sc_logic.h"
+#include "sysc/datatypes/bit/sc_lv_base.h"
+#include "sysc/datatypes/int/sc_signed.h"
+#include "sysc/datatypes/int/sc_unsigned.h"
+#include "sysc/datatypes/int/sc_int_base.h"
+#include "sysc/datatypes/int/sc_uint_base.h"
+#include "sysc/datatypes/fx/fx.h"
+#include "sysc/tracing/sc_bin_trace.h"
+#include "sysc/tracing/sc_bin_trace_codec.h"
+#include "sysc/utils/sc_report.h" // sc_assert
+
+namespace sc_core {
+
+using namespace sc_bin_trace_codec;
+
+// Value bytes in block to pass it to writer thread
+static const size_t BLOCK_SIZE = 8 << 20;
+// Blocks waiting for writer thread, simulation waits if there are more
+static const size_t QUEUE_SIZE = 4;
+
+// Put @n low bytes of @v into @dst
+static inline void put_bytes(unsigned char* dst, sc_dt::uint64 v, size_t n)
+{
+    for (size_t i = 0; i != n; ++i) {
+        dst[i] = static_cast<unsigned char>(v >> (8*i));
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : bin_trace
+//
+//  Base class for binary traces, keeps value changes of the variable.
+// ----------------------------------------------------------------------------
+
+class bin_trace
+{
+public:
+
+    bin_trace(const std::string& name_, unsigned kind_, int width_)
+      : name(name_), kind(kind_), width(width_ > 0 ? width_ : 0)
+      , vsize(value_size(kind_, width)), last_index(0)
+    {}
+
+    virtual ~bin_trace() {}
+
+    // Comparison with value stored last time
+    virtual bool changed() = 0;
+
+    // Put current value into @dst and store it
+    virtual void write(unsigned char* dst) = 0;
+
+    // Append value change at time @index of current block
+    void record(unsigned index)
+    {
+        put_varint(buf, index - last_index);
+        last_index = index;
+        size_t size = buf.size();
+        buf.resize(size + vsize);
+        write(vsize ? &buf[size] : 0);
+    }
+
+    const std::string name;
+    const unsigned    kind;
+    const unsigned    width;
+    const size_t      vsize;
+
+    // Value changes in current block
+    std::vector<unsigned char> buf;
+    unsigned                   last_index;
+};
+
+// ----------------------------------------------------------------------------
+
+// Values up to 64 bit
+inline sc_dt::uint64 bin_value(bool v) { return v; }
+inline sc_dt::uint64 bin_value(const sc_dt::sc_bit& v) { return v.to_bool(); }
+inline sc_dt::uint64 bin_value(const sc_dt::sc_int_base& v)
+  { return v.to_uint64(); }
+inline sc_dt::uint64 bin_value(const sc_dt::sc_uint_base& v)
+  { return v.to_uint64(); }
+inline sc_dt::uint64 bin_value(const sc_time& v) { return v.value(); }
+template<class T>
+inline sc_dt::uint64 bin_value(const T& v)
+  { return static_cast<sc_dt::uint64>(v); }
+
+template<class T>
+class bin_integer_trace : public bin_trace
+{
+public:
+    bin_integer_trace(const T& object_, const std::string& name_, int width_,
+                      unsigned kind_ = BIN_WIRE)
+      : bin_trace(name_, kind_, width_ > 64 ? 64 : width_)
+      , object(object_), old_value(bin_value(object_))
+    {}
+
+    bool changed()
+      { return bin_value(object) != old_value; }
+
+    void write(unsigned char* dst)
+    {
+        old_value = bin_value(object);
+        put_bytes(dst, old_value, vsize);
+    }
+
+protected:
+    const T&      object;
+    sc_dt::uint64 old_value;
+};
+
+// Real values
+inline double bin_real(float v) { return v; }
+inline double bin_real(double v) { return v; }
+template<class T>
+inline double bin_real(const T& v) { return v.to_double(); }
+
+template<class T>
+class bin_real_trace : public bin_trace
+{
+public:
+    bin_real_trace(const T& object_, const std::string& name_)
+      : bin_trace(name_, BIN_REAL, 64)
+      , object(object_), old_value(bin_real(object_))
+    {}
+
+    bool changed()
+      { return bin_real(object) != old_value; }
+
+    void write(unsigned char* dst)
+    {
+        old_value = bin_real(object);
+        sc_dt::uint64 v;
+        std::memcpy(&v, &old_value, sizeof(v));
+        put_bytes(dst, v, vsize);
+    }
+
+protected:
+    const T& object;
+    double   old_value;
+};
+
+// Wide two state values, sc_signed/sc_unsigned
+template<class T>
+class bin_big_trace : public bin_trace
+{
+public:
+    bin_big_trace(const T& object_, const std::string& name_)
+      : bin_trace(name_, BIN_WIRE, object_.length())
+      , object(object_), old_value(object_.length())
+    {
+        old_value = object_;
+    }
+
+    bool changed()
+      { return object != old_value; }
+
+    void write(unsigned char* dst)
+    {
+        old_value = object;
+        std::memset(dst, 0, vsize);
+        for (unsigned i = 0; i != width; ++i) {
+            if (object.test(i)) dst[i/8] |= 1 << (i%8);
+        }
+    }
+
+protected:
+    const T& object;
+    T        old_value;
+};
+
+// Bit vector, copied by words
+class bin_bv_trace : public bin_trace
+{
+public:
+    bin_bv_trace(const sc_dt::sc_bv_base& object_, const std::string& name_)
+      : bin_trace(name_, BIN_WIRE, object_.length())
+      , object(object_), old_value(object_)
+    {}
+
+    bool changed()
+      { return !(object == old_value); }
+
+    void write(unsigned char* dst)
+    {
+        old_value = object;
+        for (size_t i = 0; i < vsize; i += 4) {
+            size_t n = vsize - i < 4 ? vsize - i : 4;
+            put_bytes(dst + i, object.get_word(int(i/4)), n);
+        }
+        // Clear bits above the width
+        if (width % 8) dst[vsize-1] &= (1 << (width % 8)) - 1;
+    }
+
+protected:
+    const sc_dt::sc_bv_base& object;
+    sc_dt::sc_bv_base        old_value;
+};
+
+// Four state values, two bits per bit in sc_logic_value_t encoding
+class bin_lv_trace : public bin_trace
+{
+public:
+    bin_lv_trace(const sc_dt::sc_lv_base& object_, const std::string& name_)
+      : bin_trace(name_, BIN_LOGIC, object_.length())
+      , object(object_), old_value(object_)
+    {}
+
+    bool changed()
+      { return !(object == old_value); }
+
+    void write(unsigned char* dst)
+    {
+        old_value = object;
+        std::memset(dst, 0, vsize);
+        for (unsigned i = 0; i != width; ++i) {
+            dst[i/4] |= (object.get_bit(i) & 3) << (2*(i%4));
+        }
+    }
+
+protected:
+    const sc_dt::sc_lv_base& object;
+    sc_dt::sc_lv_base        old_value;
+};
+
+class bin_logic_trace : public bin_trace
+{
+public:
+    bin_logic_trace(const sc_dt::sc_logic& object_, const std::string& name_)
+      : bin_trace(name_, BIN_LOGIC, 1)
+      , object(object_), old_value(object_.value())
+    {}
+
+    bool changed()
+      { return object.value() != old_value; }
+
+    void write(unsigned char* dst)
+    {
+        old_value = object.value();
+        dst[0] = static_cast<unsigned char>(old_value & 3);
+    }
+
+protected:
+    const sc_dt::sc_logic& object;
+    sc_dt::sc_logic_value_t old_value;
+};
+
+class bin_event_trace : public bin_trace
+{
+public:
+    bin_event_trace(const sc_dt::uint64& trigger_stamp_,
+                    const std::string& name_)
+      : bin_trace(name_, BIN_EVENT, 1)
+      , trigger_stamp(trigger_stamp_), old_trigger_stamp(trigger_stamp_)
+    {}
+
+    bool changed()
+      { return trigger_stamp != old_trigger_stamp; }
+
+    void write(unsigned char*)
+      { old_trigger_stamp = trigger_stamp; }
+
+protected:
+    const sc_dt::uint64& trigger_stamp;
+    sc_dt::uint64 old_trigger_stamp;
+};
+
+// ----------------------------------------------------------------------------
+
+// Block of value changes passed to writer thread
+struct bin_trace_block
+{
+    typedef sc_trace_file_base::unit_type unit_type;
+
+    // Times of cycles with changes
+    std::vector<unit_type> times;
+    // Comments with index of next time
+    std::vector<std::pair<unsigned, std::string> > comments;
+    // Value changes for variables changed in the block
+    std::vector<std::pair<unsigned, std::vector<unsigned char> > > chunks;
+
+    bool empty() const
+      { return times.empty() && comments.empty(); }
+};
+
+/*****************************************************************************
+           bin_trace_file functions
+ *****************************************************************************/
+
+bin_trace_file::bin_trace_file(const char *name)
+  : sc_trace_file_base( name, "scbt" )
+  , traces()
+  , block(new bin_trace_block)
+  , block_bytes(0)
+  , last_time(0)
+  , writer_stop(false)
+  , written_time(0)
+  , write_failed(false)
+  , write_reported(false)
+{}
+
+bin_trace_file::~bin_trace_file()
+{
+    if (is_initialized()) {
+        if (!block->empty()) flush_block();
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            writer_stop = true;
+        }
+        queue_cond.notify_all();
+        writer.join();
+
+        if (!write_failed) {
+            if (std::fputc(END_TAG, fp) == EOF || std::fflush(fp) != 0) {
+                write_failed = true;
+            }
+        }
+        check_write(true);
+    }
+    delete block;
+
+    for (size_t i = 0; i != traces.size(); ++i) {
+        delete traces[i];
+    }
+}
+
+void
+bin_trace_file::add_trace(bin_trace* t)
+{
+    if (t->kind != BIN_EVENT && t->width == 0) {
+        std::stringstream ss;
+        ss << "'" << t->name << "' has 0 bits";
+        SC_REPORT_ERROR( SC_ID_TRACING_OBJECT_IGNORED_, ss.str().c_str() );
+        delete t;
+        return;
+    }
+    traces.push_back(t);
+}
+
+void
+bin_trace_file::do_initialize()
+{
+    std::vector<unsigned char> buf;
+    buf.insert(buf.end(), MAGIC, MAGIC + sizeof(MAGIC));
+    buf.push_back(VERSION);
+    put_string(buf, localtime_string());
+    put_string(buf, sc_version());
+    put_string(buf, fs_unit_to_str(trace_unit_fs));
+
+    put_varint(buf, traces.size());
+    for (size_t i = 0; i != traces.size(); ++i) {
+        put_string(buf, traces[i]->name);
+        buf.push_back(static_cast<unsigned char>(traces[i]->kind));
+        put_varint(buf, traces[i]->width);
+    }
+    write_buf(buf);
+    check_write(false);
+
+    // All initial values, event is recorded if triggered only
+    unsigned index = record_time(time_stamp());
+    for (size_t i = 0; i != traces.size(); ++i) {
+        if (traces[i]->kind != BIN_EVENT || traces[i]->changed()) {
+            traces[i]->record(index);
+            block_bytes += traces[i]->vsize + 1;
+        }
+    }
+
+    writer = std::thread(&bin_trace_file::write_blocks, this);
+}
+
+size_t
+bin_trace_file::trace_count() const
+{
+    return traces.size();
+}
+
+#if SC_TRACING_PHASE_CALLBACKS_
+void bin_trace_file::trace( sc_trace_file* ) const {
+    SC_REPORT_ERROR( sc_core::SC_ID_INTERNAL_ERROR_
+                   , "invalid call to bin_trace_file::trace(sc_trace_file*)" );
+}
+#endif // SC_TRACING_PHASE_CALLBACKS_
+
+// ----------------------------------------------------------------------------
+
+#define DEFN_TRACE_METHOD(tp, trace_class, args)                              \
+void                                                                          \
+bin_trace_file::trace(const tp& object_, const std::string& name_)            \
+{                                                                             \
+    if( add_trace_check(name_) )                                              \
+        add_trace( new trace_class args );                                    \
+}
+
+DEFN_TRACE_METHOD(sc_event, bin_event_trace,
+                  (event_trigger_stamp(object_), name_))
+DEFN_TRACE_METHOD(sc_time, bin_integer_trace<sc_time>,
+                  (object_, name_, 64, BIN_TIME))
+
+DEFN_TRACE_METHOD(bool, bin_integer_trace<bool>, (object_, name_, 1))
+DEFN_TRACE_METHOD(float, bin_real_trace<float>, (object_, name_))
+DEFN_TRACE_METHOD(double, bin_real_trace<double>, (object_, name_))
+
+DEFN_TRACE_METHOD(sc_dt::sc_bit, bin_integer_trace<sc_dt::sc_bit>,
+                  (object_, name_, 1))
+DEFN_TRACE_METHOD(sc_dt::sc_logic, bin_logic_trace, (object_, name_))
+
+DEFN_TRACE_METHOD(sc_dt::sc_signed, bin_big_trace<sc_dt::sc_signed>,
+                  (object_, name_))
+DEFN_TRACE_METHOD(sc_dt::sc_unsigned, bin_big_trace<sc_dt::sc_unsigned>,
+                  (object_, name_))
+DEFN_TRACE_METHOD(sc_dt::sc_int_base, bin_integer_trace<sc_dt::sc_int_base>,
+                  (object_, name_, object_.length()))
+DEFN_TRACE_METHOD(sc_dt::sc_uint_base, bin_integer_trace<sc_dt::sc_uint_base>,
+                  (object_, name_, object_.length()))
+
+DEFN_TRACE_METHOD(sc_dt::sc_fxval, bin_real_trace<sc_dt::sc_fxval>,
+                  (object_, name_))
+DEFN_TRACE_METHOD(sc_dt::sc_fxval_fast, bin_real_trace<sc_dt::sc_fxval_fast>,
+                  (object_, name_))
+DEFN_TRACE_METHOD(sc_dt::sc_fxnum, bin_real_trace<sc_dt::sc_fxnum>,
+                  (object_, name_))
+DEFN_TRACE_METHOD(sc_dt::sc_fxnum_fast, bin_real_trace<sc_dt::sc_fxnum_fast>,
+                  (object_, name_))
+
+DEFN_TRACE_METHOD(sc_dt::sc_bv_base, bin_bv_trace, (object_, name_))
+DEFN_TRACE_METHOD(sc_dt::sc_lv_base, bin_lv_trace, (object_, name_))
+
+#undef DEFN_TRACE_METHOD
+
+#define DEFN_TRACE_METHOD_WIDTH(tp)                                           \
+void                                                                          \
+bin_trace_file::trace( const tp&          object_,                            \
+                       const std::string& name_,                              \
+                       int                width_ )                            \
+{                                                                             \
+    if( add_trace_check(name_) )                                              \
+        add_trace( new bin_integer_trace<tp>( object_, name_, width_ ) );     \
+}
+
+DEFN_TRACE_METHOD_WIDTH(char)
+DEFN_TRACE_METHOD_WIDTH(short)
+DEFN_TRACE_METHOD_WIDTH(int)
+DEFN_TRACE_METHOD_WIDTH(long)
+DEFN_TRACE_METHOD_WIDTH(unsigned char)
+DEFN_TRACE_METHOD_WIDTH(unsigned short)
+DEFN_TRACE_METHOD_WIDTH(unsigned int)
+DEFN_TRACE_METHOD_WIDTH(unsigned long)
+DEFN_TRACE_METHOD_WIDTH(sc_dt::int64)
+DEFN_TRACE_METHOD_WIDTH(sc_dt::uint64)
+
+#undef DEFN_TRACE_METHOD_WIDTH
+
+void
+bin_trace_file::trace( const unsigned&    object_,
+                       const std::string& name_,
+                       const char**       enum_literals_ )
+{
+    // Number of bits required to represent the number of literals
+    unsigned nliterals = 0;
+    while (enum_literals_[nliterals]) nliterals++;
+    int width = 0;
+    for (unsigned i = nliterals > 0 ? nliterals-1 : 0; i != 0; i >>= 1) {
+        width++;
+    }
+
+    if( add_trace_check(name_) )
+        add_trace( new bin_integer_trace<unsigned>( object_, name_,
+                                                    width ? width : 1 ) );
+}
+
+void
+bin_trace_file::write_comment(const std::string& comment)
+{
+    unsigned index = static_cast<unsigned>(block->times.size());
+    block->comments.push_back(std::make_pair(index, comment));
+}
+
+// ----------------------------------------------------------------------------
+
+sc_trace_file_base::unit_type
+bin_trace_file::time_stamp() const
+{
+    unit_type now_units_high, now_units_low;
+    timestamp_in_trace_units(now_units_high, now_units_low);
+
+    if (has_low_units()) {
+        unit_type scale = 1;
+        for (int i = 0; i != low_units_len(); ++i) scale *= 10;
+        return now_units_high * scale + now_units_low;
+    }
+    return now_units_high;
+}
+
+unsigned
+bin_trace_file::record_time(unit_type now)
+{
+    // Values changed at the same time stored at the same index,
+    // later values in the same time overwrite earlier ones
+    if (block->times.empty() || now != last_time) {
+        block->times.push_back(now);
+        last_time = now;
+    }
+    return static_cast<unsigned>(block->times.size() - 1);
+}
+
+void
+bin_trace_file::cycle(bool this_is_a_delta_cycle)
+{
+    // Trace delta cycles only when enabled
+    if (!delta_cycles() && this_is_a_delta_cycle) return;
+
+    // Check for initialization
+    if( initialize() )
+        return;
+
+    // Time is recorded at first changed variable only
+    bool has_index = false;
+    unsigned index = 0;
+
+    // Signal variables are checked only if the signal is changed
+    const std::vector<size_t>& indices = traces_to_check();
+    bin_trace* const* const l_traces = traces.empty() ? 0 : &traces[0];
+    for (size_t i = 0; i != indices.size(); ++i) {
+        bin_trace* t = l_traces[indices[i]];
+        if (t->changed()) {
+            if (!has_index) {
+                index = record_time(time_stamp());
+                has_index = true;
+            }
+            t->record(index);
+            block_bytes += t->vsize + 1;
+        }
+    }
+
+    if (block_bytes >= BLOCK_SIZE) {
+        flush_block();
+    }
+}
+
+void
+bin_trace_file::flush_block()
+{
+    for (size_t i = 0; i != traces.size(); ++i) {
+        bin_trace* t = traces[i];
+        if (!t->buf.empty()) {
+            block->chunks.push_back(std::make_pair(static_cast<unsigned>(i),
+                                    std::vector<unsigned char>()));
+            block->chunks.back().second.swap(t->buf);
+            t->last_index = 0;
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        // Limit memory used by blocks not written yet
+        while (queue.size() >= QUEUE_SIZE) {
+            queue_cond.wait(lock);
+        }
+        queue.push_back(block);
+    }
+    queue_cond.notify_all();
+
+    block = new bin_trace_block;
+    block_bytes = 0;
+
+    check_write(false);
+}
+
+void
+bin_trace_file::write_blocks()
+{
+    while (true) {
+        bin_trace_block* b;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            while (queue.empty() && !writer_stop) {
+                queue_cond.wait(lock);
+            }
+            if (queue.empty()) return;
+            b = queue.front();
+            queue.pop_front();
+        }
+        queue_cond.notify_all();
+
+        write_block(*b);
+        delete b;
+    }
+}
+
+void
+bin_trace_file::write_block(bin_trace_block& b)
+{
+    std::vector<unsigned char> buf;
+    std::vector<unsigned char> packed;
+
+    buf.push_back(BLOCK_TAG);
+    put_varint(buf, b.times.size());
+    for (size_t i = 0; i != b.times.size(); ++i) {
+        put_varint(buf, b.times[i] - written_time);
+        written_time = b.times[i];
+    }
+
+    put_varint(buf, b.comments.size());
+    for (size_t i = 0; i != b.comments.size(); ++i) {
+        put_varint(buf, b.comments[i].first);
+        put_string(buf, b.comments[i].second);
+    }
+
+    put_varint(buf, b.chunks.size());
+    for (size_t i = 0; i != b.chunks.size(); ++i) {
+        const std::vector<unsigned char>& raw = b.chunks[i].second;
+        bool is_packed = compress(raw, packed);
+        const std::vector<unsigned char>& data = is_packed ? packed : raw;
+
+        put_varint(buf, b.chunks[i].first);
+        put_varint(buf, raw.size());
+        put_varint(buf, is_packed ? packed.size() : 0);
+        buf.insert(buf.end(), data.begin(), data.end());
+
+        // Write large blocks by parts
+        if (buf.size() >= BLOCK_SIZE) {
+            write_buf(buf);
+            buf.clear();
+        }
+    }
+    if (!buf.empty()) {
+        write_buf(buf);
+    }
+}
+
+void
+bin_trace_file::write_buf(const std::vector<unsigned char>& buf)
+{
+    if (write_failed) return;
+    if (std::fwrite(&buf[0], 1, buf.size(), fp) != buf.size()) {
+        write_failed = true;
+    }
+}
+
+void
+bin_trace_file::check_write(bool at_close)
+{
+    if (!write_failed || write_reported) return;
+    write_reported = true;
+
+    // Writer thread cannot report, it is done in simulation thread
+    if (at_close) {
+        SC_REPORT_WARNING( SC_ID_TRACING_WRITE_FAILED_, filename() );
+    } else {
+        SC_REPORT_ERROR( SC_ID_TRACING_WRITE_FAILED_, filename() );
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+SC_API sc_trace_file*
+sc_create_bin_trace_file(const char * name)
+{
+    sc_trace_file * tf = ::new bin_trace_file(name);
+    return tf;
+}
+
+SC_API void
+sc_close_bin_trace_file( sc_trace_file* tf )
+{
+    bin_trace_file* bin_tf = static_cast<bin_trace_file*>(tf);
+    delete bin_tf;
+}
+
+} // namespace sc_core
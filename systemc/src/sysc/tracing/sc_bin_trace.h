@@ -0,0 +1,184 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_bin_trace.h - Implementation of compressed binary tracing.
+
+  Value changes are appended to per variable buffers in binary form. Filled
+  buffers are passed as a block to background thread, which compresses and
+  writes them. Use sc_bin2vcd to convert the trace file into VCD.
+
+ *****************************************************************************/
+
+#ifndef SC_BIN_TRACE_H
+#define SC_BIN_TRACE_H
+
+#include "sysc/tracing/sc_trace_file_base.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sc_core {
+
+class bin_trace;        // defined in sc_bin_trace.cpp
+struct bin_trace_block; // defined in sc_bin_trace.cpp
+
+// ----------------------------------------------------------------------------
+//  CLASS : bin_trace_file
+//
+//  Compressed binary trace file with background writer thread.
+// ----------------------------------------------------------------------------
+
+class bin_trace_file
+  : public sc_trace_file_base
+{
+public:
+
+    // Create a binary trace file.
+    // `Name' forms the base of the name to which `.scbt' is added.
+    bin_trace_file(const char *name);
+
+    // Flush results, stop writer thread and close file.
+    ~bin_trace_file();
+
+protected:
+
+    // These are all virtual functions in sc_trace_file and
+    // they need to be defined here.
+
+    virtual void trace(const sc_time& object, const std::string& name);
+    virtual void trace(const sc_event& object, const std::string& name);
+
+    void trace(const bool& object, const std::string& name);
+    virtual void trace(const sc_dt::sc_bit& object, const std::string& name);
+    void trace(const sc_dt::sc_logic& object, const std::string& name);
+
+    void trace(const unsigned char& object, const std::string& name,
+               int width);
+    void trace(const unsigned short& object, const std::string& name,
+               int width);
+    void trace(const unsigned int& object, const std::string& name,
+               int width);
+    void trace(const unsigned long& object, const std::string& name,
+               int width);
+    void trace(const char& object, const std::string& name, int width);
+    void trace(const short& object, const std::string& name, int width);
+    void trace(const int& object, const std::string& name, int width);
+    void trace(const long& object, const std::string& name, int width);
+    void trace(const sc_dt::int64& object, const std::string& name,
+               int width);
+    void trace(const sc_dt::uint64& object, const std::string& name,
+               int width);
+
+    void trace(const float& object, const std::string& name);
+    void trace(const double& object, const std::string& name);
+
+    void trace(const sc_dt::sc_uint_base& object, const std::string& name);
+    void trace(const sc_dt::sc_int_base& object, const std::string& name);
+    void trace(const sc_dt::sc_unsigned& object, const std::string& name);
+    void trace(const sc_dt::sc_signed& object, const std::string& name);
+
+    void trace(const sc_dt::sc_fxval& object, const std::string& name);
+    void trace(const sc_dt::sc_fxval_fast& object, const std::string& name);
+    void trace(const sc_dt::sc_fxnum& object, const std::string& name);
+    void trace(const sc_dt::sc_fxnum_fast& object, const std::string& name);
+
+    virtual void trace(const sc_dt::sc_bv_base& object,
+                       const std::string& name);
+    virtual void trace(const sc_dt::sc_lv_base& object,
+                       const std::string& name);
+
+    // Trace an enumerated object as unsigned value
+    void trace(const unsigned& object, const std::string& name,
+               const char** enum_literals);
+
+    // Output a comment to the trace file
+    void write_comment(const std::string& comment);
+
+    // Record changed values for cycle.
+    void cycle(bool delta_cycle);
+
+private:
+
+#if SC_TRACING_PHASE_CALLBACKS_
+    // avoid hidden overload warnings
+    virtual void trace( sc_trace_file* ) const;
+#endif // SC_TRACING_PHASE_CALLBACKS_
+
+    // Add trace if tracing is not started yet
+    void add_trace(bin_trace* t);
+
+    // Write header and initial values, start writer thread
+    virtual void do_initialize();
+
+    // Number of variables added, used to bind them to signals
+    virtual size_t trace_count() const;
+
+    // Current kernel time in trace time units
+    unit_type time_stamp() const;
+
+    // Record time for current cycle if not recorded yet
+    unsigned record_time(unit_type now);
+
+    // Pass current block to writer thread
+    void flush_block();
+
+    // Writer thread function
+    void write_blocks();
+
+    // Compress and write one block
+    void write_block(bin_trace_block& block);
+
+    // Write buffer to file, set write_failed if not all written
+    void write_buf(const std::vector<unsigned char>& buf);
+
+    // Report write error once, error in simulation and warning at close
+    void check_write(bool at_close);
+
+private:
+
+    // Variables traced
+    std::vector<bin_trace*> traces;
+
+    // Current block being filled
+    bin_trace_block*  block;
+    size_t            block_bytes;   // Value bytes in current block
+    unit_type         last_time;     // Last recorded time
+
+    // Blocks passed to writer thread
+    std::deque<bin_trace_block*> queue;
+    std::mutex              queue_mutex;
+    std::condition_variable queue_cond;
+    bool                    writer_stop;
+    std::thread             writer;
+    unit_type               written_time; // Last time in written block
+    std::atomic<bool>       write_failed; // Writing file failed, no more
+                                          // blocks are written
+    bool                    write_reported; // Write error reported
+};
+
+} // namespace sc_core
+
+#endif // SC_BIN_TRACE_H
+// Taf!
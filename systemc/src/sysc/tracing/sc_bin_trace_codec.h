@@ -0,0 +1,191 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_bin_trace_codec.h - Binary trace file format constants, variable length
+                         integer and block compression codec.
+
+  Shared by binary trace file writer and sc_bin2vcd converter, so it does
+  not depend on other SystemC headers.
+
+  File layout (integers are LEB128 variable length unless noted):
+    header : "SCBT" version(byte) date version timescale var_num
+             { name kind(byte) width } * var_num
+    block  : 'B' time_num { time delta } * time_num
+             comment_num { time_index comment } * comment_num
+             chunk_num { var_id raw_size packed_size data } * chunk_num
+    end    : 'E'
+  Strings are stored as length and characters. Chunk contains value changes
+  of one variable: { time_index delta, value bytes } *, it is compressed
+  if packed_size is not zero. Value size depends on variable kind and width.
+
+ *****************************************************************************/
+
+#ifndef SC_BIN_TRACE_CODEC_H
+#define SC_BIN_TRACE_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sc_core {
+namespace sc_bin_trace_codec {
+
+const char          MAGIC[4] = {'S', 'C', 'B', 'T'};
+const unsigned char VERSION = 1;
+const unsigned char BLOCK_TAG = 'B';
+const unsigned char END_TAG = 'E';
+
+// Variable kinds
+enum bin_kind { BIN_WIRE = 0, BIN_LOGIC, BIN_REAL, BIN_EVENT, BIN_TIME,
+                BIN_LAST };
+
+// Number of bytes for one value of variable
+inline size_t value_size(unsigned kind, unsigned width)
+{
+    switch (kind) {
+        case BIN_WIRE:  return (width + 7) / 8;
+        case BIN_LOGIC: return (width + 3) / 4;
+        case BIN_REAL:  return 8;
+        case BIN_TIME:  return 8;
+        default:        return 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Variable length integers and strings
+
+inline void put_varint(std::vector<unsigned char>& buf, uint64_t v)
+{
+    while (v >= 0x80) {
+        buf.push_back(static_cast<unsigned char>(v | 0x80));
+        v >>= 7;
+    }
+    buf.push_back(static_cast<unsigned char>(v));
+}
+
+inline void put_string(std::vector<unsigned char>& buf, const std::string& s)
+{
+    put_varint(buf, s.size());
+    buf.insert(buf.end(), s.begin(), s.end());
+}
+
+// Read variable length integer, @p is advanced, returns false at @end
+inline bool get_varint(const unsigned char*& p, const unsigned char* end,
+                       uint64_t& v)
+{
+    v = 0;
+    for (unsigned shift = 0; p != end && shift < 64; shift += 7) {
+        unsigned char c = *p++;
+        v |= static_cast<uint64_t>(c & 0x7F) << shift;
+        if (!(c & 0x80)) return true;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Block compression, byte oriented LZ77 with greedy hash matching.
+// Sequence: literal_len literals match_len offset, match_len zero ends data
+
+const size_t   MIN_MATCH = 4;
+const unsigned HASH_BITS = 14;
+
+inline uint32_t hash4(const unsigned char* p)
+{
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+// Compress @src into @dst, returns false if compressed data is not smaller
+inline bool compress(const std::vector<unsigned char>& src,
+                     std::vector<unsigned char>& dst)
+{
+    dst.clear();
+    const size_t size = src.size();
+    if (size < 2*MIN_MATCH) return false;
+
+    std::vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+    const unsigned char* data = src.data();
+    size_t anchor = 0;
+    size_t i = 0;
+
+    while (i + MIN_MATCH <= size) {
+        uint32_t h = hash4(data + i);
+        size_t cand = table[h];
+        table[h] = static_cast<uint32_t>(i + 1);
+
+        if (cand != 0 && std::memcmp(data + cand - 1, data + i, MIN_MATCH) == 0) {
+            size_t ref = cand - 1;
+            size_t len = MIN_MATCH;
+            while (i + len < size && data[ref + len] == data[i + len]) len++;
+
+            put_varint(dst, i - anchor);
+            dst.insert(dst.end(), data + anchor, data + i);
+            put_varint(dst, len - MIN_MATCH + 1);
+            put_varint(dst, i - ref);
+
+            i += len;
+            anchor = i;
+            if (dst.size() >= size) return false;
+        } else {
+            i++;
+        }
+    }
+    put_varint(dst, size - anchor);
+    dst.insert(dst.end(), data + anchor, data + size);
+    put_varint(dst, 0);
+
+    return dst.size() < size;
+}
+
+// Decompress @size bytes from @src into @dst, returns false if data corrupted
+inline bool decompress(const unsigned char* src, size_t src_size,
+                       std::vector<unsigned char>& dst)
+{
+    dst.clear();
+    const unsigned char* p = src;
+    const unsigned char* end = src + src_size;
+
+    while (true) {
+        uint64_t lit, len, off;
+        if (!get_varint(p, end, lit) || lit > size_t(end - p)) return false;
+        dst.insert(dst.end(), p, p + lit);
+        p += lit;
+
+        if (!get_varint(p, end, len)) return false;
+        if (len == 0) return true;
+        if (!get_varint(p, end, off) || off == 0 || off > dst.size()) {
+            return false;
+        }
+        len += MIN_MATCH - 1;
+        // Byte by byte copy as match could overlap with itself
+        size_t ref = dst.size() - off;
+        for (size_t j = 0; j != len; ++j) dst.push_back(dst[ref + j]);
+    }
+}
+
+} // namespace sc_bin_trace_codec
+} // namespace sc_core
+
+#endif // SC_BIN_TRACE_CODEC_H
+// Taf!
@@ -86,6 +86,56 @@ void sc_trace_file::delta_cycles(bool)
   /* Intentionally blank */
 }
 
+void sc_trace_file::begin_subscription(const sc_trace_source&)
+{
+  /* Intentionally blank */
+}
+
+void sc_trace_file::end_subscription()
+{
+  /* Intentionally blank */
+}
+
+// Trace source and subscriber functions.
+
+sc_trace_subscriber::sc_trace_subscriber()
+  : m_source(0), m_next(0)
+{}
+
+sc_trace_subscriber::~sc_trace_subscriber()
+{
+    if (m_source) m_source->remove_trace_subscriber(this);
+}
+
+sc_trace_source::~sc_trace_source()
+{
+    for (sc_trace_subscriber* s = m_trace_subscribers; s; s = s->m_next) {
+        s->m_source = 0;
+    }
+}
+
+void
+sc_trace_source::add_trace_subscriber(sc_trace_subscriber* subscriber) const
+{
+    sc_assert(subscriber && !subscriber->m_source);
+    subscriber->m_source = this;
+    subscriber->m_next = m_trace_subscribers;
+    m_trace_subscribers = subscriber;
+}
+
+void
+sc_trace_source::remove_trace_subscriber(sc_trace_subscriber* subscriber) const
+{
+    for (sc_trace_subscriber** s = &m_trace_subscribers; *s; s = &(*s)->m_next) {
+        if (*s == subscriber) {
+            *s = subscriber->m_next;
+            subscriber->m_source = 0;
+            subscriber->m_next = 0;
+            return;
+        }
+    }
+}
+
 const sc_dt::uint64&
 sc_trace_file::event_trigger_stamp(const sc_event& ev) const
 {
@@ -99,6 +149,8 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_subscription subscription( tf,
+	    dynamic_cast<const sc_trace_source*>( &object ) );
 	tf->trace( object.read(), name, width );
     }
 }
@@ -110,6 +162,8 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_subscription subscription( tf,
+	    dynamic_cast<const sc_trace_source*>( &object ) );
 	tf->trace( object.read(), name, width );
     }
 }
@@ -121,6 +175,8 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_subscription subscription( tf,
+	    dynamic_cast<const sc_trace_source*>( &object ) );
 	tf->trace( object.read(), name, width );
     }
 }
@@ -132,6 +188,8 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_subscription subscription( tf,
+	    dynamic_cast<const sc_trace_source*>( &object ) );
 	tf->trace( object.read(), name, width );
     }
 }
@@ -77,6 +77,72 @@ class sc_event;
 class sc_time;
 
 template <class T> class sc_signal_in_if;
+class sc_trace_source;
+
+// Subscriber notified by trace source when its traced value is changed.
+// Used by trace files to check for changes only the traces of sources
+// updated since last trace cycle.
+
+class SC_API sc_trace_subscriber
+{
+    friend class sc_trace_source;
+
+public:
+
+    // Called in update phase when value of the source is changed
+    virtual void value_changed() = 0;
+
+protected:
+
+    sc_trace_subscriber();
+
+    // Remove itself from the source subscriber list
+    virtual ~sc_trace_subscriber();
+
+private:
+    const sc_trace_source* m_source;
+    sc_trace_subscriber*   m_next;
+
+private: // disabled
+    sc_trace_subscriber( const sc_trace_subscriber& ) /* = delete */;
+    sc_trace_subscriber& operator=( const sc_trace_subscriber& ) /* = delete */;
+};
+
+// Base class for channels which notify trace subscribers about value change,
+// the values traced are changed in the channel update only
+
+class SC_API sc_trace_source
+{
+    friend class sc_trace_subscriber;
+
+public:
+
+    void add_trace_subscriber( sc_trace_subscriber* subscriber ) const;
+    void remove_trace_subscriber( sc_trace_subscriber* subscriber ) const;
+
+protected:
+
+    sc_trace_source()
+      : m_trace_subscribers( 0 )
+    {}
+
+    // Detach subscribers still alive
+    ~sc_trace_source();
+
+    // To be called from the channel update if the value is changed
+    void notify_trace_subscribers() const
+    {
+        for( sc_trace_subscriber* s = m_trace_subscribers; s; s = s->m_next )
+            s->value_changed();
+    }
+
+protected:
+    mutable sc_trace_subscriber* m_trace_subscribers;
+
+private: // disabled
+    sc_trace_source( const sc_trace_source& ) /* = delete */;
+    sc_trace_source& operator=( const sc_trace_source& ) /* = delete */;
+};
 
 // Base class for all kinds of trace files. 
 
@@ -160,6 +226,12 @@ public:
     // Set time unit.
     virtual void set_time_unit( double v, sc_time_unit tu )=0;
 
+    // Traces added until end_subscription() are changed in update of
+    // the source only, so they are checked after the source notification.
+    // Default implementation does nothing, all traces are checked each cycle.
+    virtual void begin_subscription( const sc_trace_source& source );
+    virtual void end_subscription();
+
 protected:
 
     // Write trace info for cycle
@@ -259,6 +331,33 @@ DECL_TRACE_FUNC_A( sc_dt::sc_fxnum_fast )
 #undef DECL_TRACE_FUNC_B
 
 
+// Binds traces added in its scope to the trace source, does nothing if
+// the source is null
+
+class SC_API sc_trace_subscription
+{
+public:
+
+    sc_trace_subscription( sc_trace_file* tf, const sc_trace_source* source )
+      : m_tf( source ? tf : 0 )
+    {
+        if( m_tf ) m_tf->begin_subscription( *source );
+    }
+
+    ~sc_trace_subscription()
+    {
+        if( m_tf ) m_tf->end_subscription();
+    }
+
+private:
+    sc_trace_file* m_tf;
+
+private: // disabled
+    sc_trace_subscription( const sc_trace_subscription& ) /* = delete */;
+    sc_trace_subscription& operator=( const sc_trace_subscription& ) /* = delete */;
+};
+
+
 template <class T> 
 inline
 void
@@ -266,6 +365,8 @@ sc_trace( sc_trace_file* tf,
 	  const sc_signal_in_if<T>& object,
 	  const std::string& name )
 {
+    sc_trace_subscription subscription( tf,
+        dynamic_cast<const sc_trace_source*>( &object ) );
     sc_trace( tf, object.read(), name );
 }
 
@@ -276,6 +377,8 @@ sc_trace( sc_trace_file* tf,
 	  const sc_signal_in_if<T>& object,
 	  const char* name )
 {
+    sc_trace_subscription subscription( tf,
+        dynamic_cast<const sc_trace_source*>( &object ) );
     sc_trace( tf, object.read(), name );
 }
 
@@ -362,6 +465,12 @@ extern SC_API void sc_close_vcd_trace_file( sc_trace_file* tf );
 extern SC_API sc_trace_file *sc_create_wif_trace_file(const char *name);
 extern SC_API void sc_close_wif_trace_file( sc_trace_file* tf );
 
+
+// ----------------------------------------------------------------------------
+// Create compressed binary trace file, use sc_bin2vcd to convert it to VCD
+extern SC_API sc_trace_file *sc_create_bin_trace_file(const char *name);
+extern SC_API void sc_close_bin_trace_file( sc_trace_file* tf );
+
 } // namespace sc_core
 
 #endif // SC_TRACE_H
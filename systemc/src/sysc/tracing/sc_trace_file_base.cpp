@@ -60,6 +60,34 @@ namespace sc_core {
 
 bool sc_trace_file_base::tracing_initialized_ = false;
 
+// Range of traces bound to one source, registers itself as changed
+// at first source notification after previous check
+class sc_trace_file_base::trace_subscriber
+  : public sc_trace_subscriber
+{
+public:
+    trace_subscriber( sc_trace_file_base* file_, size_t first_, size_t last_ )
+      : file(file_), first(first_), last(last_), changed(false)
+    {}
+
+    virtual void value_changed()
+    {
+        // only number of changed traces is needed if all are checked
+        if( file->poll_all_ ) {
+            file->changed_traces_num_ += last - first;
+        } else if( !changed ) {
+            changed = true;
+            file->changed_subscribers_.push_back( this );
+            file->changed_traces_num_ += last - first;
+        }
+    }
+
+    sc_trace_file_base* file;
+    size_t first;
+    size_t last;
+    bool   changed;
+};
+
 
 sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension )
   : sc_trace_file()
@@ -73,6 +101,19 @@ sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension
   , filename_()
   , initialized_(false)
   , trace_delta_cycles_(false)
+  , subscribers_()
+  , changed_subscribers_()
+  , polled_traces_()
+  , checked_traces_()
+  , all_traces_()
+  , changed_traces_num_(0)
+  , poll_all_(false)
+  , polled_mask_()
+  , changed_mask_()
+  , polled_ready_(false)
+  , subscription_source_(0)
+  , subscription_first_(0)
+  , subscription_depth_(0)
 {
     if( !name || !*name ) {
         SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, "no name given" );
@@ -101,6 +142,9 @@ sc_trace_file_base::~sc_trace_file_base()
     if( fp )
         fclose(fp);
 
+    for( size_t i = 0; i != subscribers_.size(); ++i )
+        delete subscribers_[i];
+
 #if SC_TRACING_PHASE_CALLBACKS_ == 0
     // unregister from simcontext
     sc_get_curr_simcontext()->remove_trace_file( this );
@@ -171,6 +215,9 @@ sc_trace_file_base::initialize()
     // initialize derived tracing implementation class (VCD/WIF)
     do_initialize();
 
+    // all initial values are dumped
+    clear_trace_changes();
+
     return initialized_;
 }
 
@@ -224,6 +271,116 @@ sc_trace_file_base::set_time_unit( double v, sc_time_unit tu )
     }
 }
 
+void
+sc_trace_file_base::begin_subscription( const sc_trace_source& source )
+{
+    // nested subscription binds traces to the outer source
+    if( subscription_depth_++ != 0 || initialized_ ) return;
+
+    subscription_source_ = &source;
+    subscription_first_ = trace_count();
+}
+
+void
+sc_trace_file_base::end_subscription()
+{
+    sc_assert( subscription_depth_ > 0 );
+    if( --subscription_depth_ != 0 || !subscription_source_ ) return;
+
+    size_t last = trace_count();
+    if( last > subscription_first_ ) {
+        trace_subscriber* s =
+            new trace_subscriber( this, subscription_first_, last );
+        subscription_source_->add_trace_subscriber( s );
+        subscribers_.push_back( s );
+    }
+    subscription_source_ = 0;
+}
+
+size_t
+sc_trace_file_base::trace_count() const
+{
+    return 0;
+}
+
+const std::vector<size_t>&
+sc_trace_file_base::traces_to_check()
+{
+    if( !polled_ready_ ) {
+        size_t n = trace_count();
+        polled_mask_.assign( (n + 63) / 64, ~sc_dt::UINT64_ZERO );
+        changed_mask_.assign( polled_mask_.size(), sc_dt::UINT64_ZERO );
+        if( n % 64 ) polled_mask_.back() = (sc_dt::UINT64_ONE << n % 64) - 1;
+
+        for( size_t i = 0; i != subscribers_.size(); ++i ) {
+            for( size_t j = subscribers_[i]->first;
+                 j != subscribers_[i]->last; ++j ) {
+                polled_mask_[j / 64] &= ~(sc_dt::UINT64_ONE << j % 64);
+            }
+        }
+        for( size_t i = 0; i != n; ++i ) {
+            if( polled_mask_[i / 64] >> i % 64 & 1 )
+                polled_traces_.push_back( i );
+            all_traces_.push_back( i );
+        }
+        polled_ready_ = true;
+    }
+
+    // changed sources are not recorded while most of traces change,
+    // recording is resumed when the number of changed traces decreases
+    if( poll_all_ ) {
+        size_t changed_num = changed_traces_num_;
+        changed_traces_num_ = 0;
+        if( changed_num == 0 )
+            return polled_traces_;
+        if( changed_num * 8 < all_traces_.size() )
+            poll_all_ = false;
+        return all_traces_;
+    }
+
+    if( changed_subscribers_.empty() )
+        return polled_traces_;
+
+    // most of traces changed, check all of them
+    if( changed_traces_num_ * 4 >= all_traces_.size() ) {
+        clear_trace_changes();
+        poll_all_ = true;
+        return all_traces_;
+    }
+
+    // mark changed traces, then merge them with polled ones by bit mask
+    // scan to keep trace order the same as in polling of all traces
+    for( size_t i = 0; i != changed_subscribers_.size(); ++i ) {
+        trace_subscriber* s = changed_subscribers_[i];
+        for( size_t j = s->first; j != s->last; ++j ) {
+            changed_mask_[j / 64] |= sc_dt::UINT64_ONE << j % 64;
+        }
+        s->changed = false;
+    }
+    changed_subscribers_.clear();
+    changed_traces_num_ = 0;
+
+    checked_traces_.clear();
+    for( size_t w = 0; w != changed_mask_.size(); ++w ) {
+        sc_dt::uint64 mask = polled_mask_[w] | changed_mask_[w];
+        changed_mask_[w] = 0;
+        for( size_t i = w * 64; mask != 0; ++i, mask >>= 1 ) {
+            if( mask & 1 ) checked_traces_.push_back( i );
+        }
+    }
+    return checked_traces_;
+}
+
+void
+sc_trace_file_base::clear_trace_changes()
+{
+    for( size_t i = 0; i != changed_subscribers_.size(); ++i ) {
+        changed_subscribers_[i]->changed = false;
+    }
+    changed_subscribers_.clear();
+    changed_traces_num_ = 0;
+}
+
 bool
 sc_trace_file_base::add_trace_check( const std::string & name ) const
 {
@@ -41,6 +41,7 @@
 #define SC_TRACE_FILE_BASE_H_INCLUDED_
 
 #include <cstdio>
+#include <vector>
 
 // use callback-based tracing implementation
 #if defined( SC_ENABLE_SIMULATION_PHASE_CALLBACKS_TRACING )
@@ -82,6 +83,10 @@ public:
     // set a user-define timescale unit for the trace file
     virtual void set_time_unit( double v, sc_time_unit tu);
 
+    // bind traces added until end_subscription() to the source
+    virtual void begin_subscription( const sc_trace_source& source );
+    virtual void end_subscription();
+
 protected:
     sc_trace_file_base( const char* name, const char* extension );
 
@@ -98,6 +103,17 @@ protected:
     // (i.e. trace file is not yet initialized)
     bool add_trace_check( const std::string& name ) const;
 
+    // number of traces added, used to bind traces to the source,
+    // traces are not bound if it is not overridden
+    virtual size_t trace_count() const;
+
+    // indices of traces to check for change in ascending order: traces not
+    // bound to a source and traces of sources changed since previous call
+    const std::vector<size_t>& traces_to_check();
+
+    // forget source changes, all values are checked by the caller
+    void clear_trace_changes();
+
     // tracefile time unit < kernel unit, extra units will be placed in low part
     bool has_low_units() const;
 
@@ -133,6 +149,23 @@ private:
 
     static bool tracing_initialized_;  // shared setup of tracing implementation
 
+    class trace_subscriber;            // defined in sc_trace_file_base.cpp
+
+    std::vector<trace_subscriber*> subscribers_;         // all bound ranges
+    std::vector<trace_subscriber*> changed_subscribers_; // notified ranges
+    std::vector<size_t> polled_traces_;  // traces not bound to a source
+    std::vector<size_t> checked_traces_; // polled and changed traces
+    std::vector<size_t> all_traces_;     // used if most of traces changed
+    size_t              changed_traces_num_; // traces of changed_subscribers_
+    bool                poll_all_;       // most of traces change, check all
+    std::vector<sc_dt::uint64> polled_mask_;  // bit per trace not bound
+    std::vector<sc_dt::uint64> changed_mask_; // bit per trace changed
+    bool                polled_ready_;   // polled_traces_ is filled
+
+    const sc_trace_source* subscription_source_; // current source to bind
+    size_t      subscription_first_;   // first trace bound to the source
+    int         subscription_depth_;   // nested begin_subscription() calls
+
 private: // disabled
     sc_trace_file_base( const sc_trace_file_base& ) /* = delete */;
     sc_trace_file_base& operator=( const sc_trace_file_base& ) /* = delete */;
@@ -1865,6 +1865,12 @@ vcd_trace_file::do_initialize()
     std::fputs("$end\n\n", fp);
 }
 
+size_t
+vcd_trace_file::trace_count() const
+{
+    return traces.size();
+}
+
 #if SC_TRACING_PHASE_CALLBACKS_
 void vcd_trace_file::trace( sc_trace_file* ) const {
     SC_REPORT_ERROR( sc_core::SC_ID_INTERNAL_ERROR_
@@ -2054,11 +2060,13 @@ vcd_trace_file::cycle(bool this_is_a_delta_cycle)
         }
     }
 
-    // Now do the actual printing
+    // Now do the actual printing, signal variables are checked
+    // only if the signal is changed
     bool time_printed = false;
-    vcd_trace* const* const l_traces = &traces[0];
-    for (int i = 0; i < (int)traces.size(); i++) {
-        vcd_trace* t = l_traces[i];
+    const std::vector<size_t>& indices = traces_to_check();
+    vcd_trace* const* const l_traces = traces.empty() ? 0 : &traces[0];
+    for (size_t i = 0; i != indices.size(); i++) {
+        vcd_trace* t = l_traces[indices[i]];
         if(t->changed()) {
             if(!time_printed){
                 print_time_stamp(now_units_high, now_units_low);
@@ -218,6 +218,8 @@ private:
 
     // Initialize the VCD tracing
     virtual void do_initialize();
+    // Number of variables added, used to bind them to signals
+    virtual size_t trace_count() const;
     void print_time_stamp(unit_type now_units_high, unit_type now_units_low) const;
     bool get_time_stamp(unit_type &now_units_high, unit_type &now_units_low) const;
 